@@ -0,0 +1,445 @@
+/****************************************************************************************************************************
+  Arduino.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the part of the Arduino core API used by the library, on Linux.
+  PROGMEM is plain memory, String wraps std::string, Serial writes to stdout and the clock is the monotonic one, or a
+  virtual one for the simulations.
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cctype>
+#include <cstdarg>
+#include <strings.h>
+#include <algorithm>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+typedef uint8_t   byte;
+typedef bool      boolean;
+
+#define HEX       16
+#define DEC       10
+
+/////////////////////////////////////////////////////////////////////////////
+// Flash strings are in RAM on the host
+
+#define PROGMEM
+typedef const char* PGM_P;
+
+class __FlashStringHelper;
+
+#define F(s)                  (reinterpret_cast<const __FlashStringHelper*>(s))
+#define FPSTR(p)              (reinterpret_cast<const __FlashStringHelper*>(p))
+#define PSTR(s)               (s)
+
+#define pgm_read_byte(p)      (*(const uint8_t*)(p))
+#define pgm_read_word(p)      (*(const uint16_t*)(p))
+#define pgm_read_dword(p)     (*(const uint32_t*)(p))
+
+#define memcpy_P              memcpy
+#define strlen_P              strlen
+#define strcmp_P              strcmp
+#define strncmp_P             strncmp
+#define strcpy_P              strcpy
+#define strncpy_P             strncpy
+#define snprintf_P            snprintf
+
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+/////////////////////////////////////////////////////////////////////////////
+// Time. WM_HostClock::nowMicros() is the source of millis(), from the start of the program.
+//
+// With WM_HostClock::setVirtual(true), the time only moves with delay() and yield(), and at once : the timeouts of
+// minutes of a connection or of the Config Portal are run in milliseconds. yield() and delay(0) then take
+// setYieldTime() of virtual time, as a turn of loop() on the board. The hooks of onTick() are called each virtual ms,
+// the mock WiFi runs its radio there. The virtual clock is for a single thread.
+
+class WM_HostClock
+{
+  public:
+
+    static void setVirtual(bool on)
+    {
+      State& s = state();
+
+      if (on && !s._virtual)
+        s._now = realMicros();
+
+      s._virtual = on;
+    }
+
+    static bool isVirtual()
+    {
+      return state()._virtual;
+    }
+
+    static void setYieldTime(uint32_t us)
+    {
+      state()._yieldTime = us;
+    }
+
+    static uint32_t yieldTime()
+    {
+      return state()._yieldTime;
+    }
+
+    static void onTick(std::function<void()> hook)
+    {
+      state()._hooks.push_back(hook);
+    }
+
+    static uint64_t nowMicros()
+    {
+      State& s = state();
+
+      return s._virtual ? s._now.load() : realMicros();
+    }
+
+    // Virtual time moves by us, a tick each ms. Real time is slept.
+    static void advance(uint64_t us)
+    {
+      State& s = state();
+
+      if (!s._virtual)
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+        return;
+      }
+
+      uint64_t end = s._now + us;
+
+      while (s._now < end)
+      {
+        s._now = std::min(end, (s._now / 1000 + 1) * 1000);
+
+        // Not again from a hook
+        if (s._ticking)
+          continue;
+
+        s._ticking = true;
+
+        for (auto& hook : s._hooks)
+          hook();
+
+        s._ticking = false;
+      }
+    }
+
+  private:
+
+    typedef struct
+    {
+      std::atomic<bool>                   _virtual    { false };
+      std::atomic<uint64_t>               _now        { 0 };
+      uint32_t                            _yieldTime  = 1000;
+      bool                                _ticking    = false;
+      std::vector<std::function<void()>>  _hooks;
+    } State;
+
+    static State& state()
+    {
+      static State s;
+
+      return s;
+    }
+
+    static uint64_t realMicros()
+    {
+      static const auto start = std::chrono::steady_clock::now();
+
+      return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+inline unsigned long millis()
+{
+  return (unsigned long) (WM_HostClock::nowMicros() / 1000);
+}
+
+inline unsigned long micros()
+{
+  return (unsigned long) WM_HostClock::nowMicros();
+}
+
+inline void yield()
+{
+  if (WM_HostClock::isVirtual())
+    WM_HostClock::advance(WM_HostClock::yieldTime());
+  else
+    std::this_thread::yield();
+}
+
+inline void delay(unsigned long ms)
+{
+  if (ms == 0)
+    yield();
+  else
+    WM_HostClock::advance((uint64_t) ms * 1000);
+}
+
+inline long random(long howsmall, long howbig)
+{
+  return (howsmall >= howbig) ? howsmall : howsmall + (rand() % (howbig - howsmall));
+}
+
+inline long random(long howbig)
+{
+  return random(0, howbig);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+class String
+{
+  public:
+
+    String() {}
+    String(const char* cstr) : _s(cstr ? cstr : "") {}
+    String(const std::string& str) : _s(str) {}
+    String(const __FlashStringHelper* pstr) : _s(pstr ? (const char*) pstr : "") {}
+    explicit String(char c) : _s(1, c) {}
+
+    explicit String(int value, unsigned char base = DEC)            { format(base == HEX ? "%x" : "%d", value); }
+    explicit String(unsigned int value, unsigned char base = DEC)   { format(base == HEX ? "%x" : "%u", value); }
+    explicit String(long value, unsigned char base = DEC)           { format(base == HEX ? "%lx" : "%ld", value); }
+    explicit String(unsigned long value, unsigned char base = DEC)  { format(base == HEX ? "%lx" : "%lu", value); }
+    explicit String(float value, unsigned char decimals = 2)        { format("%.*f", (int) decimals, (double) value); }
+    explicit String(double value, unsigned char decimals = 2)       { format("%.*f", (int) decimals, value); }
+
+    const char*   c_str() const               { return _s.c_str(); }
+    unsigned int  length() const              { return _s.size(); }
+    bool          isEmpty() const             { return _s.empty(); }
+    bool          reserve(unsigned int size)  { _s.reserve(size); return true; }
+
+    char          charAt(unsigned int index) const      { return (index < _s.size()) ? _s[index] : 0; }
+    char          operator[](unsigned int index) const  { return charAt(index); }
+    char&         operator[](unsigned int index)        { return _s[index]; }
+
+    bool concat(const String& str)                      { _s += str._s; return true; }
+    bool concat(const char* cstr)                       { if (cstr) _s += cstr; return true; }
+    bool concat(const char* cstr, unsigned int length)  { if (cstr) _s.append(cstr, length); return true; }
+    bool concat(char c)                                 { _s += c; return true; }
+
+    String& operator+=(const String& str)               { _s += str._s; return *this; }
+    String& operator+=(const char* cstr)                { concat(cstr); return *this; }
+    String& operator+=(const __FlashStringHelper* pstr) { concat((const char*) pstr); return *this; }
+    String& operator+=(char c)                          { _s += c; return *this; }
+    String& operator+=(int value)                       { return *this += String(value); }
+    String& operator+=(unsigned int value)              { return *this += String(value); }
+    String& operator+=(long value)                      { return *this += String(value); }
+    String& operator+=(unsigned long value)             { return *this += String(value); }
+
+    friend String operator+(const String& lhs, const String& rhs)                 { return String(lhs._s + rhs._s); }
+    friend String operator+(const String& lhs, const char* rhs)                   { String s(lhs); s.concat(rhs); return s; }
+    friend String operator+(const char* lhs, const String& rhs)                   { String s(lhs); s.concat(rhs); return s; }
+    friend String operator+(const String& lhs, const __FlashStringHelper* rhs)    { return lhs + (const char*) rhs; }
+    friend String operator+(const String& lhs, char rhs)                          { String s(lhs); s.concat(rhs); return s; }
+
+    bool operator==(const String& rhs) const  { return _s == rhs._s; }
+    bool operator==(const char* rhs) const    { return _s == (rhs ? rhs : ""); }
+    bool operator!=(const String& rhs) const  { return _s != rhs._s; }
+    bool operator!=(const char* rhs) const    { return !(*this == rhs); }
+    bool operator<(const String& rhs) const   { return _s < rhs._s; }
+
+    bool equals(const String& str) const            { return _s == str._s; }
+    bool equalsIgnoreCase(const String& str) const  { return strcasecmp(_s.c_str(), str._s.c_str()) == 0; }
+    int  compareTo(const String& str) const         { return _s.compare(str._s); }
+    bool startsWith(const String& prefix) const     { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+
+    bool endsWith(const String& suffix) const
+    {
+      return (_s.size() >= suffix._s.size()) && (_s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0);
+    }
+
+    int indexOf(char c, unsigned int from = 0) const            { return position(_s.find(c, from)); }
+    int indexOf(const String& str, unsigned int from = 0) const { return position(_s.find(str._s, from)); }
+    int lastIndexOf(char c) const                               { return position(_s.rfind(c)); }
+
+    String substring(unsigned int from) const
+    {
+      return (from < _s.size()) ? String(_s.substr(from)) : String();
+    }
+
+    String substring(unsigned int from, unsigned int to) const
+    {
+      return ( (from < _s.size()) && (from < to) ) ? String(_s.substr(from, to - from)) : String();
+    }
+
+    void replace(const String& find, const String& replace)
+    {
+      if (find._s.empty())
+        return;
+
+      for (size_t pos = 0; (pos = _s.find(find._s, pos)) != std::string::npos; pos += replace._s.size())
+        _s.replace(pos, find._s.size(), replace._s);
+    }
+
+    void remove(unsigned int index, unsigned int count = (unsigned int) -1)
+    {
+      if (index < _s.size())
+        _s.erase(index, count);
+    }
+
+    void trim()
+    {
+      size_t first = 0;
+
+      while ( (first < _s.size()) && isspace((unsigned char) _s[first]) )
+        first++;
+
+      _s.erase(0, first);
+
+      while ( !_s.empty() && isspace((unsigned char) _s.back()) )
+        _s.pop_back();
+    }
+
+    void toUpperCase()  { for (char& c : _s) c = toupper((unsigned char) c); }
+    void toLowerCase()  { for (char& c : _s) c = tolower((unsigned char) c); }
+
+    long  toInt() const   { return atol(_s.c_str()); }
+    float toFloat() const { return atof(_s.c_str()); }
+
+    void toCharArray(char* buf, unsigned int bufsize) const
+    {
+      if (bufsize == 0)
+        return;
+
+      size_t len = std::min((size_t) bufsize - 1, _s.size());
+
+      memcpy(buf, _s.data(), len);
+      buf[len] = 0;
+    }
+
+    void getBytes(unsigned char* buf, unsigned int bufsize) const
+    {
+      toCharArray((char*) buf, bufsize);
+    }
+
+  private:
+
+    std::string _s;
+
+    static int position(size_t pos)
+    {
+      return (pos == std::string::npos) ? -1 : (int) pos;
+    }
+
+    template<typename T>
+    void format(const char* fmt, T value)
+    {
+      char buf[32];
+
+      snprintf(buf, sizeof(buf), fmt, value);
+      _s = buf;
+    }
+
+    void format(const char* fmt, int decimals, double value)
+    {
+      char buf[64];
+
+      snprintf(buf, sizeof(buf), fmt, decimals, value);
+      _s = buf;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////
+
+class Print;
+
+class Printable
+{
+  public:
+
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print
+{
+  public:
+
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+      size_t n = 0;
+
+      while (size--)
+        n += write(*buffer++);
+
+      return n;
+    }
+
+    size_t write(const char* str)                   { return str ? write((const uint8_t*) str, strlen(str)) : 0; }
+
+    size_t print(const char* str)                   { return write(str); }
+    size_t print(const String& str)                 { return write(str.c_str()); }
+    size_t print(const __FlashStringHelper* pstr)   { return write((const char*) pstr); }
+    size_t print(char c)                            { return write((uint8_t) c); }
+    size_t print(int value, int base = DEC)         { return print(String(value, base)); }
+    size_t print(unsigned int value, int base = DEC)  { return print(String(value, base)); }
+    size_t print(long value, int base = DEC)        { return print(String(value, base)); }
+    size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(double value, int decimals = 2)    { return print(String(value, (unsigned char) decimals)); }
+    size_t print(const Printable& printable)        { return printable.printTo(*this); }
+
+    size_t println()                                { return print("\r\n"); }
+
+    template<typename T>
+    size_t println(const T& value)
+    {
+      size_t n = print(value);
+
+      return n + println();
+    }
+
+    size_t printf(const char* format, ...) __attribute__ ((format (printf, 2, 3)))
+    {
+      char    buf[256];
+      va_list args;
+
+      va_start(args, format);
+      vsnprintf(buf, sizeof(buf), format, args);
+      va_end(args);
+
+      return print(buf);
+    }
+};
+
+class HardwareSerial : public Print
+{
+  public:
+
+    void begin(unsigned long)   {}
+    void flush()                { fflush(stdout); }
+
+    size_t write(uint8_t c) override
+    {
+      return fwrite(&c, 1, 1, stdout);
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) override
+    {
+      return fwrite(buffer, 1, size, stdout);
+    }
+
+    using Print::write;
+};
+
+inline HardwareSerial Serial;
+
+#include "IPAddress.h"
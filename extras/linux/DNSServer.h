@@ -0,0 +1,13 @@
+/****************************************************************************************************************************
+  DNSServer.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the library includes the DNS server of the core, the host one is
+  WM_PosixDNSServer.
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include "WM_PosixDNSServer.h"
@@ -0,0 +1,13 @@
+/****************************************************************************************************************************
+  ESP8266WebServer.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the library includes the web server of the core, the host one is
+  WM_PosixWebServer.
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include "WM_PosixWebServer.h"
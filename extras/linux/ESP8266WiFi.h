@@ -0,0 +1,845 @@
+/****************************************************************************************************************************
+  ESP8266WiFi.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : a mock of the ESP8266 WiFi and ESP classes.
+
+  There is no radio. The networks in range are given with WiFi.addNetwork(), and a station connection succeeds when
+  the SSID is in range and the password matches, with the station events and the statuses of the core. Each network
+  can take its time to associate and to give the IP, fail a number of attempts with a disconnect reason, or go out of
+  range. A connection can be dropped with WiFi.dropConnection() / WiFi.scheduleDrop(). As the SDK, the driver tries
+  again by itself after a failure or a lost connection while auto reconnect is on, until WiFi.disconnect() or the
+  station mode is left. The times are 0 by default, so that the connection is made in WiFi.begin().
+
+  As the SDK, the station configuration given to WiFi.begin(), BSSID included, is the one of WiFi.begin() without
+  arguments and of the reconnections, and is saved to the flash while WiFi.persistent() is on. WiFi.reboot() loads it
+  back, as the next boot.
+
+  The radio runs when the WiFi API is called, and each ms of the virtual clock of Arduino.h : with
+  WM_HostClock::setVirtual(true), the scenarios of connect_sim.cpp take the time of the board without waiting for it.
+
+  The soft AP only keeps its configuration, the portal is reached through the sockets of the host.
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+#include "user_interface.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+typedef enum
+{
+  WL_NO_SHIELD        = 255,
+  WL_IDLE_STATUS      = 0,
+  WL_NO_SSID_AVAIL    = 1,
+  WL_SCAN_COMPLETED   = 2,
+  WL_CONNECTED        = 3,
+  WL_CONNECT_FAILED   = 4,
+  WL_CONNECTION_LOST  = 5,
+  WL_WRONG_PASSWORD   = 6,
+  WL_DISCONNECTED     = 7
+} wl_status_t;
+
+typedef enum
+{
+  WIFI_OFF    = 0,
+  WIFI_STA    = 1,
+  WIFI_AP     = 2,
+  WIFI_AP_STA = 3
+} WiFiMode_t;
+
+enum wl_enc_type
+{
+  ENC_TYPE_WEP  = 5,
+  ENC_TYPE_TKIP = 2,
+  ENC_TYPE_CCMP = 4,
+  ENC_TYPE_NONE = 7,
+  ENC_TYPE_AUTO = 8
+};
+
+#define WIFI_SCAN_RUNNING     (-1)
+#define WIFI_SCAN_FAILED      (-2)
+
+// Disconnect reasons of the SDK, as far as the mock reports them
+typedef enum
+{
+  WIFI_DISCONNECT_REASON_UNSPECIFIED            = 1,
+  WIFI_DISCONNECT_REASON_ASSOC_LEAVE            = 8,
+  WIFI_DISCONNECT_REASON_4WAY_HANDSHAKE_TIMEOUT = 15,
+  WIFI_DISCONNECT_REASON_BEACON_TIMEOUT         = 200,
+  WIFI_DISCONNECT_REASON_NO_AP_FOUND            = 201,
+  WIFI_DISCONNECT_REASON_AUTH_FAIL              = 202,
+  WIFI_DISCONNECT_REASON_ASSOC_FAIL             = 203,
+  WIFI_DISCONNECT_REASON_HANDSHAKE_TIMEOUT      = 204
+} WiFiDisconnectReason;
+
+struct WiFiEventStationModeConnected
+{
+  String    ssid;
+  uint8_t   bssid[6];
+  uint8_t   channel;
+};
+
+struct WiFiEventStationModeGotIP
+{
+  IPAddress ip;
+  IPAddress mask;
+  IPAddress gw;
+};
+
+struct WiFiEventStationModeDisconnected
+{
+  String                ssid;
+  uint8_t               bssid[6];
+  WiFiDisconnectReason  reason;
+};
+
+// The handler is called as long as the returned handle lives
+typedef std::shared_ptr<void> WiFiEventHandler;
+
+// One network known to the mock. The times are in ms, from WiFi.begin().
+struct WM_HostNetwork
+{
+  String    ssid;
+  String    pass;                     // Empty for an open network
+  int32_t   rssi;
+  uint8_t   channel;
+  uint8_t   encryption;               // wl_enc_type
+  uint8_t   bssid[6];
+  bool      hidden;
+
+  uint32_t  associateTime = 0;        // To associate, or to fail with failReason or a wrong password
+  int32_t   dhcpTime      = 0;        // From the association to the IP, -1 for never
+  uint8_t   failReason    = 0;        // WiFiDisconnectReason of a failed association, 0 for none
+  int       failCount     = -1;       // Attempts failing with failReason, -1 for all of them
+  bool      inRange       = true;
+};
+
+// The station configuration of the SDK, the one in use and the one saved in flash
+struct WM_HostStationConfig
+{
+  String    ssid;
+  String    pass;
+  bool      bssidSet  = false;
+  uint8_t   bssid[6]  = {};
+};
+
+/////////////////////////////////////////////////////////////////////////////
+
+class ESP8266WiFiClass
+{
+  public:
+
+    //////////////////////////////////////////
+    // Networks in range
+
+    void addNetwork(const WM_HostNetwork& network)
+    {
+      _networks.push_back(network);
+    }
+
+    void clearNetworks()
+    {
+      _networks.clear();
+    }
+
+    // The connection to the SSID, if any, is lost with a beacon timeout
+    void setInRange(const String& ssid, bool inRange)
+    {
+      for (WM_HostNetwork& network : _networks)
+      {
+        if (network.ssid == ssid)
+          network.inRange = inRange;
+      }
+
+      if ( !inRange && _associated && (_network.ssid == ssid) )
+        dropConnection(WIFI_DISCONNECT_REASON_BEACON_TIMEOUT);
+    }
+
+    //////////////////////////////////////////
+    // Radio of the mock
+
+    // Time of a scan, and for the driver to give up on an SSID not in range
+    void setScanTime(uint32_t ms)       { _scanTime = ms; }
+    void setNoAPTime(uint32_t ms)       { _noAPTime = ms; }
+
+    // From a lost connection to the next attempt of auto reconnect
+    void setReconnectTime(uint32_t ms)  { _reconnectTime = ms; }
+
+    // Association attempts and scans since WiFi.reset()
+    uint32_t  attempts()                { return _attempts; }
+    uint32_t  scans()                   { return _scans; }
+
+    void dropConnection(WiFiDisconnectReason reason)
+    {
+      update();
+
+      if (!_associated)
+        return;
+
+      _associated = false;
+      _status     = _autoReconnect ? WL_DISCONNECTED : WL_IDLE_STATUS;
+      _pending    = PENDING_NONE;
+
+      disconnected(reason);
+
+      if (_autoReconnect)
+        schedule(PENDING_RETRY, millis() + _reconnectTime);
+    }
+
+    void scheduleDrop(uint32_t afterMs, WiFiDisconnectReason reason)
+    {
+      _dropPending  = true;
+      _dropAt       = millis() + afterMs;
+      _dropReason   = reason;
+    }
+
+    // A reset of the board : the station stops, and takes the configuration saved in flash. The networks, the counters
+    // and the event handlers are kept.
+    void reboot()
+    {
+      stopStation(WL_DISCONNECTED);
+
+      _staConfig  = _savedConfig;
+      _persistent = true;
+    }
+
+    // The BSSID of the configuration saved in flash, NULL if none
+    const uint8_t* savedBSSID()         { return _savedConfig.bssidSet ? _savedConfig.bssid : NULL; }
+
+    // Back to the mock of power on : no network, no saved credentials. The event handlers are kept.
+    void reset()
+    {
+      Handlers<WiFiEventStationModeConnected>     onConnected     = _onConnected;
+      Handlers<WiFiEventStationModeGotIP>         onGotIP         = _onGotIP;
+      Handlers<WiFiEventStationModeDisconnected>  onDisconnected  = _onDisconnected;
+
+      *this = ESP8266WiFiClass();
+
+      _onConnected    = onConnected;
+      _onGotIP        = onGotIP;
+      _onDisconnected = onDisconnected;
+    }
+
+    // Runs what is due of the radio. Called by the WiFi API, and each ms of the virtual clock.
+    void update()
+    {
+      unsigned long now = millis();
+
+      if ( _scanRunning && due(_scanDoneAt, now) )
+        completeScan();
+
+      while (true)
+      {
+        bool pendingDue = (_pending != PENDING_NONE) && due(_pendingAt, now);
+        bool dropDue    = _dropPending && due(_dropAt, now);
+
+        if (dropDue && ( !pendingDue || due(_dropAt, _pendingAt) ) )
+        {
+          _dropPending = false;
+          dropConnection(_dropReason);
+        }
+        else if (pendingDue)
+        {
+          runPending();
+        }
+        else
+        {
+          break;
+        }
+      }
+    }
+
+    //////////////////////////////////////////
+    // Mode
+
+    bool mode(WiFiMode_t mode)
+    {
+      update();
+
+      // The station stops, and its connection with it
+      if ( (_mode & WIFI_STA) && !(mode & WIFI_STA) )
+        stopStation(WL_DISCONNECTED);
+
+      _mode = mode;
+
+      return true;
+    }
+
+    WiFiMode_t  getMode()                   { return _mode; }
+    bool        persistent(bool on)         { _persistent = on; return true; }
+    bool        getAutoConnect()            { return _autoConnect; }
+    bool        setAutoConnect(bool on)     { _autoConnect = on; return true; }
+    bool        getAutoReconnect()          { return _autoReconnect; }
+    bool        setAutoReconnect(bool on)   { _autoReconnect = on; return true; }
+
+    //////////////////////////////////////////
+    // Soft AP
+
+    bool softAP(const char* ssid, const char* pass = NULL, int channel = 1, int hidden = 0, int maxConnection = 4)
+    {
+      (void) hidden;
+      (void) maxConnection;
+
+      _apSSID     = ssid ? ssid : "";
+      _apPass     = pass ? pass : "";
+      _apChannel  = channel;
+      _mode       = (WiFiMode_t) (_mode | WIFI_AP);
+
+      return true;
+    }
+
+    bool softAP(const String& ssid, const String& pass = String(), int channel = 1, int hidden = 0, int maxConnection = 4)
+    {
+      return softAP(ssid.c_str(), pass.c_str(), channel, hidden, maxConnection);
+    }
+
+    bool softAPConfig(IPAddress local, IPAddress gateway, IPAddress subnet)
+    {
+      (void) gateway;
+      (void) subnet;
+
+      _apIP = local;
+
+      return true;
+    }
+
+    IPAddress softAPIP()          { return (_mode & WIFI_AP) ? _apIP : IPAddress(); }
+    String    softAPmacAddress()  { return "1A:FE:34:00:00:01"; }
+
+    //////////////////////////////////////////
+    // Station
+
+    wl_status_t begin(const char* ssid, const char* pass = NULL, int32_t channel = 0, const uint8_t* bssid = NULL, bool connect = true)
+    {
+      _staConfig.ssid     = ssid ? ssid : "";
+      _staConfig.pass     = pass ? pass : "";
+      _staConfig.bssidSet = (bssid != NULL);
+
+      if (bssid)
+        memcpy(_staConfig.bssid, bssid, 6);
+
+      if (_persistent)
+        _savedConfig = _staConfig;
+
+      if (connect)
+        beginConnection(channel, staBSSID(), millis());
+
+      return status();
+    }
+
+    wl_status_t begin(const String& ssid, const String& pass = String(), int32_t channel = 0, const uint8_t* bssid = NULL, bool connect = true)
+    {
+      return begin(ssid.c_str(), pass.c_str(), channel, bssid, connect);
+    }
+
+    // To the network of the station configuration
+    wl_status_t begin()
+    {
+      beginConnection(0, staBSSID(), millis());
+
+      return status();
+    }
+
+    bool disconnect(bool wifiOff = false)
+    {
+      update();
+      stopStation(WL_IDLE_STATUS);
+
+      if (wifiOff)
+        _mode = (WiFiMode_t) (_mode & ~WIFI_STA);
+
+      return true;
+    }
+
+    bool reconnect()
+    {
+      return begin() != WL_CONNECT_FAILED;
+    }
+
+    wl_status_t status()
+    {
+      update();
+
+      return _status;
+    }
+
+    // As the core : -1 on timeout
+    int8_t waitForConnectResult(unsigned long timeoutLength = 60000)
+    {
+      if ( !(_mode & WIFI_STA) )
+        return WL_DISCONNECTED;
+
+      unsigned long start = millis();
+
+      while (status() == WL_DISCONNECTED)
+      {
+        if (millis() - start >= timeoutLength)
+          return -1;
+
+        delay(0);
+      }
+
+      return status();
+    }
+
+    bool config(IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress())
+    {
+      _staticIP   = local;
+      _gateway    = gateway;
+      _subnet     = subnet;
+      _dns1       = dns1;
+      _dns2       = dns2;
+
+      return true;
+    }
+
+    bool      hostname(const char* name)  { _hostname = name ? name : ""; return true; }
+    bool      hostname(const String& name) { return hostname(name.c_str()); }
+    String    hostname()                  { return _hostname; }
+
+    String    SSID() const                { return _staConfig.ssid; }
+    String    psk() const                 { return _staConfig.pass; }
+    String    macAddress()                { return "18:FE:34:00:00:01"; }
+
+    // The DHCP lease is on a subnet of each AP, 192.168.<last byte of its BSSID>.0/24
+    IPAddress localIP()                   { return connected() ? (_staticIP ? _staticIP : IPAddress(192, 168, _network.bssid[5], 100)) : IPAddress(); }
+    IPAddress gatewayIP()                 { return connected() ? (_staticIP ? _gateway : IPAddress(192, 168, _network.bssid[5], 1)) : IPAddress(); }
+    IPAddress subnetMask()                { return connected() ? (_staticIP ? _subnet : IPAddress(255, 255, 255, 0)) : IPAddress(); }
+    IPAddress dnsIP(uint8_t index = 0)    { return connected() ? (index ? _dns2 : (_dns1 ? _dns1 : gatewayIP())) : IPAddress(); }
+
+    // 31 when not associated, as the SDK
+    int32_t   RSSI()                      { update(); return _associated ? _network.rssi : 31; }
+    int32_t   channel()                   { update(); return _associated ? _network.channel : _apChannel; }
+    uint8_t*  BSSID()                     { update(); return _associated ? _network.bssid : NULL; }
+
+    bool      beginWPSConfig()            { return false; }
+
+    //////////////////////////////////////////
+    // Scan
+
+    int16_t scanNetworks(bool async = false, bool showHidden = false, uint8_t channel = 0, uint8_t* ssid = NULL)
+    {
+      (void) ssid;
+
+      if (_scanRunning)
+        return WIFI_SCAN_RUNNING;
+
+      _scans++;
+      _scan.clear();
+      _scanInfo.clear();
+      _scanDone         = false;
+      _scanRunning      = true;
+      _scanShowHidden   = showHidden;
+      _scanChannel      = channel;
+      _scanDoneAt       = millis() + _scanTime;
+
+      if (async)
+      {
+        update();
+        return WIFI_SCAN_RUNNING;
+      }
+
+      while (scanComplete() == WIFI_SCAN_RUNNING)
+        delay(1);
+
+      return _scan.size();
+    }
+
+    int16_t scanComplete()
+    {
+      update();
+
+      return _scanRunning ? WIFI_SCAN_RUNNING : ( _scanDone ? (int16_t) _scan.size() : WIFI_SCAN_FAILED );
+    }
+
+    void scanDelete()
+    {
+      _scan.clear();
+      _scanInfo.clear();
+      _scanDone = false;
+    }
+
+    String    SSID(uint8_t i)             { return (i < _scan.size()) ? (_scan[i].hidden ? String() : _scan[i].ssid) : String(); }
+    int32_t   RSSI(uint8_t i)             { return (i < _scan.size()) ? _scan[i].rssi : 0; }
+    uint8_t   encryptionType(uint8_t i)   { return (i < _scan.size()) ? _scan[i].encryption : 0; }
+    int32_t   channel(uint8_t i)          { return (i < _scan.size()) ? _scan[i].channel : 0; }
+    uint8_t*  BSSID(uint8_t i)            { return (i < _scan.size()) ? _scan[i].bssid : NULL; }
+    bool      isHidden(uint8_t i)         { return (i < _scan.size()) && _scan[i].hidden; }
+
+    // The record of the SDK, valid until the next scan
+    bss_info* getScanInfoByIndex(int i)   { return ( (i >= 0) && ((size_t) i < _scanInfo.size()) ) ? &_scanInfo[i] : NULL; }
+
+    String BSSIDstr(uint8_t i)
+    {
+      char buf[18] = "";
+
+      if (i < _scan.size())
+      {
+        const uint8_t* b = _scan[i].bssid;
+
+        snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X", b[0], b[1], b[2], b[3], b[4], b[5]);
+      }
+
+      return String(buf);
+    }
+
+    //////////////////////////////////////////
+    // Events
+
+    WiFiEventHandler onStationModeConnected(std::function<void(const WiFiEventStationModeConnected&)> f)
+    {
+      return addHandler(_onConnected, f);
+    }
+
+    WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> f)
+    {
+      return addHandler(_onGotIP, f);
+    }
+
+    WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected&)> f)
+    {
+      return addHandler(_onDisconnected, f);
+    }
+
+  private:
+
+    template<typename Event>
+    using Handlers = std::vector<std::weak_ptr<std::function<void(const Event&)>>>;
+
+    template<typename Event>
+    WiFiEventHandler addHandler(Handlers<Event>& handlers, std::function<void(const Event&)> f)
+    {
+      auto handler = std::make_shared<std::function<void(const Event&)>>(f);
+
+      handlers.push_back(handler);
+
+      return handler;
+    }
+
+    template<typename Event>
+    void emit(Handlers<Event>& handlers, const Event& event)
+    {
+      for (auto& weak : handlers)
+      {
+        if (auto handler = weak.lock())
+          (*handler)(event);
+      }
+    }
+
+    typedef enum
+    {
+      PENDING_NONE,
+      PENDING_ASSOCIATED,
+      PENDING_GOT_IP,
+      PENDING_FAILED,
+      PENDING_RETRY
+    } PendingStep;
+
+    static bool due(unsigned long at, unsigned long now)
+    {
+      return (long) (now - at) >= 0;
+    }
+
+    void schedule(PendingStep step, unsigned long at)
+    {
+      _pending    = step;
+      _pendingAt  = at;
+    }
+
+    WM_HostNetwork* findNetwork(int32_t channel, const uint8_t* bssid)
+    {
+      for (WM_HostNetwork& network : _networks)
+      {
+        if ( network.inRange && (network.ssid == _staConfig.ssid) && ( (channel == 0) || (network.channel == channel) ) &&
+             ( !bssid || (memcmp(network.bssid, bssid, 6) == 0) ) )
+        {
+          return &network;
+        }
+      }
+
+      return NULL;
+    }
+
+    // One attempt of the driver, started at the given time. Its result is then given by update().
+    void beginConnection(int32_t channel, const uint8_t* bssid, unsigned long at)
+    {
+      if (_associated)
+        disconnected(WIFI_DISCONNECT_REASON_ASSOC_LEAVE);
+
+      _mode       = (WiFiMode_t) (_mode | WIFI_STA);
+      _associated = false;
+      _status     = WL_DISCONNECTED;
+      _attempts++;
+
+      WM_HostNetwork* network = findNetwork(channel, bssid);
+
+      if (!network)
+      {
+        _failReason = WIFI_DISCONNECT_REASON_NO_AP_FOUND;
+        schedule(PENDING_FAILED, at + _noAPTime);
+      }
+      else if (network->pass != _staConfig.pass)
+      {
+        _failReason = WIFI_DISCONNECT_REASON_AUTH_FAIL;
+        schedule(PENDING_FAILED, at + network->associateTime);
+      }
+      else if ( network->failReason && (network->failCount != 0) )
+      {
+        if (network->failCount > 0)
+          network->failCount--;
+
+        _failReason = (WiFiDisconnectReason) network->failReason;
+        schedule(PENDING_FAILED, at + network->associateTime);
+      }
+      else
+      {
+        _network = *network;
+        schedule(PENDING_ASSOCIATED, at + network->associateTime);
+      }
+
+      update();
+    }
+
+    void runPending()
+    {
+      PendingStep   step  = _pending;
+      unsigned long at    = _pendingAt;
+
+      _pending = PENDING_NONE;
+
+      switch (step)
+      {
+        case PENDING_ASSOCIATED:
+        {
+          _associated = true;
+
+          WiFiEventStationModeConnected connected = { _network.ssid, {}, _network.channel };
+          memcpy(connected.bssid, _network.bssid, 6);
+          emit(_onConnected, connected);
+
+          if (_network.dhcpTime >= 0)
+            schedule(PENDING_GOT_IP, at + _network.dhcpTime);
+
+          break;
+        }
+
+        case PENDING_GOT_IP:
+          _status = WL_CONNECTED;
+
+          emit(_onGotIP, WiFiEventStationModeGotIP { localIP(), subnetMask(), gatewayIP() });
+          break;
+
+        case PENDING_FAILED:
+          _status = statusOfReason(_failReason);
+
+          disconnected(_failReason);
+
+          // The status of the failure is kept until the next attempt
+          if (_autoReconnect)
+            schedule(PENDING_RETRY, at + _reconnectTime);
+
+          break;
+
+        case PENDING_RETRY:
+          beginConnection(0, staBSSID(), at);
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    // As the station status of the SDK after the failure
+    static wl_status_t statusOfReason(WiFiDisconnectReason reason)
+    {
+      switch (reason)
+      {
+        case WIFI_DISCONNECT_REASON_NO_AP_FOUND:
+          return WL_NO_SSID_AVAIL;
+        case WIFI_DISCONNECT_REASON_AUTH_FAIL:
+        case WIFI_DISCONNECT_REASON_4WAY_HANDSHAKE_TIMEOUT:
+        case WIFI_DISCONNECT_REASON_HANDSHAKE_TIMEOUT:
+          return WL_WRONG_PASSWORD;
+        default:
+          return WL_CONNECT_FAILED;
+      }
+    }
+
+    void completeScan()
+    {
+      for (const WM_HostNetwork& network : _networks)
+      {
+        if ( network.inRange && (_scanShowHidden || !network.hidden) && ( (_scanChannel == 0) || (network.channel == _scanChannel) ) )
+        {
+          bss_info info = {};
+
+          memcpy(info.bssid, network.bssid, sizeof(info.bssid));
+
+          if (!network.hidden)
+          {
+            info.ssid_len = std::min((size_t) network.ssid.length(), sizeof(info.ssid));
+            memcpy(info.ssid, network.ssid.c_str(), info.ssid_len);
+          }
+
+          info.channel    = network.channel;
+          info.rssi       = network.rssi;
+          info.authmode   = network.encryption;
+          info.is_hidden  = network.hidden;
+
+          _scan.push_back(network);
+          _scanInfo.push_back(info);
+        }
+      }
+
+      _scanRunning  = false;
+      _scanDone     = true;
+    }
+
+    void stopStation(wl_status_t status)
+    {
+      if (_associated)
+        disconnected(WIFI_DISCONNECT_REASON_ASSOC_LEAVE);
+
+      _associated = false;
+      _pending    = PENDING_NONE;
+      _status     = status;
+    }
+
+    void disconnected(WiFiDisconnectReason reason)
+    {
+      WiFiEventStationModeDisconnected event = { _staConfig.ssid, {}, reason };
+
+      emit(_onDisconnected, event);
+    }
+
+    bool connected()
+    {
+      return _status == WL_CONNECTED;
+    }
+
+    const uint8_t* staBSSID()
+    {
+      return _staConfig.bssidSet ? _staConfig.bssid : NULL;
+    }
+
+    std::vector<WM_HostNetwork> _networks;
+    std::vector<WM_HostNetwork> _scan;
+    std::vector<bss_info>       _scanInfo;
+    bool            _scanDone       = false;
+    bool            _scanRunning    = false;
+    bool            _scanShowHidden = false;
+    uint8_t         _scanChannel    = 0;
+    unsigned long   _scanDoneAt     = 0;
+    uint32_t        _scanTime       = 0;
+    uint32_t        _scans          = 0;
+
+    WiFiMode_t      _mode           = WIFI_STA;
+    bool            _autoConnect    = true;
+    bool            _autoReconnect  = true;
+
+    String          _apSSID;
+    String          _apPass;
+    int             _apChannel      = 1;
+    IPAddress       _apIP           = IPAddress(192, 168, 4, 1);
+
+    wl_status_t     _status         = WL_DISCONNECTED;
+    WM_HostNetwork  _network        = {};
+    bool            _associated     = false;
+    String          _hostname;
+
+    WM_HostStationConfig  _staConfig;
+    WM_HostStationConfig  _savedConfig;
+    bool                  _persistent     = true;
+
+    PendingStep           _pending        = PENDING_NONE;
+    unsigned long         _pendingAt      = 0;
+    WiFiDisconnectReason  _failReason     = WIFI_DISCONNECT_REASON_UNSPECIFIED;
+    uint32_t              _attempts       = 0;
+    uint32_t              _noAPTime       = 0;
+    uint32_t              _reconnectTime  = 1000;
+
+    bool                  _dropPending    = false;
+    unsigned long         _dropAt         = 0;
+    WiFiDisconnectReason  _dropReason     = WIFI_DISCONNECT_REASON_BEACON_TIMEOUT;
+
+    IPAddress       _staticIP;
+    IPAddress       _gateway;
+    IPAddress       _subnet;
+    IPAddress       _dns1;
+    IPAddress       _dns2;
+
+    Handlers<WiFiEventStationModeConnected>     _onConnected;
+    Handlers<WiFiEventStationModeGotIP>         _onGotIP;
+    Handlers<WiFiEventStationModeDisconnected>  _onDisconnected;
+};
+
+inline ESP8266WiFiClass WiFi;
+
+// The radio runs with the virtual clock
+inline const bool WM_HostRadioTick = ( WM_HostClock::onTick([]() { WiFi.update(); }), true );
+
+/////////////////////////////////////////////////////////////////////////////
+
+class EspClass
+{
+  public:
+
+    uint32_t getChipId()              { return 0x00C0FFEE; }
+    uint32_t getFlashChipId()         { return 0x001640EF; }
+    uint32_t getFlashChipSize()       { return 4194304; }
+    uint32_t getFlashChipRealSize()   { return 4194304; }
+    uint32_t getFreeHeap()            { return 40000; }
+    uint32_t getCycleCount()          { return micros() * 80; }
+
+    // The program ends, as the board would reboot
+    void restart()
+    {
+      Serial.println("ESP.restart()");
+      Serial.flush();
+
+      exit(0);
+    }
+
+    void reset()
+    {
+      restart();
+    }
+
+    bool rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size)
+    {
+      if (offset * 4 + size > sizeof(_rtcUserMemory))
+        return false;
+
+      memcpy(data, _rtcUserMemory + offset * 4, size);
+
+      return true;
+    }
+
+    bool rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size)
+    {
+      if (offset * 4 + size > sizeof(_rtcUserMemory))
+        return false;
+
+      memcpy(_rtcUserMemory + offset * 4, data, size);
+
+      return true;
+    }
+
+    // Power on : the RTC user memory is lost, unlike at ESP.restart() or a wake up from deep sleep
+    void powerOn()
+    {
+      memset(_rtcUserMemory, 0, sizeof(_rtcUserMemory));
+    }
+
+  private:
+
+    uint8_t _rtcUserMemory[512] = {};
+};
+
+inline EspClass ESP;
@@ -0,0 +1,96 @@
+/****************************************************************************************************************************
+  IPAddress.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : IPv4 address, stored in network order as on the ESP cores.
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+class IPAddress : public Printable
+{
+  public:
+
+    IPAddress() {}
+
+    IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth)
+    {
+      _bytes[0] = first;
+      _bytes[1] = second;
+      _bytes[2] = third;
+      _bytes[3] = fourth;
+    }
+
+    IPAddress(uint32_t address)
+    {
+      memcpy(_bytes, &address, sizeof(_bytes));
+    }
+
+    operator uint32_t() const
+    {
+      uint32_t address;
+
+      memcpy(&address, _bytes, sizeof(address));
+
+      return address;
+    }
+
+    bool operator==(const IPAddress& other) const   { return (uint32_t) *this == (uint32_t) other; }
+    bool operator!=(const IPAddress& other) const   { return !(*this == other); }
+
+    uint8_t  operator[](int index) const  { return _bytes[index]; }
+    uint8_t& operator[](int index)        { return _bytes[index]; }
+
+    bool isSet() const
+    {
+      return (uint32_t) *this != 0;
+    }
+
+    bool fromString(const char* address)
+    {
+      unsigned int  b[4];
+      char          tail;
+
+      if ( !address || (sscanf(address, "%u.%u.%u.%u%c", &b[0], &b[1], &b[2], &b[3], &tail) != 4) )
+        return false;
+
+      for (int i = 0; i < 4; i++)
+      {
+        if (b[i] > 255)
+          return false;
+
+        _bytes[i] = b[i];
+      }
+
+      return true;
+    }
+
+    bool fromString(const String& address)
+    {
+      return fromString(address.c_str());
+    }
+
+    String toString() const
+    {
+      char buf[16];
+
+      snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+
+      return String(buf);
+    }
+
+    size_t printTo(Print& p) const override
+    {
+      return p.print(toString());
+    }
+
+  private:
+
+    uint8_t _bytes[4] = { 0, 0, 0, 0 };
+};
+
+#define INADDR_NONE     IPAddress(0, 0, 0, 0)
@@ -0,0 +1,232 @@
+/****************************************************************************************************************************
+  WM_PosixDNSServer.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : captive portal DNS responder over a POSIX UDP socket, with the API of
+  DNSServer used by the library. Given to the library with -DWM_DNS_SERVER_TYPE=WM_PosixDNSServer.
+
+  As DNSServer of the cores, the A queries for the domain ( any domain for "*" ) are answered with the given IP, the
+  other queries with the error reply code. processNextRequest() handles one datagram per call. As WM_PosixWebServer,
+  setPortOverride(0) makes it listen on a free port, read back with boundPort().
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include "Arduino.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum class DNSReplyCode
+{
+  NoError           = 0,
+  FormError         = 1,
+  ServerFailure     = 2,
+  NonExistentDomain = 3,
+  NotImplemented    = 4,
+  Refused           = 5
+};
+
+class WM_PosixDNSServer
+{
+  public:
+
+    ~WM_PosixDNSServer()
+    {
+      stop();
+    }
+
+    // For the servers started from now on, instead of the port of the library. 0 for a free port, -1 for none.
+    static void setPortOverride(int port)
+    {
+      _portOverride = port;
+    }
+
+    // Of the last start(), 0 if it failed
+    static uint16_t boundPort()
+    {
+      return _boundPort;
+    }
+
+    void setErrorReplyCode(const DNSReplyCode& replyCode)
+    {
+      _errorReplyCode = replyCode;
+    }
+
+    void setTTL(const uint32_t& ttl)
+    {
+      _ttl = ttl;
+    }
+
+    bool start(const uint16_t& port, const String& domainName, const IPAddress& resolvedIP)
+    {
+      stop();
+
+      _domainName = domainName;
+      _domainName.toLowerCase();
+      _resolvedIP = resolvedIP;
+      _fd         = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+      _boundPort  = 0;
+
+      if (_fd < 0)
+        return false;
+
+      int         on          = 1;
+      int         listenPort  = (_portOverride >= 0) ? _portOverride : port;
+      sockaddr_in addr        = {};
+
+      addr.sin_family       = AF_INET;
+      addr.sin_port         = htons(listenPort);
+      addr.sin_addr.s_addr  = htonl(INADDR_ANY);
+
+      // A restarted portal gets its port back at once, and 5353 is shared with an mDNS responder setting it as well
+      setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+      if (bind(_fd, (sockaddr*) &addr, sizeof(addr)) != 0)
+      {
+        Serial.printf("WM_PosixDNSServer : can't listen on port %d : %s\n", listenPort, strerror(errno));
+
+        stop();
+        return false;
+      }
+
+      socklen_t length = sizeof(addr);
+
+      if (getsockname(_fd, (sockaddr*) &addr, &length) == 0)
+        _boundPort = ntohs(addr.sin_port);
+
+      return true;
+    }
+
+    void stop()
+    {
+      if (_fd >= 0)
+      {
+        ::close(_fd);
+        _fd = -1;
+      }
+    }
+
+    void processNextRequest()
+    {
+      if (_fd < 0)
+        return;
+
+      uint8_t     packet[DNS_MAX_PACKET];
+      sockaddr_in from    = {};
+      socklen_t   length  = sizeof(from);
+      ssize_t     size    = recvfrom(_fd, packet, sizeof(packet) - DNS_ANSWER_SIZE, 0, (sockaddr*) &from, &length);
+
+      if (size < DNS_HEADER_SIZE)
+        return;
+
+      size = reply(packet, size);
+
+      if (size > 0)
+        sendto(_fd, packet, size, 0, (sockaddr*) &from, length);
+    }
+
+  private:
+
+    static const int    DNS_HEADER_SIZE   = 12;
+    static const int    DNS_ANSWER_SIZE   = 16;
+    static const int    DNS_MAX_PACKET    = 512;
+
+    static inline int       _portOverride = -1;
+    static inline uint16_t  _boundPort    = 0;
+
+    int           _fd             = -1;
+    uint32_t      _ttl            = 60;
+    DNSReplyCode  _errorReplyCode = DNSReplyCode::NonExistentDomain;
+    String        _domainName;
+    IPAddress     _resolvedIP;
+
+    // Turns the query in packet into its reply, in place. Size of the reply, 0 for none.
+    ssize_t reply(uint8_t* packet, ssize_t size)
+    {
+      bool      query     = !(packet[2] & 0x80);
+      uint8_t   opcode    = (packet[2] >> 3) & 0x0F;
+      uint16_t  qdCount   = (packet[4] << 8) | packet[5];
+      uint16_t  otherRRs  = packet[6] | packet[7] | packet[8] | packet[9];
+
+      // Replies, and whatever else, are ignored
+      if (!query)
+        return 0;
+
+      // QR = 1, opcode and RD kept, RA = 1. The additional records ( EDNS ) are not answered.
+      packet[2]   = (packet[2] & 0x79) | 0x80;
+      packet[3]   = 0x80;
+      packet[10]  = 0;
+      packet[11]  = 0;
+
+      String    name;
+      ssize_t   pos       = DNS_HEADER_SIZE;
+
+      if ( (opcode == 0) && (qdCount == 1) && (otherRRs == 0) && readName(packet, size, pos, name) && (pos + 4 <= size) )
+      {
+        uint16_t qType  = (packet[pos] << 8) | packet[pos + 1];
+        uint16_t qClass = (packet[pos + 2] << 8) | packet[pos + 3];
+
+        pos += 4;
+
+        if ( (qType == 1) && (qClass == 1) && ( (_domainName == "*") || (name == _domainName) ) )
+        {
+          uint8_t* answer = packet + pos;
+
+          // Pointer to the name of the question, type A, class IN, TTL, 4 bytes of address
+          const uint8_t head[] = { 0xC0, 0x0C, 0x00, 0x01, 0x00, 0x01,
+                                   (uint8_t) (_ttl >> 24), (uint8_t) (_ttl >> 16), (uint8_t) (_ttl >> 8), (uint8_t) _ttl,
+                                   0x00, 0x04 };
+
+          memcpy(answer, head, sizeof(head));
+
+          for (int i = 0; i < 4; i++)
+            answer[sizeof(head) + i] = _resolvedIP[i];
+
+          packet[7] = 1;            // ANCOUNT
+
+          return pos + DNS_ANSWER_SIZE;
+        }
+
+        packet[3] |= (uint8_t) _errorReplyCode;
+
+        return pos;
+      }
+
+      // No question kept
+      packet[3] |= (uint8_t) ( (opcode == 0) ? DNSReplyCode::FormError : DNSReplyCode::NotImplemented );
+      memset(packet + 4, 0, 8);
+
+      return DNS_HEADER_SIZE;
+    }
+
+    // Lower-cased dotted name of the question. False if malformed, compression is not expected in a query.
+    static bool readName(const uint8_t* packet, ssize_t size, ssize_t& pos, String& name)
+    {
+      while (pos < size)
+      {
+        uint8_t length = packet[pos++];
+
+        if (length == 0)
+          return true;
+
+        if ( (length & 0xC0) || (pos + length > size) )
+          return false;
+
+        if (name.length())
+          name += '.';
+
+        for (int i = 0; i < length; i++)
+          name += (char) tolower(packet[pos + i]);
+
+        pos += length;
+      }
+
+      return false;
+    }
+};
@@ -0,0 +1,810 @@
+/****************************************************************************************************************************
+  WM_PosixWebServer.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : HTTP server over POSIX TCP sockets, with the API of ESP8266WebServer
+  used by the library. Given to the library with -DWM_WEB_SERVER_TYPE=WM_PosixWebServer.
+
+  As the server of the cores, handleClient() serves one request per call and returns at once when none is pending.
+  Each connection carries one request and is closed after the response.
+
+  Without sockets, setRequest() and replay() run the handler of a given request and only count its response, for the
+  benchmarks of bench_host.cpp.
+
+  setPortOverride(0) makes the servers listen on a free port chosen by the system, read back with boundPort(), so that
+  the tests do not depend on WM_HTTP_PORT being free.
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include "ESP8266WiFi.h"
+
+#include <map>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN        ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET        ((size_t) -2)
+
+// Time given to a client to send its request, in ms, as HTTP_MAX_DATA_WAIT of the cores
+#ifndef WM_HOST_HTTP_READ_TIMEOUT_MS
+  #define WM_HOST_HTTP_READ_TIMEOUT_MS    5000
+#endif
+
+// Larger requests are answered with 413
+#ifndef WM_HOST_HTTP_MAX_REQUEST
+  #define WM_HOST_HTTP_MAX_REQUEST        16384
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+
+// The client of the request being handled, as WiFiClient for server->client()
+class WM_PosixClient
+{
+  public:
+
+    bool connected() const
+    {
+      return (_fd >= 0) || _capture;
+    }
+
+    // The writes are blocking, nothing is left to wait for
+    void flush()
+    {
+    }
+
+    void stop()
+    {
+      if (_fd >= 0)
+      {
+        ::shutdown(_fd, SHUT_WR);
+        ::close(_fd);
+        _fd = -1;
+      }
+    }
+
+    size_t write(const uint8_t* buffer, size_t size)
+    {
+      if (_capture)
+      {
+        _captured += size;
+        return size;
+      }
+
+      size_t sent = 0;
+
+      while ( (_fd >= 0) && (sent < size) )
+      {
+        ssize_t n = ::send(_fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+
+        if (n <= 0)
+        {
+          if ( (n < 0) && (errno == EINTR) )
+            continue;
+
+          // The client went away, the rest of the response is dropped as on the cores
+          stop();
+          break;
+        }
+
+        sent += n;
+      }
+
+      return sent;
+    }
+
+    size_t write(const char* buffer, size_t size)
+    {
+      return write((const uint8_t*) buffer, size);
+    }
+
+    IPAddress localIP() const
+    {
+      return address(false);
+    }
+
+    IPAddress remoteIP() const
+    {
+      return address(true);
+    }
+
+    void setNoDelay(bool noDelay)
+    {
+      int on = noDelay;
+
+      if (_fd >= 0)
+        setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+
+  private:
+
+    friend class WM_PosixWebServer;
+
+    int     _fd       = -1;
+
+    // Replay of the server : counted, not sent, from a client of the soft AP
+    bool    _capture  = false;
+    size_t  _captured = 0;
+
+    IPAddress address(bool remote) const
+    {
+      if (_capture)
+        return remote ? IPAddress(192, 168, 4, 2) : IPAddress(192, 168, 4, 1);
+
+      sockaddr_in addr      = {};
+      socklen_t   length    = sizeof(addr);
+
+      if ( (_fd < 0) || ( (remote ? getpeername(_fd, (sockaddr*) &addr, &length) :
+                                    getsockname(_fd, (sockaddr*) &addr, &length)) != 0 ) )
+      {
+        return IPAddress();
+      }
+
+      return IPAddress((uint32_t) addr.sin_addr.s_addr);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////
+
+class WM_PosixWebServer
+{
+  public:
+
+    typedef std::function<void(void)> THandlerFunction;
+
+    WM_PosixWebServer(int port = 80) : _port(port) {}
+
+    // For the servers begun from now on, instead of the port of the library. 0 for a free port, -1 for none.
+    static void setPortOverride(int port)
+    {
+      _portOverride = port;
+    }
+
+    // Of the last begin(), 0 if it failed
+    static uint16_t boundPort()
+    {
+      return _boundPort;
+    }
+
+    ~WM_PosixWebServer()
+    {
+      close();
+    }
+
+    void begin()
+    {
+      begin(_port);
+    }
+
+    void begin(uint16_t port)
+    {
+      close();
+
+      _port       = (_portOverride >= 0) ? _portOverride : port;
+      _listenFd   = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+      _boundPort  = 0;
+
+      if (_listenFd < 0)
+        return;
+
+      int         on    = 1;
+      sockaddr_in addr  = {};
+
+      addr.sin_family       = AF_INET;
+      addr.sin_port         = htons(_port);
+      addr.sin_addr.s_addr  = htonl(INADDR_ANY);
+
+      setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+      if ( (bind(_listenFd, (sockaddr*) &addr, sizeof(addr)) != 0) || (listen(_listenFd, 16) != 0) )
+      {
+        Serial.printf("WM_PosixWebServer : can't listen on port %d : %s\n", _port, strerror(errno));
+
+        ::close(_listenFd);
+        _listenFd = -1;
+
+        return;
+      }
+
+      socklen_t length = sizeof(addr);
+
+      if (getsockname(_listenFd, (sockaddr*) &addr, &length) == 0)
+        _boundPort = ntohs(addr.sin_port);
+    }
+
+    void close()
+    {
+      _client.stop();
+
+      if (_listenFd >= 0)
+      {
+        ::close(_listenFd);
+        _listenFd = -1;
+      }
+    }
+
+    void stop()
+    {
+      close();
+    }
+
+    bool listening() const
+    {
+      return _listenFd >= 0;
+    }
+
+    //////////////////////////////////////////
+
+    void on(const String& uri, THandlerFunction handler)
+    {
+      on(uri, HTTP_ANY, handler);
+    }
+
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler)
+    {
+      _handlers.push_back( { uri, method, handler } );
+    }
+
+    void onNotFound(THandlerFunction handler)
+    {
+      _notFoundHandler = handler;
+    }
+
+    // Headers to keep, besides Host. The others are dropped, as on the cores.
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount)
+    {
+      _collectedHeaders.assign(headerKeys, headerKeys + headerKeysCount);
+    }
+
+    //////////////////////////////////////////
+
+    void handleClient()
+    {
+      if (_listenFd < 0)
+        return;
+
+      int fd = accept4(_listenFd, NULL, NULL, SOCK_CLOEXEC);
+
+      if (fd < 0)
+        return;
+
+      timeval sendTimeout = { WM_HOST_HTTP_READ_TIMEOUT_MS / 1000, (WM_HOST_HTTP_READ_TIMEOUT_MS % 1000) * 1000 };
+
+      setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+
+      _client._fd = fd;
+
+      resetRequest();
+
+      int status = readRequest();
+
+      if (status != 200)
+        sendError(status);
+      else
+        dispatch();
+
+      finishResponse();
+
+      _client.stop();
+    }
+
+    //////////////////////////////////////////
+    // Replay : the request is set once, then each replay() runs its handler as handleClient() would. The status line
+    // and the headers of the response are not built, the handler is what is measured.
+
+    void setRequest(HTTPMethod method, const String& uri, const std::vector<std::pair<String, String>>& args,
+                    const String& hostHeader = "192.168.4.1")
+    {
+      resetRequest();
+
+      _method     = method;
+      _uri        = uri;
+      _args       = args;
+      _hostHeader = hostHeader;
+    }
+
+    // Bytes of the response, without the status line and the headers
+    size_t replay()
+    {
+      _contentLength    = CONTENT_LENGTH_NOT_SET;
+      _responseHeaders  = "";
+      _headSent         = false;
+      _chunked          = false;
+
+      _client._capture  = true;
+      _client._captured = 0;
+
+      dispatch();
+      finishResponse();
+
+      _client._capture  = false;
+
+      return _client._captured;
+    }
+
+    //////////////////////////////////////////
+    // Request
+
+    String      uri()                 { return _uri; }
+    HTTPMethod  method()              { return _method; }
+    String      hostHeader()          { return _hostHeader; }
+    WM_PosixClient& client()          { return _client; }
+
+    int args()
+    {
+      return _args.size();
+    }
+
+    String arg(int i)
+    {
+      return (i >= 0) && (i < (int) _args.size()) ? _args[i].second : String();
+    }
+
+    String argName(int i)
+    {
+      return (i >= 0) && (i < (int) _args.size()) ? _args[i].first : String();
+    }
+
+    String arg(const String& name)
+    {
+      for (const auto& a : _args)
+      {
+        if (a.first == name)
+          return a.second;
+      }
+
+      return String();
+    }
+
+    bool hasArg(const String& name)
+    {
+      for (const auto& a : _args)
+      {
+        if (a.first == name)
+          return true;
+      }
+
+      return false;
+    }
+
+    String header(const String& name)
+    {
+      for (const auto& h : _headers)
+      {
+        if (h.first.equalsIgnoreCase(name))
+          return h.second;
+      }
+
+      return String();
+    }
+
+    bool hasHeader(const String& name)
+    {
+      for (const auto& h : _headers)
+      {
+        if (h.first.equalsIgnoreCase(name))
+          return true;
+      }
+
+      return false;
+    }
+
+    //////////////////////////////////////////
+    // Response
+
+    void setContentLength(const size_t contentLength)
+    {
+      _contentLength = contentLength;
+    }
+
+    void sendHeader(const String& name, const String& value, bool first = false)
+    {
+      String line = name + ": " + value + "\r\n";
+
+      if (first)
+        _responseHeaders = line + _responseHeaders;
+      else
+        _responseHeaders += line;
+    }
+
+    void send(int code, const String& contentType, const String& content)
+    {
+      sendHead(code, contentType.c_str(), content.length());
+
+      if (content.length())
+        sendContent(content.c_str(), content.length());
+    }
+
+    void send(int code, const char* contentType = NULL, const String& content = String())
+    {
+      send(code, String(contentType), content);
+    }
+
+    void send(int code, const char* contentType, const char* content)
+    {
+      send(code, String(contentType), String(content));
+    }
+
+    void send_P(int code, PGM_P contentType, PGM_P content)
+    {
+      send(code, contentType, content);
+    }
+
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength)
+    {
+      sendHead(code, contentType, contentLength);
+      sendContent(content, contentLength);
+    }
+
+    void sendContent(const String& content)
+    {
+      sendContent(content.c_str(), content.length());
+    }
+
+    // In chunked mode, an empty content is the last chunk
+    void sendContent(const char* content, size_t size)
+    {
+      if (_chunked)
+      {
+        char head[12];
+        int  len = snprintf(head, sizeof(head), "%zx\r\n", size);
+
+        _client.write(head, len);
+
+        if (size)
+          _client.write(content, size);
+
+        _client.write("\r\n", 2);
+
+        if (size == 0)
+          _chunked = false;
+      }
+      else if (size)
+      {
+        _client.write(content, size);
+      }
+    }
+
+    void sendContent_P(PGM_P content)
+    {
+      sendContent(content, strlen(content));
+    }
+
+    void sendContent_P(PGM_P content, size_t size)
+    {
+      sendContent(content, size);
+    }
+
+  private:
+
+    typedef struct
+    {
+      String            _uri;
+      HTTPMethod        _method;
+      THandlerFunction  _fn;
+    } Handler;
+
+    static inline int       _portOverride = -1;
+    static inline uint16_t  _boundPort    = 0;
+
+    int               _port;
+    int               _listenFd         = -1;
+    WM_PosixClient    _client;
+
+    std::vector<Handler>  _handlers;
+    THandlerFunction      _notFoundHandler;
+    std::vector<String>   _collectedHeaders;
+
+    // Current request
+    HTTPMethod        _method           = HTTP_GET;
+    String            _uri;
+    bool              _http11           = true;
+    String            _hostHeader;
+    std::vector<std::pair<String, String>>  _args;
+    std::vector<std::pair<String, String>>  _headers;
+
+    // Current response
+    size_t            _contentLength    = CONTENT_LENGTH_NOT_SET;
+    String            _responseHeaders;
+    bool              _headSent         = false;
+    bool              _chunked          = false;
+
+    //////////////////////////////////////////
+
+    void resetRequest()
+    {
+      _method           = HTTP_GET;
+      _uri              = "";
+      _http11           = true;
+      _hostHeader       = "";
+      _args.clear();
+      _headers.clear();
+
+      _contentLength    = CONTENT_LENGTH_NOT_SET;
+      _responseHeaders  = "";
+      _headSent         = false;
+      _chunked          = false;
+    }
+
+    // Appends what the client sent within the time left. False on timeout or close.
+    bool receive(std::string& buffer, unsigned long deadline)
+    {
+      char chunk[1024];
+
+      while (true)
+      {
+        long left = (long) (deadline - millis());
+
+        if (left <= 0)
+          return false;
+
+        pollfd pfd = { _client._fd, POLLIN, 0 };
+
+        int ready = poll(&pfd, 1, left);
+
+        if (ready < 0 && errno == EINTR)
+          continue;
+
+        if (ready <= 0)
+          return false;
+
+        ssize_t n = recv(_client._fd, chunk, sizeof(chunk), 0);
+
+        if (n < 0 && errno == EINTR)
+          continue;
+
+        if (n <= 0)
+          return false;
+
+        buffer.append(chunk, n);
+
+        return true;
+      }
+    }
+
+    // HTTP status of the parsing, 200 when the request can be handled
+    int readRequest()
+    {
+      std::string   buffer;
+      size_t        headEnd;
+      unsigned long deadline = millis() + WM_HOST_HTTP_READ_TIMEOUT_MS;
+
+      while ( (headEnd = buffer.find("\r\n\r\n")) == std::string::npos )
+      {
+        if (buffer.size() > WM_HOST_HTTP_MAX_REQUEST)
+          return 431;
+
+        if (!receive(buffer, deadline))
+          return buffer.empty() ? 0 : 408;
+      }
+
+      // Request line
+      size_t      lineEnd = buffer.find("\r\n");
+      std::string line    = buffer.substr(0, lineEnd);
+      size_t      sp1     = line.find(' ');
+      size_t      sp2     = line.rfind(' ');
+
+      if ( (sp1 == std::string::npos) || (sp2 == sp1) )
+        return 400;
+
+      std::string method  = line.substr(0, sp1);
+      std::string target  = line.substr(sp1 + 1, sp2 - sp1 - 1);
+
+      _http11 = (line.compare(sp2 + 1, std::string::npos, "HTTP/1.0") != 0);
+
+      if      (method == "GET")     _method = HTTP_GET;
+      else if (method == "HEAD")    _method = HTTP_HEAD;
+      else if (method == "POST")    _method = HTTP_POST;
+      else if (method == "PUT")     _method = HTTP_PUT;
+      else if (method == "PATCH")   _method = HTTP_PATCH;
+      else if (method == "DELETE")  _method = HTTP_DELETE;
+      else if (method == "OPTIONS") _method = HTTP_OPTIONS;
+      else
+        return 501;
+
+      size_t query = target.find('?');
+
+      _uri = urlDecode(target.substr(0, query), false).c_str();
+
+      if (query != std::string::npos)
+        parseArgs(target.substr(query + 1));
+
+      // Headers
+      size_t contentLength = 0;
+      bool   formBody      = false;
+
+      for (size_t pos = lineEnd + 2; pos < headEnd; )
+      {
+        size_t      end   = buffer.find("\r\n", pos);
+        std::string field = buffer.substr(pos, end - pos);
+        size_t      colon = field.find(':');
+
+        pos = end + 2;
+
+        if (colon == std::string::npos)
+          return 400;
+
+        String name   = field.substr(0, colon).c_str();
+        String value  = field.substr(colon + 1).c_str();
+
+        value.trim();
+
+        if (name.equalsIgnoreCase("Host"))
+          _hostHeader = value;
+        else if (name.equalsIgnoreCase("Content-Length"))
+          contentLength = strtoul(value.c_str(), NULL, 10);
+        else if (name.equalsIgnoreCase("Content-Type"))
+          formBody = value.startsWith("application/x-www-form-urlencoded");
+
+        for (const String& key : _collectedHeaders)
+        {
+          if (name.equalsIgnoreCase(key))
+            _headers.push_back( { key, value } );
+        }
+      }
+
+      // Body
+      if (contentLength > WM_HOST_HTTP_MAX_REQUEST)
+        return 413;
+
+      std::string body = buffer.substr(headEnd + 4);
+
+      while (body.size() < contentLength)
+      {
+        if (!receive(body, deadline))
+          return 408;
+      }
+
+      body.resize(contentLength);
+
+      if (formBody)
+        parseArgs(body);
+      else if (contentLength)
+        _args.push_back( { "plain", body.c_str() } );
+
+      return 200;
+    }
+
+    void parseArgs(const std::string& query)
+    {
+      for (size_t pos = 0; pos <= query.size(); )
+      {
+        size_t end = query.find('&', pos);
+
+        if (end == std::string::npos)
+          end = query.size();
+
+        std::string pair  = query.substr(pos, end - pos);
+        size_t      equal = pair.find('=');
+
+        if (!pair.empty())
+        {
+          String name   = urlDecode(pair.substr(0, equal), true).c_str();
+          String value  = (equal == std::string::npos) ? String() : String(urlDecode(pair.substr(equal + 1), true));
+
+          _args.push_back( { name, value } );
+        }
+
+        pos = end + 1;
+      }
+    }
+
+    static std::string urlDecode(const std::string& text, bool plusIsSpace)
+    {
+      std::string decoded;
+
+      for (size_t i = 0; i < text.size(); i++)
+      {
+        char c = text[i];
+
+        if ( (c == '%') && (i + 2 < text.size()) && isxdigit((unsigned char) text[i + 1]) && isxdigit((unsigned char) text[i + 2]) )
+        {
+          decoded += (char) strtol(text.substr(i + 1, 2).c_str(), NULL, 16);
+          i += 2;
+        }
+        else
+        {
+          decoded += (plusIsSpace && (c == '+')) ? ' ' : c;
+        }
+      }
+
+      return decoded;
+    }
+
+    void dispatch()
+    {
+      for (const Handler& handler : _handlers)
+      {
+        if ( (handler._uri == _uri) && ( (handler._method == HTTP_ANY) || (handler._method == _method) ) )
+        {
+          handler._fn();
+          return;
+        }
+      }
+
+      if (_notFoundHandler)
+        _notFoundHandler();
+      else
+        send(404, "text/plain", String("Not found: ") + _uri);
+    }
+
+    void sendError(int code)
+    {
+      // Nothing was received : the client connected and left
+      if (code == 0)
+        return;
+
+      send(code, "text/plain", String(statusText(code)));
+    }
+
+    void sendHead(int code, const char* contentType, size_t contentLength)
+    {
+      if (_headSent)
+        return;
+
+      if (_contentLength == CONTENT_LENGTH_NOT_SET)
+        _contentLength = contentLength;
+
+      if (!_client._capture)
+      {
+        String head = String("HTTP/1.") + (_http11 ? "1 " : "0 ") + String(code) + " " + statusText(code) + "\r\n";
+
+        head += String("Content-Type: ") + ( (contentType && *contentType) ? contentType : "text/html" ) + "\r\n";
+
+        if (_contentLength != CONTENT_LENGTH_UNKNOWN)
+          head += String("Content-Length: ") + String((unsigned long) _contentLength) + "\r\n";
+        else if (_http11)
+          head += "Transfer-Encoding: chunked\r\n";
+
+        head += _responseHeaders;
+        head += "Connection: close\r\n\r\n";
+
+        _client.write(head.c_str(), head.length());
+      }
+
+      _headSent = true;
+      _chunked  = _http11 && (_contentLength == CONTENT_LENGTH_UNKNOWN);
+    }
+
+    void finishResponse()
+    {
+      if (!_headSent)
+        send(500, "text/plain", "No response");
+
+      // The handler did not send the last chunk
+      if (_chunked)
+        sendContent("", 0);
+    }
+
+    static const char* statusText(int code)
+    {
+      switch (code)
+      {
+        case 200: return "OK";
+        case 202: return "Accepted";
+        case 204: return "No Content";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 408: return "Request Timeout";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        default:  return "";
+      }
+    }
+};
@@ -0,0 +1,452 @@
+/****************************************************************************************************************************
+  bench_host.cpp
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : microbenchmarks of the code run for each Config Portal request. The
+  page handlers are replayed through the capture mode of WM_PosixWebServer, without sockets, and the helpers are called
+  directly ( WM_HostBench is a friend of ESP_WiFiManager in the host build, WM_HOST_BUILD ).
+
+  One JSON line per benchmark and configuration : the ns, the heap allocations and the bytes allocated per operation,
+  and the bytes of the response. The allocations are counted in malloc(), calloc() and realloc(), which also serve
+  new. Compare the lines of two commits, the host only tells what changed, not the time on the board.
+
+  Usage : bench_host [ -t min ms per benchmark ] [ benchmark name ... ]
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#include <ESP_WiFiManager.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// Allocation counting, on top of the allocator of glibc. The benchmarks run in one thread.
+
+extern "C"
+{
+  void* __libc_malloc(size_t size);
+  void* __libc_calloc(size_t count, size_t size);
+  void* __libc_realloc(void* ptr, size_t size);
+  void  __libc_free(void* ptr);
+}
+
+static uint64_t allocCount;
+static uint64_t allocBytes;
+
+extern "C" void* malloc(size_t size)
+{
+  allocCount++;
+  allocBytes += size;
+
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+  allocCount++;
+  allocBytes += count * size;
+
+  return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+  allocCount++;
+  allocBytes += size;
+
+  return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void* ptr)
+{
+  __libc_free(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+static unsigned long            minTime = 200;
+static std::vector<const char*>  names;
+
+class WM_HostBench
+{
+  public:
+
+    // Runs op until minTime is reached. The first call, which may fill caches and reserve, is not counted.
+    template<typename Op>
+    static void measure(const char* name, const String& config, Op op)
+    {
+      if (!selected(name))
+        return;
+
+      size_t response = op();
+
+      uint64_t  ops = 1;
+      double    elapsed;
+      uint64_t  count;
+      uint64_t  bytes;
+
+      while (true)
+      {
+        count = allocCount;
+        bytes = allocBytes;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < ops; i++)
+          response = op();
+
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        count   = allocCount - count;
+        bytes   = allocBytes - bytes;
+
+        if ( (elapsed >= minTime * 1e6) || (ops >= (1ULL << 32)) )
+          break;
+
+        // Aim past minTime at once from a measure long enough to trust
+        ops = (elapsed > 1e6) ? (uint64_t) (ops * 1.2 * minTime * 1e6 / elapsed) + 1 : ops * 10;
+      }
+
+      printf("{\"name\":\"%s\",\"config\":\"%s\",\"ops\":%llu,\"ns_per_op\":%.1f,\"allocs_per_op\":%.2f,"
+             "\"bytes_per_op\":%.1f,\"response_bytes\":%zu}\n", name, config.c_str(), (unsigned long long) ops,
+             elapsed / ops, (double) count / ops, (double) bytes / ops, response);
+      fflush(stdout);
+    }
+
+    static WM_WebServer& server(ESP_WiFiManager& wm)
+    {
+      return *wm.server;
+    }
+
+    static size_t processScanResults(ESP_WiFiManager& wm, int n)
+    {
+      int*    indices;
+      int     kept = wm.processScanResults(n, &indices);
+
+      if (kept > 0)
+        free(indices);
+
+      return kept;
+    }
+
+    static size_t getRFC952_hostname(ESP_WiFiManager& wm, const char* name)
+    {
+      return strlen(wm.getRFC952_hostname(name));
+    }
+
+    static size_t isIp(ESP_WiFiManager& wm, const String& str)
+    {
+      return wm.isIp(str);
+    }
+
+    static size_t toStringIp(ESP_WiFiManager& wm, const IPAddress& ip)
+    {
+      return wm.toStringIp(ip).length();
+    }
+
+    static size_t pageTemplate_P(ESP_WiFiManager& wm, PGM_P pageTemplate, const WM_TemplateSlot* slots, uint8_t numSlots)
+    {
+      wm.pageTemplate_P(pageTemplate, slots, numSlots);
+
+      return takePage(wm);
+    }
+
+    static size_t pageContent(ESP_WiFiManager& wm, const String& content)
+    {
+      wm.pageContent(content);
+
+      return takePage(wm);
+    }
+
+  private:
+
+    // What was written to the page since the last call, dropped instead of sent
+    static size_t takePage(ESP_WiFiManager& wm)
+    {
+#if USE_CHUNKED_PORTAL_PAGES
+      size_t length = wm._pageChunkLen;
+
+      wm._pageChunkLen = 0;
+#else
+      size_t length = wm._page.length();
+
+      wm._page = "";
+#endif
+
+      return length;
+    }
+
+    static bool selected(const char* name)
+    {
+      for (const char* selected : names)
+      {
+        if (strcmp(selected, name) == 0)
+          return true;
+      }
+
+      return names.empty();
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Setup : networks in range, and the portal with its parameters
+
+// numAPs BSSIDs, two per SSID, RSSI spread and shuffled as a scan returns them
+static void addNetworks(int numAPs)
+{
+  uint32_t seed = 12345;
+
+  WiFi.clearNetworks();
+
+  for (int i = 0; i < numAPs; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+
+    char ssid[33];
+
+    snprintf(ssid, sizeof(ssid), "Network-%03d %s", i / 2, (i & 4) ? "Guest" : "Home");
+
+    WM_HostNetwork network = { ssid, "password123", -30 - (int32_t) ((seed >> 16) % 65), (uint8_t) (1 + i % 11),
+                               (i % 5) ? ENC_TYPE_CCMP : ENC_TYPE_NONE, { 0x02, 0x00, 0x00, 0x00, (uint8_t) (i >> 8), (uint8_t) i }, false };
+
+    WiFi.addNetwork(network);
+  }
+}
+
+static std::vector<std::unique_ptr<ESP_WMParameter>> parameters;
+
+static void addParameters(ESP_WiFiManager& wm, int numParams)
+{
+  for (int i = 0; i < numParams; i++)
+  {
+    char id[16];
+
+    snprintf(id, sizeof(id), "param%d", i);
+
+    parameters.emplace_back(new ESP_WMParameter(strdup(id), "Parameter of the sketch", "default value", 40));
+    wm.addParameter(parameters.back().get());
+  }
+}
+
+// A refresh only rescans once the results were served, those of the scan of the portal may not be yet
+static int refreshScan(ESP_WiFiManager& wm)
+{
+  const WM_ScanResult* results;
+
+  wm.getScanResults(&results);
+
+  return wm.getScanResults(&results, true);
+}
+
+static String config(const char* format, int a, int b = 0)
+{
+  char buf[64];
+
+  snprintf(buf, sizeof(buf), format, a, b);
+
+  return String(buf);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+static void benchPages()
+{
+  const int numAPs[]    = { 8, 20, 64 };
+  const int numParams[] = { 0, 4, 16 };
+
+  for (int params : numParams)
+  {
+    ESP_WiFiManager wm("Bench");
+
+    addParameters(wm, params);
+
+    // Results are not renewed during the measure
+    wm.setScanCacheTTL(0x7FFFFFFF);
+    wm.startConfigPortal("ESP_Bench", NULL, true);
+
+    WM_WebServer& server = WM_HostBench::server(wm);
+
+    for (int aps : numAPs)
+    {
+      addNetworks(aps);
+      refreshScan(wm);
+
+      server.setRequest(HTTP_GET, "/wifi", {});
+      WM_HostBench::measure("handleWifi", config("aps=%d,params=%d", aps, params), [&]() { return server.replay(); });
+    }
+
+    // The arguments of the form, with the static IP
+    std::vector<std::pair<String, String>> args =
+    {
+      { "s", "Network-001 Home" }, { "p", "password123" },
+      { "ip", "192.168.1.50" }, { "gw", "192.168.1.1" }, { "sn", "255.255.255.0" }
+    };
+
+    for (int i = 0; i < params; i++)
+      args.push_back( { parameters[parameters.size() - params + i]->getID(), "value of the sketch" } );
+
+    server.setRequest(HTTP_POST, "/wifisave", args);
+    WM_HostBench::measure("handleWifiSave", config("params=%d", params), [&]() { return server.replay(); });
+
+    wm.closeConfigPortal();
+    wm.process();
+  }
+}
+
+static void benchScan()
+{
+  const int numAPs[] = { 16, 64, 256 };
+
+  ESP_WiFiManager wm("Bench");
+
+  wm.setScanCacheTTL(0x7FFFFFFF);
+  wm.startConfigPortal("ESP_Bench", NULL, true);
+
+  WM_WebServer& server = WM_HostBench::server(wm);
+
+  for (int aps : numAPs)
+  {
+    addNetworks(aps);
+    refreshScan(wm);
+
+    server.setRequest(HTTP_GET, "/scan", {});
+    WM_HostBench::measure("handleScan", config("aps=%d", aps), [&]() { return server.replay(); });
+
+    // Sort and dedup of the results of a scan, the scan itself in scanWifiNetworks()
+    int n = WiFi.scanNetworks();
+
+    WM_HostBench::measure("processScanResults", config("aps=%d", aps), [&]() { return WM_HostBench::processScanResults(wm, n); });
+
+    WM_HostBench::measure("scanWifiNetworks", config("aps=%d", aps), [&]()
+    {
+      int*  indices;
+      int   kept = wm.scanWifiNetworks(&indices);
+
+      if (kept > 0)
+        free(indices);
+
+      return (size_t) kept;
+    });
+  }
+
+  wm.closeConfigPortal();
+  wm.process();
+}
+
+// One network of /wifi and one parameter of the form, rendered by pageTemplate_P() and, as the baseline, by the
+// String::replace() chain it replaced. Both end in the page buffer, the baseline through pageContent().
+static void benchTemplates()
+{
+  ESP_WiFiManager wm("Bench");
+  ESP_WMParameter param("mqtt_server", "MQTT server", "broker.example.com", 40);
+
+  const char* ssid    = "Network-001 Home";
+  const char* quality = "64";
+
+  WM_TemplateSlot itemSlots[] =
+  {
+    { "v", ssid,    WM_ESCAPE_HTML },
+    { "r", quality, WM_ESCAPE_NONE },
+    { "i", "l",     WM_ESCAPE_NONE }
+  };
+
+  WM_HostBench::measure("WM_HTTP_ITEM", "pageTemplate_P", [&]()
+  {
+    return WM_HostBench::pageTemplate_P(wm, WM_HTTP_ITEM, itemSlots, sizeof(itemSlots) / sizeof(itemSlots[0]));
+  });
+
+  WM_HostBench::measure("WM_HTTP_ITEM", "replace", [&]()
+  {
+    String item = FPSTR(WM_HTTP_ITEM);
+
+    item.replace("{v}", ssid);
+    item.replace("{r}", quality);
+    item.replace("{i}", "l");
+
+    return WM_HostBench::pageContent(wm, item);
+  });
+
+  char length[12];
+
+  snprintf(length, sizeof(length), "%d", param.getValueLength());
+
+  WM_TemplateSlot paramSlots[] =
+  {
+    { "i", param.getID(),           WM_ESCAPE_HTML },
+    { "n", param.getID(),           WM_ESCAPE_HTML },
+    { "p", param.getPlaceholder(),  WM_ESCAPE_HTML },
+    { "l", length,                  WM_ESCAPE_NONE },
+    { "v", param.getValue(),        WM_ESCAPE_HTML },
+    { "c", param.getCustomHTML(),   WM_ESCAPE_NONE }
+  };
+
+  const struct
+  {
+    const char* name;
+    PGM_P       pageTemplate;
+  } forms[] =
+  {
+    { "WM_HTTP_FORM_LABEL_BEFORE",  WM_HTTP_FORM_LABEL_BEFORE },
+    { "WM_HTTP_FORM_LABEL_AFTER",   WM_HTTP_FORM_LABEL_AFTER  },
+    { "WM_HTTP_FORM_PARAM",         WM_HTTP_FORM_PARAM        }
+  };
+
+  for (const auto& form : forms)
+  {
+    WM_HostBench::measure(form.name, "pageTemplate_P", [&]()
+    {
+      return WM_HostBench::pageTemplate_P(wm, form.pageTemplate, paramSlots, sizeof(paramSlots) / sizeof(paramSlots[0]));
+    });
+
+    WM_HostBench::measure(form.name, "replace", [&]()
+    {
+      String item = FPSTR(form.pageTemplate);
+
+      item.replace("{i}", param.getID());
+      item.replace("{n}", param.getID());
+      item.replace("{p}", param.getPlaceholder());
+      item.replace("{l}", length);
+      item.replace("{v}", param.getValue());
+      item.replace("{c}", param.getCustomHTML());
+
+      return WM_HostBench::pageContent(wm, item);
+    });
+  }
+}
+
+static void benchHelpers()
+{
+  ESP_WiFiManager wm("Bench");
+
+  const char* hostname = "Living Room Sensor #2 (ESP8266)";
+
+  WM_HostBench::measure("getRFC952_hostname", config("len=%d", strlen(hostname)), [&]()
+  {
+    return WM_HostBench::getRFC952_hostname(wm, hostname);
+  });
+
+  String ip     = "192.168.4.1";
+  String domain = "connectivitycheck.gstatic.com";
+
+  WM_HostBench::measure("isIp", "ip", [&]() { return WM_HostBench::isIp(wm, ip); });
+  WM_HostBench::measure("isIp", "domain", [&]() { return WM_HostBench::isIp(wm, domain); });
+
+  IPAddress softAPIP(192, 168, 4, 1);
+
+  WM_HostBench::measure("toStringIp", "192.168.4.1", [&]() { return WM_HostBench::toStringIp(wm, softAPIP); });
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if ( (strcmp(argv[i], "-t") == 0) && (i + 1 < argc) )
+      minTime = strtoul(argv[++i], NULL, 10);
+    else
+      names.push_back(argv[i]);
+  }
+
+  benchPages();
+  benchScan();
+  benchTemplates();
+  benchHelpers();
+
+  return 0;
+}
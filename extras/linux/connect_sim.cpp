@@ -0,0 +1,445 @@
+/****************************************************************************************************************************
+  connect_sim.cpp
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the connection logic of the library against the mock radio of
+  ESP8266WiFi.h, on the virtual clock of Arduino.h. Each scenario sets the networks in range, their association and
+  DHCP times and their failures, then runs autoConnect() or the Config Portal as a sketch would. The timeouts of
+  minutes of the library take the time of the board, virtual, and a few ms of the host.
+
+  One CSV line per scenario : the virtual ms to the IP ( -1 if none ) and to the end of the call, the association
+  attempts and the scans of the driver, and whether the result is within the bounds of the scenario. The bounds are
+  the regression check : the exit code is 1 if a scenario is outside of them.
+
+  Usage : connect_sim [ scenario name ... ]
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#include <ESP_WiFiManager.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define SIM_PORTAL_TIMEOUT_S      60
+
+typedef struct
+{
+  const char*     name;
+  const char*     description;
+  void            (*setup)(ESP_WiFiManager& wm);
+  bool            (*run)(ESP_WiFiManager& wm);
+  bool            connected;          // Expected result
+  unsigned long   maxTime;            // ms, to the IP if connected, to the end of the call otherwise
+} SimScenario;
+
+static unsigned long  measureFrom;
+static unsigned long  gotIPAt;
+static bool           gotIP;
+static IPAddress      gotIPGateway;
+static int            clientFd = -1;
+static const char*    saveRequest;
+
+/////////////////////////////////////////////////////////////////////////////
+// Networks
+
+static WM_HostNetwork homeNetwork(int channel = 6, uint8_t bssid = 1, int32_t rssi = -48)
+{
+  WM_HostNetwork network = { "HomeNetwork", "password123", rssi, (uint8_t) channel, ENC_TYPE_CCMP, { 0x02, 0x00, 0x00, 0x00, 0x00, bssid }, false };
+
+  network.associateTime = 800;
+  network.dhcpTime      = 400;
+
+  return network;
+}
+
+static WM_HostNetwork officeNetwork()
+{
+  WM_HostNetwork network = { "Office", "office-pass", -63, 1, ENC_TYPE_CCMP, { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 }, false };
+
+  network.associateTime = 1200;
+  network.dhcpTime      = 900;
+
+  return network;
+}
+
+// As stored by the driver from a previous connection
+static void saveCredentials(const char* ssid, const char* pass)
+{
+  WiFi.begin(ssid, pass, 0, NULL, false);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// A browser on the Config Portal, for the save of the form
+
+static void sendRequest(unsigned long bringUpTime)
+{
+  (void) bringUpTime;
+
+  sockaddr_in addr = {};
+
+  addr.sin_family       = AF_INET;
+  addr.sin_port         = htons(WM_PosixWebServer::boundPort());
+  addr.sin_addr.s_addr  = htonl(INADDR_LOOPBACK);
+
+  clientFd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+  // Loopback : the connection is queued on the listening socket at once, served by the next handleClient()
+  if ( (clientFd < 0) || (connect(clientFd, (sockaddr*) &addr, sizeof(addr)) != 0) )
+  {
+    Serial.printf("connect_sim : no portal on port %u\n", WM_PosixWebServer::boundPort());
+    return;
+  }
+
+  String request = String("GET ") + saveRequest + " HTTP/1.0\r\nHost: 192.168.4.1\r\n\r\n";
+
+  if (write(clientFd, request.c_str(), request.length()) < 0)
+    Serial.printf("connect_sim : request not sent\n");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Scenarios
+
+static bool runAutoConnect(ESP_WiFiManager& wm)
+{
+  return wm.autoConnect("ESP_Sim");
+}
+
+static void setupSaved(ESP_WiFiManager& wm)
+{
+  (void) wm;
+
+  WiFi.addNetwork(homeNetwork());
+  saveCredentials("HomeNetwork", "password123");
+}
+
+static void setupSlowDHCP(ESP_WiFiManager& wm)
+{
+  WM_HostNetwork network = homeNetwork();
+
+  (void) wm;
+
+  network.dhcpTime = 6000;
+
+  WiFi.addNetwork(network);
+  saveCredentials("HomeNetwork", "password123");
+}
+
+static void setupKnownOutOfRange(ESP_WiFiManager& wm)
+{
+  WM_HostNetwork network = homeNetwork();
+
+  network.inRange = false;
+
+  WiFi.addNetwork(network);
+  WiFi.addNetwork(officeNetwork());
+
+  wm.addCredential("HomeNetwork", "password123", 1);
+  wm.addCredential("Office", "office-pass", 0);
+}
+
+static void setupWrongPassword(ESP_WiFiManager& wm)
+{
+  (void) wm;
+
+  WiFi.addNetwork(homeNetwork());
+  saveCredentials("HomeNetwork", "password-of-last-year");
+}
+
+static void setupNoAP(ESP_WiFiManager& wm)
+{
+  (void) wm;
+
+  WiFi.addNetwork(officeNetwork());
+  saveCredentials("HomeNetwork", "password123");
+}
+
+static void setupNoDHCP(ESP_WiFiManager& wm)
+{
+  WM_HostNetwork network = homeNetwork();
+
+  network.dhcpTime = -1;
+
+  WiFi.addNetwork(network);
+  saveCredentials("HomeNetwork", "password123");
+
+  wm.setConnectTimeout(20);
+}
+
+static void setupTransientFailure(ESP_WiFiManager& wm)
+{
+  WM_HostNetwork network = homeNetwork();
+
+  (void) wm;
+
+  network.failReason  = WIFI_DISCONNECT_REASON_UNSPECIFIED;
+  network.failCount   = 1;
+
+  WiFi.addNetwork(network);
+  saveCredentials("HomeNetwork", "password123");
+}
+
+static void setupRejectedOnce(ESP_WiFiManager& wm)
+{
+  WM_HostNetwork network = homeNetwork();
+
+  (void) wm;
+
+  network.failReason  = WIFI_DISCONNECT_REASON_ASSOC_FAIL;
+  network.failCount   = 1;
+
+  WiFi.addNetwork(network);
+  saveCredentials("HomeNetwork", "password123");
+}
+
+// Connected, then the AP is gone for 3.5 s. The time is the one of the reconnection, from the loss.
+static bool runLinkLost(ESP_WiFiManager& wm)
+{
+  if (!wm.autoConnect("ESP_Sim"))
+    return false;
+
+  delay(5000);
+
+  WiFi.setInRange("HomeNetwork", false);
+  measureFrom = millis();
+  gotIP       = false;
+
+  delay(3500);
+
+  WiFi.setInRange("HomeNetwork", true);
+
+  // As loop() of a sketch, which then sees the reconnection
+  while ( !gotIP && (millis() - measureFrom < 60000) )
+  {
+    wm.process();
+    delay(10);
+  }
+
+  wm.process();
+
+  return wm.connectionState() == WM_CONNECT_CONNECTED;
+}
+
+static void setupPortalSave(ESP_WiFiManager& wm)
+{
+  WiFi.addNetwork(homeNetwork());
+  WiFi.addNetwork(homeNetwork(11, 2, -71));
+  WiFi.addNetwork(officeNetwork());
+
+  saveRequest = "/wifisave?s=HomeNetwork&p=password123";
+  wm.setPortalReadyCallback(sendRequest);
+}
+
+// The AP seen by the scan of the portal moves to another channel before the save
+static bool runStaleHint(ESP_WiFiManager& wm)
+{
+  wm.setAPCallback([](ESP_WiFiManager* wm)
+  {
+    (void) wm;
+
+    // After the scan of the portal, before the connection
+    WM_HostClock::onTick([]()
+    {
+      static bool moved = false;
+
+      if ( !moved && WiFi.scans() && (WiFi.scanComplete() >= 0) )
+      {
+        moved = true;
+        WiFi.setInRange("HomeNetwork", false);
+        WiFi.addNetwork(homeNetwork(1, 1, -48));
+      }
+    });
+  });
+
+  return wm.autoConnect("ESP_Sim");
+}
+
+// Saved from the portal to the BSSID of its scan. At the next boot, that AP is gone and the other one of the SSID is
+// still there : the driver must not be kept to the first one. The time is the one of the next boot.
+static bool runNextBoot(ESP_WiFiManager& wm)
+{
+  if (!wm.autoConnect("ESP_Sim"))
+    return false;
+
+  WiFi.clearNetworks();
+  WiFi.addNetwork(homeNetwork(11, 2, -71));
+  WiFi.reboot();
+
+  measureFrom = millis();
+  gotIP       = false;
+
+  ESP_WiFiManager next("Sim");
+
+  next.setConfigPortalTimeout(SIM_PORTAL_TIMEOUT_S);
+
+  return next.autoConnect("ESP_Sim");
+}
+
+#if USE_RTC_FAST_CONNECT_IP
+static void setupFastConnectOther(ESP_WiFiManager& wm)
+{
+  (void) wm;
+
+  WiFi.addNetwork(homeNetwork());
+  WiFi.addNetwork(officeNetwork());
+  saveCredentials("HomeNetwork", "password123");
+}
+
+// Fast connect hit at the next boot, with the DHCP lease of HomeNetwork as static IP, then a connection to Office :
+// it must get the lease of Office, not keep the IP and gateway of HomeNetwork. The time is the one to Office.
+static bool runFastConnectOther(ESP_WiFiManager& wm)
+{
+  if (!wm.autoConnect("ESP_Sim"))
+    return false;
+
+  WiFi.reboot();
+
+  ESP_WiFiManager next("Sim");
+
+  next.setConfigPortalTimeout(SIM_PORTAL_TIMEOUT_S);
+
+  if ( !next.autoConnect("ESP_Sim") || !next.getFastConnectStats()._hit )
+  {
+    Serial.printf("# fast-connect-other : no fast connect hit at the next boot\n");
+    return false;
+  }
+
+  WiFi.disconnect();
+
+  measureFrom = millis();
+  gotIP       = false;
+
+  if (!next.beginConnect("Office", "office-pass"))
+    return false;
+
+  while ( (next.connectionState() != WM_CONNECT_CONNECTED) && (next.connectionState() != WM_CONNECT_FAILED) )
+  {
+    next.process();
+    delay(10);
+  }
+
+  // As given with the IP, DHCP must be back before the connection
+  if ( !gotIP || (gotIPGateway != IPAddress(192, 168, 0x10, 1)) )
+  {
+    Serial.printf("# fast-connect-other : gateway %s, the one of HomeNetwork kept\n", gotIPGateway.toString().c_str());
+    return false;
+  }
+
+  return next.connectionState() == WM_CONNECT_CONNECTED;
+}
+#endif
+
+static const SimScenario scenarios[] =
+{
+  { "saved",              "saved credentials, AP in range",                       setupSaved,             runAutoConnect, true,   1300    },
+  { "slow-dhcp",          "saved credentials, 6 s DHCP",                          setupSlowDHCP,          runAutoConnect, true,   6900    },
+  { "known-out-of-range", "best known network out of range, next one",            setupKnownOutOfRange,   runAutoConnect, true,   4000    },
+  { "transient-failure",  "association fails once, the driver retries",           setupTransientFailure,  runAutoConnect, true,   3500    },
+  { "rejected-once",      "association rejected once, the driver retries",        setupRejectedOnce,      runAutoConnect, true,   3500    },
+  { "wrong-password",     "saved password wrong, portal timeout",                 setupWrongPassword,     runAutoConnect, false,  63000   },
+  { "no-ap",              "saved SSID not in range, portal timeout",              setupNoAP,              runAutoConnect, false,  66000   },
+  { "no-dhcp",            "associated, no IP, 20 s connect timeout",              setupNoDHCP,            runAutoConnect, false,  112000  },
+  { "link-lost",          "AP gone for 3.5 s, reconnection by the driver",        setupSaved,             runLinkLost,    true,   5500    },
+  { "portal-save",        "no credentials, saved from the portal",                setupPortalSave,        runAutoConnect, true,   3500    },
+  { "portal-stale-hint",  "saved from the portal, AP moved channel meanwhile",    setupPortalSave,        runStaleHint,   true,   6000    },
+  { "portal-next-boot",   "saved from the portal, its BSSID gone at next boot",   setupPortalSave,        runNextBoot,    true,   1300    },
+#if USE_RTC_FAST_CONNECT_IP
+  { "fast-connect-other", "fast connect hit with IP, then to another SSID",       setupFastConnectOther,  runFastConnectOther, true, 4000  },
+#endif
+};
+
+/////////////////////////////////////////////////////////////////////////////
+
+static bool selected(const char* name, int argc, char* argv[])
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], name) == 0)
+      return true;
+  }
+
+  return argc < 2;
+}
+
+static bool runScenario(const SimScenario& scenario)
+{
+  WiFi.reset();
+  ESP.powerOn();
+  WiFi.setScanTime(1500);
+  WiFi.setNoAPTime(2000);
+  WiFi.setReconnectTime(1000);
+
+  unsigned long connectTime = -1;
+  unsigned long totalTime;
+  bool          connected;
+  auto          wallStart   = std::chrono::steady_clock::now();
+
+  {
+    ESP_WiFiManager wm("Sim");
+
+    wm.setConfigPortalTimeout(SIM_PORTAL_TIMEOUT_S);
+
+    scenario.setup(wm);
+
+    measureFrom = millis();
+    gotIP       = false;
+
+    connected   = scenario.run(wm);
+    totalTime   = millis() - measureFrom;
+
+    if (gotIP)
+      connectTime = gotIPAt - measureFrom;
+  }
+
+  if (clientFd >= 0)
+  {
+    ::close(clientFd);
+    clientFd = -1;
+  }
+
+  double        wallTime  = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+  unsigned long time      = scenario.connected ? connectTime : totalTime;
+  bool          ok        = (connected == scenario.connected) && (time <= scenario.maxTime);
+
+  Serial.printf("%s,%s,%ld,%lu,%u,%u,%.1f,%s\n", scenario.name, connected ? "connected" : "not_connected",
+                gotIP ? (long) connectTime : -1L, totalTime, WiFi.attempts(), WiFi.scans(), wallTime, ok ? "ok" : "FAIL");
+
+  if (!ok)
+  {
+    Serial.printf("# %s : %s, expected %s within %lu ms\n", scenario.name, scenario.description,
+                  scenario.connected ? "connected" : "not connected", scenario.maxTime);
+  }
+
+  return ok;
+}
+
+int main(int argc, char* argv[])
+{
+  WM_HostClock::setVirtual(true);
+
+  // Free ports, the scenarios may run beside a portal_host or another run
+  WM_PosixWebServer::setPortOverride(0);
+  WM_PosixDNSServer::setPortOverride(0);
+
+  // Time to connect : to the IP
+  WiFiEventHandler gotIPHandler = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP& event)
+  {
+    gotIPAt       = millis();
+    gotIP         = true;
+    gotIPGateway  = event.gw;
+  });
+
+  Serial.printf("scenario,result,connect_ms,total_ms,attempts,scans,wall_ms,check\n");
+
+  int failed = 0;
+
+  for (const SimScenario& scenario : scenarios)
+  {
+    if (selected(scenario.name, argc, argv) && !runScenario(scenario))
+      failed++;
+  }
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+/****************************************************************************************************************************
+  portal_host.cpp
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the Config Portal of the library as a Linux program. The handlers are
+  those of ESP_WiFiManager-Impl.h, served over the sockets of the host, so that the portal can be load-tested, profiled
+  and fuzzed with the usual tools.
+
+  The web server listens on WM_HTTP_PORT and the DNS server on WM_DNS_PORT, on all the interfaces. The networks below
+  are in range of the mock WiFi, HomeNetwork / password123 connects.
+
+  Usage : portal_host [ timeout in s, 0 for none ] [ -n ]
+          -n runs the non-blocking portal from a loop, as a sketch calling process() from loop()
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#include <ESP_WiFiManager.h>
+
+int main(int argc, char* argv[])
+{
+  unsigned long timeout     = 0;
+  bool          nonBlocking = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-n") == 0)
+      nonBlocking = true;
+    else
+      timeout = strtoul(argv[i], NULL, 10);
+  }
+
+  WiFi.addNetwork( { "HomeNetwork",   "password123",  -48,  6, ENC_TYPE_CCMP, { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }, false } );
+  WiFi.addNetwork( { "HomeNetwork",   "password123",  -71, 11, ENC_TYPE_CCMP, { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 }, false } );
+  WiFi.addNetwork( { "CoffeeShop",    "",             -63,  1, ENC_TYPE_NONE, { 0x02, 0x00, 0x00, 0x00, 0x00, 0x03 }, false } );
+  WiFi.addNetwork( { "Neighbour 5G",  "secret-pass",  -80, 36, ENC_TYPE_CCMP, { 0x02, 0x00, 0x00, 0x00, 0x00, 0x04 }, false } );
+  WiFi.addNetwork( { "Legacy<WEP>",   "abcde",        -86,  3, ENC_TYPE_WEP,  { 0x02, 0x00, 0x00, 0x00, 0x00, 0x05 }, false } );
+
+  ESP_WiFiManager ESP_wifiManager("HostPortal");
+
+  ESP_WMParameter mqttServer("mqtt_server", "MQTT server", "broker.local", 40);
+  ESP_WMParameter mqttPort("mqtt_port", "MQTT port", "1883", 6);
+
+  ESP_wifiManager.addParameter(&mqttServer);
+  ESP_wifiManager.addParameter(&mqttPort);
+
+  ESP_wifiManager.setConfigPortalTimeout(timeout);
+
+  Serial.printf("Config portal on http://127.0.0.1:%d/ , DNS on port %d\n", WM_HTTP_PORT, WM_DNS_PORT);
+
+  bool connected;
+
+  if (nonBlocking)
+  {
+    ESP_wifiManager.startConfigPortal("ESP_Host", NULL, true);
+
+    unsigned long loops = 0;
+
+    while (ESP_wifiManager.configPortalActive())
+    {
+      ESP_wifiManager.process();
+      loops++;
+
+      delay(1);
+    }
+
+    Serial.printf("Loop ran %lu times meanwhile\n", loops);
+
+    connected = (WiFi.status() == WL_CONNECTED);
+  }
+  else
+  {
+    connected = ESP_wifiManager.startConfigPortal("ESP_Host", NULL);
+  }
+
+  Serial.printf("Config portal closed, %s%s. MQTT server = %s, port = %s\n", connected ? "connected to " : "not connected",
+                connected ? WiFi.SSID().c_str() : "", mqttServer.getValue(), mqttPort.getValue());
+
+  return connected ? 0 : 1;
+}
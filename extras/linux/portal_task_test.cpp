@@ -0,0 +1,145 @@
+/****************************************************************************************************************************
+  portal_task_test.cpp
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the Config Portal run by the portal task ( USE_PORTAL_TASK, a
+  std::thread on the host ), on the real clock. The task is started, refused while it runs, stopped, restarted after a
+  portal which ended on its own, and the sketch side reads getPortalEvent() and getConfigSnapshot() meanwhile.
+
+  One line per check, the exit code is 1 if one failed.
+
+  Usage : portal_task_test
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#include <ESP_WiFiManager.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static int failed;
+
+static void check(bool ok, const char* what)
+{
+  Serial.printf("%s : %s\n", ok ? "ok  " : "FAIL", what);
+
+  if (!ok)
+    failed++;
+}
+
+// The states seen by the task since the last call, the last one in last
+static int readEvents(ESP_WiFiManager& wm, WM_PortalState& last)
+{
+  WM_PortalEvent  event;
+  int             count = 0;
+
+  while (wm.getPortalEvent(event))
+  {
+    last = event._state;
+    count++;
+  }
+
+  return count;
+}
+
+static bool waitTaskEnd(ESP_WiFiManager& wm, unsigned long timeout)
+{
+  unsigned long start = millis();
+
+  while ( wm.portalTaskRunning() && (millis() - start < timeout) )
+    delay(10);
+
+  return !wm.portalTaskRunning();
+}
+
+// A browser on the Config Portal
+static int sendRequest(const char* uri)
+{
+  sockaddr_in addr = {};
+
+  addr.sin_family       = AF_INET;
+  addr.sin_port         = htons(WM_PosixWebServer::boundPort());
+  addr.sin_addr.s_addr  = htonl(INADDR_LOOPBACK);
+
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+  if ( (fd < 0) || (connect(fd, (sockaddr*) &addr, sizeof(addr)) != 0) )
+  {
+    Serial.printf("portal_task_test : no portal on port %u\n", WM_PosixWebServer::boundPort());
+
+    if (fd >= 0)
+      ::close(fd);
+
+    return -1;
+  }
+
+  String request = String("GET ") + uri + " HTTP/1.0\r\nHost: 192.168.4.1\r\n\r\n";
+
+  if (write(fd, request.c_str(), request.length()) < 0)
+    Serial.printf("portal_task_test : request not sent\n");
+
+  return fd;
+}
+
+int main()
+{
+  // Free ports, the test may run beside a portal_host or another run
+  WM_PosixWebServer::setPortOverride(0);
+  WM_PosixDNSServer::setPortOverride(0);
+
+  WiFi.addNetwork( { "HomeNetwork", "password123", -48, 6, ENC_TYPE_CCMP, { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }, false } );
+  WiFi.setScanTime(100);
+
+  ESP_WiFiManager wm("TaskTest");
+  ESP_WMParameter mqttServer("mqtt_server", "MQTT server", "broker.local", 40);
+  WM_PortalState  state = WM_PORTAL_IDLE;
+
+  wm.addParameter(&mqttServer);
+
+  // Started, then stopped by the sketch
+  check(wm.startConfigPortalTask("ESP_Task"), "start");
+  check(wm.portalTaskRunning(), "task running");
+  check(!wm.startConfigPortalTask("ESP_Task"), "start refused while the task runs");
+
+  delay(100);
+
+  check(wm.stopConfigPortalTask(), "stop");
+  check(!wm.portalTaskRunning(), "stop waits for the task");
+  check( (readEvents(wm, state) >= 2) && (state == WM_PORTAL_CLOSED), "events serving then closed");
+
+  // Restarted, ends on its own by the config portal timeout, its thread not joined by stopConfigPortalTask()
+  wm.setConfigPortalTimeout(1);
+
+  check(wm.startConfigPortalTask("ESP_Task"), "restart after stop");
+  check(waitTaskEnd(wm, 5000), "task ends by the portal timeout");
+  check( (readEvents(wm, state) >= 2) && (state == WM_PORTAL_TIMEOUT), "events serving then timeout");
+
+  // Restarted after that end, saved from a browser, connected
+  wm.setConfigPortalTimeout(0);
+
+  check(wm.startConfigPortalTask("ESP_Task"), "restart after the portal timeout");
+
+  int fd = sendRequest("/wifisave?s=HomeNetwork&p=password123&mqtt_server=mqtt.example.com");
+
+  check(waitTaskEnd(wm, 10000), "task ends once connected");
+  check( (readEvents(wm, state) >= 2) && (state == WM_PORTAL_CONNECTED), "events serving then connected");
+
+  WM_ConfigSnapshot snapshot;
+
+  wm.getConfigSnapshot(snapshot);
+
+  check( (snapshot._ssid == "HomeNetwork") && (snapshot._pass == "password123"), "snapshot of the credentials");
+  check( (snapshot._numValues == 1) && (snapshot._values[0] == "mqtt.example.com"), "snapshot of the parameters");
+  check(WiFi.status() == WL_CONNECTED, "connected");
+
+  if (fd >= 0)
+    ::close(fd);
+
+  // Stopped when not running, and once more by the destructor
+  wm.stopConfigPortalTask();
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+/****************************************************************************************************************************
+  user_interface.h
+  For ESP8266 / ESP32 boards
+
+  Host build of ESP_WiFiManager ( extras/linux ) : the ESP8266 SDK header, only bss_info of the scan results, as
+  given by WiFi.getScanInfoByIndex().
+
+  Licensed under MIT license
+ *****************************************************************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+struct bss_info
+{
+  uint8_t   bssid[6];
+  uint8_t   ssid[32];                 // Not NUL terminated when 32 long
+  uint8_t   ssid_len;
+  uint8_t   channel;
+  int8_t    rssi;
+  uint8_t   authmode;
+  uint8_t   is_hidden;
+};
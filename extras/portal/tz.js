@@ -0,0 +1,5 @@
+// Show the timezone detected by jstz, used as default of the NTP timezone field
+var timezone = jstz.determine();
+
+console.log('Your timezone is:' + timezone.name());
+document.getElementById('timezone').innerHTML = timezone.name();
@@ -0,0 +1,7 @@
+// Fill the SSID fields with the network clicked in the scan list
+function c(l) {
+  document.getElementById('s').value = l.innerText || l.textContent;
+  document.getElementById('p').focus();
+  document.getElementById('s1').value = l.innerText || l.textContent;
+  document.getElementById('p1').focus();
+}
@@ -0,0 +1,330 @@
+#!/usr/bin/env python3
+"""
+  portal_assets.py
+  For ESP8266 / ESP32 boards
+
+  Generates ESP_WiFiManager_Assets.h from the Config Portal sources in extras/portal.
+
+  Text assets are minified and gzipped (kept raw when gzip does not save at least 10%), then written as PROGMEM
+  byte arrays with their length, content type and a version / strong ETag taken from the SHA-256 of the served
+  content. The same header is written to src, src_h and src_cpp so that all variants serve identical assets.
+
+  The header also holds the same content as C string macros ( WM_ASSET_<name>_INLINE, and a data URI for images ),
+  used by the inline WM_HTTP_STYLE / WM_HTTP_SCRIPT* / WM_HTTP_HEAD_END fallbacks when USE_PORTAL_ASSETS is false.
+  The HTML markup around them stays hand-written in ESP_WiFiManager.h.
+
+  Usage:
+    python3 extras/portal_assets.py            regenerate the headers and print the flash footprint
+    python3 extras/portal_assets.py --check    exit with 1 if a committed header is out of date
+    python3 extras/portal_assets.py --help     print the usage, any other argument exits with 2
+
+  As PlatformIO pre-script ( extra_scripts = pre:../extras/portal_assets.py ) it only checks, and stops the build
+  when a header is out of date. Regenerating stays a manual step, the build never rewrites the library sources.
+"""
+
+import argparse
+import base64
+import gzip
+import hashlib
+import io
+import json
+import os
+import re
+import sys
+
+ASSETS_HEADER   = "ESP_WiFiManager_Assets.h"
+VARIANT_DIRS    = [ "src", "src_h", "src_cpp" ]
+
+# Below this ratio of the original size, a gzipped asset is worth the Content-Encoding
+GZIP_MIN_SAVING = 0.10
+
+# Characters per string literal in the inline macros
+INLINE_WIDTH    = 100
+
+##########################################
+
+def strip_comments(text, line_comments):
+  """Remove /* */ ( and // when line_comments ) comments, leaving string literals untouched."""
+  out = []
+  i   = 0
+  n   = len(text)
+
+  while i < n:
+    ch = text[i]
+
+    if ch in "\"'`":
+      j = i + 1
+
+      while j < n and text[j] != ch:
+        j += 2 if text[j] == "\\" else 1
+
+      out.append(text[i:j + 1])
+      i = j + 1
+    elif text.startswith("/*", i):
+      end = text.find("*/", i + 2)
+      i   = n if end < 0 else end + 2
+    elif line_comments and text.startswith("//", i):
+      end = text.find("\n", i)
+      i   = n if end < 0 else end
+    else:
+      out.append(ch)
+      i += 1
+
+  return "".join(out)
+
+##########################################
+
+def squeeze(text, punctuation):
+  """Collapse whitespace outside string literals and drop it next to punctuation."""
+  parts = re.split(r"(\"(?:\\.|[^\"\\])*\"|'(?:\\.|[^'\\])*')", text)
+
+  for k in range(0, len(parts), 2):
+    part = re.sub(r"[ \t]+", " ", parts[k])
+    part = re.sub(r" ?([" + re.escape(punctuation) + r"]) ?", r"\1", part)
+    parts[k] = part
+
+  return "".join(parts)
+
+##########################################
+
+def minify_css(text):
+  text = strip_comments(text, False)
+  text = squeeze(" ".join(text.split()), "{};:,>")
+
+  return text.replace(";}", "}")
+
+##########################################
+
+def minify_js(text):
+  """Conservative: only comments, indentation and the spaces around punctuation go, line breaks are kept
+     unless the statement obviously continues, so automatic semicolon insertion is never affected."""
+  lines = [ squeeze(line.strip(), "{}();,=:|&?<>") for line in strip_comments(text, True).splitlines() ]
+  out   = ""
+
+  for line in filter(None, lines):
+    if out and not (out[-1] in "{;,(" or line[0] in "})"):
+      out += "\n"
+
+    out += line
+
+  return out
+
+##########################################
+
+def load_asset(portal_dir, asset):
+  chunks = []
+
+  for name in asset["files"]:
+    path = os.path.join(portal_dir, name)
+
+    if asset["type"].startswith("image/"):
+      chunks.append(open(path, "rb").read())
+      continue
+
+    text = open(path, encoding="utf-8").read()
+
+    # Third-party files are vendored already minified
+    if ".min." not in name:
+      text = minify_css(text) if asset["type"] == "text/css" else minify_js(text)
+
+    chunks.append(text.strip().encode("utf-8"))
+
+  return b"\n".join(chunks)
+
+##########################################
+
+def compress(raw):
+  bio = io.BytesIO()
+
+  # Fixed mtime and no file name, so the output only changes with the content
+  with gzip.GzipFile(fileobj=bio, mode="wb", compresslevel=9, mtime=0, filename="") as f:
+    f.write(raw)
+
+  data = bio.getvalue()
+
+  if len(data) <= len(raw) * (1 - GZIP_MIN_SAVING):
+    return data, True
+
+  return raw, False
+
+##########################################
+
+def build_assets(portal_dir):
+  manifest = json.load(open(os.path.join(portal_dir, "portal.json"), encoding="utf-8"))
+  assets   = []
+
+  for asset in manifest["assets"]:
+    raw           = load_asset(portal_dir, asset)
+    data, gzipped = compress(raw)
+
+    asset = dict(asset, raw=raw, data=data, gzipped=gzipped, version=hashlib.sha256(raw).hexdigest()[:16])
+    assets.append(asset)
+
+  return assets
+
+##########################################
+
+def c_string(text):
+  """Adjacent C string literals of the text, one per line, continued as macro body."""
+  lines = []
+
+  for i in range(0, len(text), INLINE_WIDTH):
+    chunk = text[i:i + INLINE_WIDTH].replace("\\", "\\\\").replace("\"", "\\\"").replace("\n", "\\n")
+    lines.append("  \"%s\"" % chunk)
+
+  return " \\\n".join(lines)
+
+##########################################
+
+def inline_macro(asset):
+  """The served content as a C string, for the inline fallbacks."""
+  if asset["type"].startswith("image/"):
+    name  = "WM_ASSET_%s_DATA_URI" % asset["name"]
+    value = "data:%s;base64,%s" % (asset["type"], base64.b64encode(asset["raw"]).decode("ascii"))
+  else:
+    name  = "WM_ASSET_%s_INLINE" % asset["name"]
+    value = asset["raw"].decode("utf-8")
+
+  return "#define %s \\\n%s" % (name, c_string(value))
+
+##########################################
+
+def banner(variant_dir):
+  """Reuse the library banner of the variant, so the generated header looks like the others."""
+  text = open(os.path.join(variant_dir, "ESP_WiFiManager_Debug.h"), encoding="utf-8").read()
+  end  = text.index("*/") + 2
+
+  return text[:end].replace("ESP_WiFiManager_Debug.h", ASSETS_HEADER, 1)
+
+##########################################
+
+def render(variant_dir, assets):
+  total_raw  = sum(len(a["raw"]) for a in assets)
+  total_data = sum(len(a["data"]) for a in assets)
+
+  L = [ banner(variant_dir), "", "#pragma once", "",
+        "// Generated by extras/portal_assets.py from extras/portal, do not edit.",
+        "// Static Config Portal assets, served by ESP_WiFiManager when USE_PORTAL_ASSETS is true.",
+        "// Text assets are minified and stored gzipped. The version is the start of the SHA-256 of the served content and",
+        "// is used both as strong ETag and as cache-busting query in the links of the portal pages.",
+        "// Flash used by the assets : %d bytes ( %d bytes uncompressed )" % (total_data, total_raw), "" ]
+
+  for a in assets:
+    name = a["name"]
+    size = "%d bytes gzipped from %d" % (len(a["data"]), len(a["raw"])) if a["gzipped"] else "%d bytes" % len(a["data"])
+
+    L.append("// %s, %s" % (a["uri"], size))
+    L.append("#define WM_ASSET_%s_ENABLED      %s" % (name, a.get("enabled", "true")))
+    L.append("#define WM_ASSET_%s_VERSION      \"%s\"" % (name, a["version"]))
+    L.append("#define WM_ASSET_%s_ETAG         \"\\\"%s\\\"\"" % (name, a["version"]))
+    L.append("#define WM_ASSET_%s_LENGTH       %d" % (name, len(a["data"])))
+    L.append("#define WM_ASSET_%s_GZIPPED      %s" % (name, "true" if a["gzipped"] else "false"))
+    L.append("")
+
+  L += [ "// The same content, uncompressed, for the inline WM_HTTP_STYLE / WM_HTTP_SCRIPT* / WM_HTTP_HEAD_END",
+         "// of ESP_WiFiManager.h when USE_PORTAL_ASSETS is false", "" ]
+
+  for a in assets:
+    L.append(inline_macro(a))
+    L.append("")
+
+  L += [ "#if USE_PORTAL_ASSETS", "" ]
+
+  for a in assets:
+    name = a["name"]
+
+    L.append("#if WM_ASSET_%s_ENABLED" % name)
+    L.append("const char WM_ASSET_%s_TYPE[] PROGMEM = \"%s\";" % (name, a["type"]))
+    L.append("")
+    L.append("const uint8_t WM_ASSET_%s_DATA[WM_ASSET_%s_LENGTH] PROGMEM =" % (name, name))
+    L.append("{")
+
+    data = a["data"]
+
+    for i in range(0, len(data), 16):
+      L.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ("," if i + 16 < len(data) else ""))
+
+    L.append("};")
+    L.append("#endif")
+    L.append("")
+
+  L += [ "typedef struct",
+         "{",
+         "  const char     *_uri;",
+         "  PGM_P           _contentType;",
+         "  const uint8_t  *_data;",
+         "  size_t          _length;",
+         "  const char     *_etag;              // Strong ETag, quotes included",
+         "  bool            _gzipped;",
+         "} WM_PortalAsset;",
+         "",
+         "const WM_PortalAsset WM_PORTAL_ASSETS[] =",
+         "{" ]
+
+  for a in assets:
+    name = a["name"]
+
+    L.append("#if WM_ASSET_%s_ENABLED" % name)
+    L.append("  { \"%s\", WM_ASSET_%s_TYPE, WM_ASSET_%s_DATA, WM_ASSET_%s_LENGTH, WM_ASSET_%s_ETAG, WM_ASSET_%s_GZIPPED },"
+             % (a["uri"], name, name, name, name, name))
+    L.append("#endif")
+
+  L += [ "};", "",
+         "#define WM_NUM_PORTAL_ASSETS          ( sizeof(WM_PORTAL_ASSETS) / sizeof(WM_PORTAL_ASSETS[0]) )", "",
+         "#endif    // USE_PORTAL_ASSETS", "" ]
+
+  return "\n".join(L)
+
+##########################################
+
+def generate(root, check=False):
+  assets = build_assets(os.path.join(root, "extras", "portal"))
+  stale  = []
+
+  for variant in VARIANT_DIRS:
+    variant_dir = os.path.join(root, variant)
+    path        = os.path.join(variant_dir, ASSETS_HEADER)
+    header      = render(variant_dir, assets)
+    current     = open(path, encoding="utf-8").read() if os.path.exists(path) else None
+
+    if current == header:
+      continue
+
+    if check:
+      stale.append(path)
+    else:
+      open(path, "w", encoding="utf-8", newline="\n").write(header)
+      print("Generated", path)
+
+  for a in assets:
+    print("%-10s %6d bytes  ( %6d raw%s )" % (a["uri"], len(a["data"]), len(a["raw"]), ", gzip" if a["gzipped"] else ""))
+
+  print("%-10s %6d bytes" % ("total", sum(len(a["data"]) for a in assets)))
+
+  for path in stale:
+    print("Out of date:", path, file=sys.stderr)
+
+  return not stale
+
+##########################################
+
+try:
+  Import                                              # noqa: F821, SCons builtin
+except NameError:
+  Import = None
+
+if Import:
+  # PlatformIO pre-script, the project is in platformio/. Only check, the sources are regenerated by hand
+  Import("env")
+
+  if not generate(os.path.join(env.subst("$PROJECT_DIR"), os.pardir), True):                # noqa: F821
+    print("Config Portal assets out of date, run : python3 extras/portal_assets.py", file=sys.stderr)
+    env.Exit(1)                                                                               # noqa: F821
+elif __name__ == "__main__":
+  # Unknown arguments stop with the usage and exit status 2, they never fall back to regenerating
+  parser = argparse.ArgumentParser(description="Generate ESP_WiFiManager_Assets.h from the Config Portal sources.")
+  parser.add_argument("--check", action="store_true", help="only check, exit with 1 if a committed header is out of date")
+  args = parser.parse_args()
+
+  repo_root = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+  sys.exit(0 if generate(repo_root, args.check) else 1)
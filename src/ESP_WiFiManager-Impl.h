@@ -251,14 +251,17 @@ ESP_WiFiManager::ESP_WiFiManager(const char *iHostname)
   LOGWARN1(F("RFC925 Hostname ="), RFC952_hostname);
 
   setHostname();
-
-  networkIndices = NULL;
 }
 
 //////////////////////////////////////////
 
 ESP_WiFiManager::~ESP_WiFiManager()
 {
+#if USE_PORTAL_TASK
+  // The task refers to this object
+  stopConfigPortalTask();
+#endif
+
 #if USE_DYNAMIC_PARAMS
   if (_params != NULL)
   {
@@ -268,10 +271,16 @@ ESP_WiFiManager::~ESP_WiFiManager()
   }
 #endif
 
-  if (networkIndices)
+  if (_scanResults)
   {
-    free(networkIndices); //indices array no longer required so free memory
+    free(_scanResults);
   }
+
+#if ( USE_WIFI_EVENTS && defined(ESP32) )
+  // The handler refers to this object. On ESP8266, the WiFiEventHandler members unregister themselves.
+  if (_wifiEventsStarted)
+    WiFi.removeEvent(_wifiEventId);
+#endif
 }
 
 //////////////////////////////////////////
@@ -342,20 +351,8 @@ void ESP_WiFiManager::setupConfigPortal()
   if (WiFi.getAutoConnect() == 0)
     WiFi.setAutoConnect(1);
 
-  dnsServer.reset(new DNSServer());
-
-#ifdef ESP8266
-  server.reset(new ESP8266WebServer(80));
-#else		//ESP32
-  server.reset(new WebServer(80));
-#endif
-
-  /* Setup the DNS server redirecting all the domains to the apIP */
-  if (dnsServer)
-  {
-    dnsServer->setErrorReplyCode(DNSReplyCode::NoError);
-    dnsServer->start(DNS_PORT, "*", WiFi.softAPIP());
-  }
+  dnsServer.reset(new WM_DNSServer());
+  server.reset(new WM_WebServer(WM_HTTP_PORT));
 
   _configPortalStart = millis();
 
@@ -400,8 +397,11 @@ void ESP_WiFiManager::setupConfigPortal()
   // From v1.0.11
   // Contributed by AlesSt (https://github.com/AlesSt) to solve issue softAP with custom IP sometimes not working
   // See https://github.com/khoih-prog/ESP_WiFiManager/issues/26 and https://github.com/espressif/arduino-esp32/issues/985
-  // delay 100ms to wait for SYSTEM_EVENT_AP_START
-  delay(100);
+  // Wait for SYSTEM_EVENT_AP_START, no longer than needed
+  if (!waitUntil([this]() { return softAPReady(); }, WM_AP_START_TIMEOUT_MS))
+  {
+    LOGERROR(F("Soft AP not started in time"));
+  }
   //////
   
   //optional soft ip config
@@ -410,25 +410,75 @@ void ESP_WiFiManager::setupConfigPortal()
     LOGWARN3(F("Custom AP IP/GW/Subnet = "), _WiFi_AP_IPconfig._ap_static_ip, _WiFi_AP_IPconfig._ap_static_gw, _WiFi_AP_IPconfig._ap_static_sn);
     
     WiFi.softAPConfig(_WiFi_AP_IPconfig._ap_static_ip, _WiFi_AP_IPconfig._ap_static_gw, _WiFi_AP_IPconfig._ap_static_sn);
-  }
 
-  delay(500); // Without delay I've seen the IP address blank
+    // The IP address was seen blank for a while after softAPConfig()
+    IPAddress apIP = _WiFi_AP_IPconfig._ap_static_ip;
+
+    if (!waitUntil([apIP]() { return WiFi.softAPIP() == apIP; }, WM_AP_START_TIMEOUT_MS))
+    {
+      LOGERROR(F("Soft AP IP address not set in time"));
+    }
+  }
   
   LOGWARN1(F("AP IP address ="), WiFi.softAPIP());
 
+  /* Setup the DNS server redirecting all the domains to the apIP, once it is known */
+  if (dnsServer)
+  {
+    dnsServer->setErrorReplyCode(DNSReplyCode::NoError);
+    dnsServer->start(DNS_PORT, "*", WiFi.softAPIP());
+  }
+
   /* Setup web pages: root, wifi config pages, SO captive portal detectors and not found. */
   server->on("/", std::bind(&ESP_WiFiManager::handleRoot, this));
   server->on("/wifi", std::bind(&ESP_WiFiManager::handleWifi, this));
   server->on("/wifisave", std::bind(&ESP_WiFiManager::handleWifiSave, this));
+  server->on("/credential", std::bind(&ESP_WiFiManager::handleCredential, this));
   server->on("/close", std::bind(&ESP_WiFiManager::handleServerClose, this));
   server->on("/i", std::bind(&ESP_WiFiManager::handleInfo, this));
   server->on("/r", std::bind(&ESP_WiFiManager::handleReset, this));
   server->on("/state", std::bind(&ESP_WiFiManager::handleState, this));
   server->on("/scan", std::bind(&ESP_WiFiManager::handleScan, this));
+  server->on("/connectstatus", std::bind(&ESP_WiFiManager::handleConnectStatus, this));
+  
+#if USE_PORTAL_ASSETS
+  for (size_t i = 0; i < WM_NUM_PORTAL_ASSETS; i++)
+  {
+    server->on(WM_PORTAL_ASSETS[i]._uri, std::bind(&ESP_WiFiManager::handleAsset, this, &WM_PORTAL_ASSETS[i]));
+  }
+#endif
+
+#if ( USE_PORTAL_ASSETS || USE_PORTAL_ETAG )
+  // If-None-Match is needed to answer revalidations with 304
+  static const char* headerKeys[] = { "If-None-Match" };
+  server->collectHeaders(headerKeys, 1);
+#endif
+  
   server->onNotFound(std::bind(&ESP_WiFiManager::handleNotFound, this));
   server->begin(); // Web server start
   
-  LOGWARN(F("HTTP server started"));
+  // Bring-up time, as seen by the first client
+  _portalBringUpTime = std::max(millis() - _portalStartCall, 1UL);
+
+  LOGWARN1(F("HTTP server started after (ms) :"), _portalBringUpTime);
+
+  if (_portalreadycallback != NULL)
+  {
+    _portalreadycallback(_portalBringUpTime);
+  }
+}
+
+//////////////////////////////////////////
+
+// The soft AP runs and has its IP address
+bool ESP_WiFiManager::softAPReady()
+{
+#if ( USE_WIFI_EVENTS && defined(ESP32) )
+  if (!_apStarted.load())
+    return false;
+#endif
+
+  return ( (uint32_t) WiFi.softAPIP() != 0 );
 }
 
 //////////////////////////////////////////
@@ -461,32 +511,35 @@ bool ESP_WiFiManager::autoConnect()
 
 bool ESP_WiFiManager::autoConnect(char const *apName, char const *apPassword)
 {
+  // The known networks first, then the credentials saved by the WiFi driver
+  if ( (_numCredentials == 0) || (connectBest() != WL_CONNECTED) )
+  {
 #if AUTOCONNECT_NO_INVALIDATE
-  LOGINFO(F("\nAutoConnect using previously saved SSID/PW, but keep previous settings"));
-  // Connect to previously saved SSID/PW, but keep previous settings
-  connectWifi();
+    LOGINFO(F("\nAutoConnect using previously saved SSID/PW, but keep previous settings"));
+    // Connect to previously saved SSID/PW, but keep previous settings
+    connectWifi();
 #else
-  LOGINFO(F("\nAutoConnect using previously saved SSID/PW, but invalidate previous settings"));
-  // Connect to previously saved SSID/PW, but invalidate previous settings
-  connectWifi(WiFi_SSID(), WiFi_Pass());  
+    LOGINFO(F("\nAutoConnect using previously saved SSID/PW, but invalidate previous settings"));
+    // Connect to previously saved SSID/PW, but invalidate previous settings
+    connectWifi(WiFi_SSID(), WiFi_Pass());  
 #endif
+  }
  
   unsigned long startedAt = millis();
 
-  while (millis() - startedAt < 10000)
-  {
-    //delay(100);
-    delay(200);
+  // The WiFi driver may still connect by itself after a timeout, not after a failure it reported
+  bool mayConnect = (_connectState != WM_CONNECT_FAILED) || (_connectFailure == WM_FAIL_TIMEOUT) ||
+                    (_connectFailure == WM_FAIL_DHCP_TIMEOUT) || (_connectFailure == WM_FAIL_OTHER);
 
-    if (WiFi.status() == WL_CONNECTED)
-    {
-      float waited = (millis() - startedAt);
-       
-      LOGWARN1(F("Connected after waiting (s) :"), waited / 1000);
-      LOGWARN1(F("Local ip ="), WiFi.localIP());
-      
-      return true;
-    }
+  // Checked before waiting, connectWifi() has often connected already
+  if (waitUntil([]() { return WiFi.status() == WL_CONNECTED; }, mayConnect ? WM_AUTOCONNECT_WAIT_MS : 0))
+  {
+    float waited = (millis() - startedAt);
+     
+    LOGWARN1(F("Connected after waiting (s) :"), waited / 1000);
+    LOGWARN1(F("Local ip ="), WiFi.localIP());
+    
+    return true;
   }
 
   return startConfigPortal(apName, apPassword);
@@ -508,14 +561,28 @@ bool  ESP_WiFiManager::startConfigPortal()
 
 //////////////////////////////////////////
 
-bool  ESP_WiFiManager::startConfigPortal(char const *apName, char const *apPassword)
+bool  ESP_WiFiManager::startConfigPortal(char const *apName, char const *apPassword, bool nonBlocking)
 {
-  //setup AP
-  int connRes = WiFi.waitForConnectResult();
+  if (configPortalActive())
+  {
+    LOGERROR(F("Config portal already running"));
 
-  LOGINFO("WiFi.waitForConnectResult Done");
+    return false;
+  }
+
+  _portalStartCall = millis();
+
+#if USE_WIFI_EVENTS
+  // To see the soft AP start
+  startWiFiEvents();
+
+#ifdef ESP32
+  _apStarted.store(false);
+#endif
+#endif
 
-  if (connRes == WL_CONNECTED)
+  //setup AP. The connection, if any, has had its chance already, no need to wait for it.
+  if (WiFi.status() == WL_CONNECTED)
   {
     LOGINFO("SET AP_STA");
     
@@ -546,94 +613,162 @@ bool  ESP_WiFiManager::startConfigPortal(char const *apName, char const *apPassw
 
   setupConfigPortal();
 
-  bool TimedOut = true;
+#if USE_RTC_SCAN_CACHE
+  // Networks seen before the reboot, shown until the first scan is done
+  if (_numScanResults == 0)
+    loadScanResultsFromRTC();
+#endif
+
+#if USE_ASYNC_WIFI_SCAN
+  // The results are then ready when the first client opens /wifi
+  startScan();
+#endif
 
-  LOGINFO("ESP_WiFiManager::startConfigPortal : Enter loop");
+  _portalNonBlocking    = nonBlocking;
+  _portalSaved          = false;
+  _portalConnectPending = false;
+  _portalState          = WM_PORTAL_SERVING;
 
-  while (_configPortalTimeout == 0 || millis() < _configPortalStart + _configPortalTimeout)
+  if (nonBlocking)
   {
-    //DNS
-    dnsServer->processNextRequest();
-    //HTTP
-    server->handleClient();
+    LOGINFO("ESP_WiFiManager::startConfigPortal : Run by process()");
 
-    if (connect)
-    {
-      TimedOut = false;
-      delay(2000);
+    return true;
+  }
 
-      LOGERROR(F("Connecting to new AP"));
+  LOGINFO("ESP_WiFiManager::startConfigPortal : Enter loop");
 
-#if 0
+  while (processConfigPortal())
+  {
+    yield();
+  }
 
-      // New Mod from v1.1.0
-      int wifiConnected = reconnectWifi();
-          
-      if ( wifiConnected == WL_CONNECTED )
-      {
-        //notify that configuration has changed and any optional parameters should be saved
-        if (_savecallback != NULL)
-        {
-          //todo: check if any custom parameters actually exist, and check if they really changed maybe
-          _savecallback();
-        }
-        
-        break;
-      }
-      
-      WiFi.mode(WIFI_AP); // Dual mode becomes flaky if not connected to a WiFi network.
-      //////
+  return  WiFi.status() == WL_CONNECTED;
+}
 
-#else
+//////////////////////////////////////////
 
-      // using user-provided  _ssid, _pass in place of system-stored ssid and pass
-      if (connectWifi(_ssid, _pass) != WL_CONNECTED)
-      {  
-        LOGERROR(F("Failed to connect"));
-    
-        WiFi.mode(WIFI_AP); // Dual mode becomes flaky if not connected to a WiFi network.
-      }
-      else
-      {
-        //notify that configuration has changed and any optional parameters should be saved
-        if (_savecallback != NULL)
-        {
-          //todo: check if any custom parameters actually exist, and check if they really changed maybe
-          _savecallback();
-        }
-        break;
-      }
+// One slice of the config portal : one DNS request and one HTTP request at most, then the housekeeping.
+// False once the config portal has ended.
+bool ESP_WiFiManager::processConfigPortal()
+{
+  if (!configPortalActive())
+    return false;
 
+  //DNS
+  dnsServer->processNextRequest();
+  //HTTP
+  server->handleClient();
+
+#if USE_ASYNC_WIFI_SCAN
+  processScan();
 #endif
 
-      if (_shouldBreakAfterConfig)
+  if (connect)
+  {
+    // Connect once the save page has reached the client. The portal keeps running meanwhile.
+    connect               = false;
+    _portalSaved          = true;
+    _portalConnectPending = true;
+    _portalConnectAt      = millis();
+  }
+
+  if ( _portalConnectPending && (millis() - _portalConnectAt >= WM_SAVE_CONNECT_DELAY_MS) )
+  {
+    _portalConnectPending = false;
+
+    LOGERROR(F("Connecting to new AP"));
+
+    // using user-provided  _ssid, _pass in place of system-stored ssid and pass. The soft AP keeps serving
+    // meanwhile, and /connectstatus tells the save page how it goes.
+    _connectResultServed = 0;
+
+    if (beginConnect(_ssid, _pass))
+      _portalState = WM_PORTAL_CONNECTING;
+  }
+
+  processConnect();
+
+  if ( (_portalState == WM_PORTAL_CONNECTING) && (_connectState != WM_CONNECT_ASSOCIATING) && (_connectState != WM_CONNECT_DHCP) )
+  {
+    _portalState = WM_PORTAL_SERVING;
+
+    //not connected, WPS enabled, no pass - first attempt
+    if ( _tryWPS && (_connectState != WM_CONNECT_CONNECTED) && (_pass == "") )
+    {
+      startWPS();
+      //should be connected at the end of WPS
+      _connectState = (waitForConnectResult() == WL_CONNECTED) ? WM_CONNECT_CONNECTED : WM_CONNECT_FAILED;
+    }
+
+    if (_connectState != WM_CONNECT_CONNECTED)
+    {  
+      LOGERROR(F("Failed to connect"));
+  
+      WiFi.mode(WIFI_AP); // Dual mode becomes flaky if not connected to a WiFi network.
+    }
+    else
+    {
+      //notify that configuration has changed and any optional parameters should be saved
+      if (_savecallback != NULL)
       {
-        //flag set to exit after config after trying to connect
-        //notify that configuration has changed and any optional parameters should be saved
-        if (_savecallback != NULL)
-        {
-          //todo: check if any custom parameters actually exist, and check if they really changed maybe
-          _savecallback();
-        }
-        
-        break;
+        //todo: check if any custom parameters actually exist, and check if they really changed maybe
+        _savecallback();
       }
+
+      _portalState   = WM_PORTAL_CLOSING;
+      _portalCloseAt = millis();
     }
 
-    if (stopConfigPortal)
+    if (_shouldBreakAfterConfig && (_portalState != WM_PORTAL_CLOSING))
     {
-      LOGERROR("Stop ConfigPortal");  	//KH
-     
-      stopConfigPortal = false;
-      break;
+      //flag set to exit after config after trying to connect
+      //notify that configuration has changed and any optional parameters should be saved
+      if (_savecallback != NULL)
+      {
+        //todo: check if any custom parameters actually exist, and check if they really changed maybe
+        _savecallback();
+      }
+      
+      _portalState   = WM_PORTAL_CLOSING;
+      _portalCloseAt = millis();
     }
-    
-    yield();
   }
 
+  // Stay until the browser got the result, and a little longer for the response to leave
+  if ( (_portalState == WM_PORTAL_CLOSING) && ( ( _connectResultServed && (millis() - _connectResultServed >= 500) ) ||
+                                                (millis() - _portalCloseAt >= WM_CONNECT_RESULT_GRACE_MS) ) )
+  {
+    endConfigPortal(WM_PORTAL_CLOSED);
+    return false;
+  }
+
+  if (stopConfigPortal)
+  {
+    LOGERROR("Stop ConfigPortal");  	//KH
+   
+    stopConfigPortal = false;
+    endConfigPortal(WM_PORTAL_CLOSED);
+    return false;
+  }
+
+  if ( (_configPortalTimeout != 0) && (millis() - _configPortalStart >= _configPortalTimeout) )
+  {
+    endConfigPortal(WM_PORTAL_TIMEOUT);
+    return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::endConfigPortal(WM_PortalState state)
+{
   WiFi.mode(WIFI_STA);
   
-  if (TimedOut)
+  // Back to the previous network if none was saved
+  if (!_portalSaved)
   {
     setHostname();
 
@@ -641,9 +776,14 @@ bool  ESP_WiFiManager::startConfigPortal(char const *apName, char const *apPassw
     setWifiStaticIP();
     
     WiFi.begin();
-    int connRes = waitForConnectResult();
 
-    LOGERROR1("Timed out connection result:", getStatus(connRes));
+    // Without blocking, WiFi.status() tells the sketch when it is connected
+    if (!_portalNonBlocking)
+    {
+      int connRes = waitForConnectResult();
+
+      LOGERROR1("Timed out connection result:", getStatus(connRes));
+    }
   }
 
   server->stop();
@@ -651,11 +791,161 @@ bool  ESP_WiFiManager::startConfigPortal(char const *apName, char const *apPassw
   dnsServer->stop();
   dnsServer.reset();
 
-  return  WiFi.status() == WL_CONNECTED;
+  _portalState = ( _portalSaved && (WiFi.status() == WL_CONNECTED) ) ? WM_PORTAL_CONNECTED : state;
+
+  LOGWARN1(F("Config portal ended, state ="), _portalState);
+}
+
+//////////////////////////////////////////
+
+#if USE_PORTAL_TASK
+bool ESP_WiFiManager::startConfigPortalTask(char const *apName, char const *apPassword)
+{
+  if (_portalTaskRunning.load())
+  {
+    LOGERROR(F("Portal task already running"));
+    return false;
+  }
+
+#if !WM_PORTAL_TASK_FREERTOS
+  // The thread of a portal which ended on its own ( timeout, save or /close ) is not joined yet
+  if (_portalThread.joinable())
+    _portalThread.join();
+#endif
+
+  if (!startConfigPortal(apName, apPassword, true))
+    return false;
+
+  _portalTaskRunning.store(true);
+
+#if WM_PORTAL_TASK_FREERTOS
+  if (xTaskCreatePinnedToCore(portalTaskEntry, "WM_Portal", WM_PORTAL_TASK_STACK_SIZE, this, WM_PORTAL_TASK_PRIORITY,
+                              &_portalTask, WM_PORTAL_TASK_CORE) != pdPASS)
+  {
+    _portalTaskRunning.store(false);
+
+    // Nothing would run the portal : the caller expects the task and does not call process()
+    LOGERROR(F("Can't create portal task"));
+
+    endConfigPortal(WM_PORTAL_CLOSED);
+    return false;
+  }
+#else
+  _portalThread = std::thread(portalTaskEntry, this);
+#endif
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+bool ESP_WiFiManager::stopConfigPortalTask()
+{
+  if (_portalTaskRunning.load())
+  {
+    std::lock_guard<std::mutex> lock(_portalMutex);
+
+    stopConfigPortal = true;
+  }
+
+#if WM_PORTAL_TASK_FREERTOS
+  // The task deletes itself once the portal has ended
+  if (!waitUntil([this]() { return !_portalTaskRunning.load(); }, WM_PORTAL_TASK_STOP_TIMEOUT_MS))
+  {
+    LOGERROR(F("Portal task not ended"));
+    return false;
+  }
+
+  _portalTask = NULL;
+#else
+  if (_portalThread.joinable())
+    _portalThread.join();
+#endif
+
+  return true;
 }
 
 //////////////////////////////////////////
 
+void ESP_WiFiManager::portalTaskEntry(void* manager)
+{
+  ((ESP_WiFiManager*) manager)->runPortalTask();
+
+#if WM_PORTAL_TASK_FREERTOS
+  vTaskDelete(NULL);
+#endif
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::runPortalTask()
+{
+  LOGWARN(F("Portal task started"));
+
+  WM_PortalState  state   = WM_PORTAL_IDLE;
+  bool            active  = true;
+
+  while (active)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_portalMutex);
+
+      active = processConfigPortal();
+
+      if (_portalState != state)
+      {
+        state = _portalState;
+
+        WM_PortalEvent event = { millis(), state };
+
+        if (!_portalEvents.push(event))
+        {
+          LOGDEBUG(F("Portal event queue full"));
+        }
+      }
+    }
+
+    // Lets the loop() task in, and any other of the same priority
+    delay(1);
+  }
+
+  LOGWARN(F("Portal task ended"));
+
+  _portalTaskRunning.store(false);
+}
+
+//////////////////////////////////////////
+
+// The single consumer of the portal events
+bool ESP_WiFiManager::getPortalEvent(WM_PortalEvent& event)
+{
+  return _portalEvents.pop(event);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::getConfigSnapshot(WM_ConfigSnapshot& snapshot)
+{
+  std::lock_guard<std::mutex> lock(_portalMutex);
+
+  memcpy(snapshot._credentials, _credentials, sizeof(_credentials));
+  snapshot._numCredentials  = _numCredentials;
+  snapshot._ssid            = _ssid;
+  snapshot._pass            = _pass;
+  snapshot._staIPConfig     = _WiFi_STA_IPconfig;
+  snapshot._numValues       = std::min(_paramsCount, WIFI_MANAGER_MAX_PARAMS);
+
+  for (int i = 0; i < snapshot._numValues; i++)
+  {
+    const char* value = _params[i]->getValue();
+
+    snapshot._values[i] = value ? value : "";
+  }
+}
+#endif
+
+//////////////////////////////////////////
+
 void ESP_WiFiManager::setWifiStaticIP()
 { 
 #if USE_CONFIGURABLE_DNS
@@ -704,25 +994,24 @@ void ESP_WiFiManager::setWifiStaticIP()
 //////////////////////////////////////////
 
 // New from v1.1.0
-int ESP_WiFiManager::reconnectWifi()
+int ESP_WiFiManager::connectKnown()
 {
-  int connectResult;
+  uint8_t order[WM_MAX_CREDENTIALS];
+  uint8_t count         = rankCredentials(order);
+  int     connectResult = WL_NO_SSID_AVAIL;
   
-  // using user-provided  _ssid, _pass in place of system-stored ssid and pass
-  if ( ( connectResult = connectWifi(_ssid, _pass) ) != WL_CONNECTED)
-  {  
-    LOGERROR1(F("Failed to connect to"), _ssid);
-    
-    if ( ( connectResult = connectWifi(_ssid1, _pass1) ) != WL_CONNECTED)
-    {  
-      LOGERROR1(F("Failed to connect to"), _ssid1);
+  for (uint8_t i = 0; i < count; i++)
+  {
+    const WM_Credential& credential = _credentials[order[i]];
 
+    if ( ( connectResult = connectWifi(credential._ssid, credential._pass) ) == WL_CONNECTED)
+    {
+      LOGERROR1(F("Connected to"), credential._ssid);
+      break;
     }
-    else
-      LOGERROR1(F("Connected to"), _ssid1);
+
+    LOGERROR1(F("Failed to connect to"), credential._ssid);
   }
-  else
-      LOGERROR1(F("Connected to"), _ssid);
   
   return connectResult;
 }
@@ -731,56 +1020,9 @@ int ESP_WiFiManager::reconnectWifi()
 
 int ESP_WiFiManager::connectWifi(String ssid, String pass)
 {
-  //KH, from v1.0.10.
-  // Add option if didn't input/update SSID/PW => Use the previous saved Credentials.
-  // But update the Static/DHCP options if changed.
-  if ( (ssid != "") || ( (ssid == "") && (WiFi_SSID() != "") ) )
-  {   
-    //fix for auto connect racing issue. Move up from v1.1.0 to avoid resetSettings()
-    if (WiFi.status() == WL_CONNECTED)
-    {
-      LOGWARN(F("Already connected. Bailing out."));
-      return WL_CONNECTED;
-    }
-  
-    if (ssid != "")
-      resetSettings();
+  beginConnect(ssid, pass);
 
-#ifdef ESP8266
-    setWifiStaticIP();
-#endif
-
-    WiFi.mode(WIFI_AP_STA); //It will start in station mode if it was previously in AP mode.
-
-    setHostname();
-    
-    // KH, Fix ESP32 staticIP after exiting CP, from v1.0.9
-#ifdef ESP32
-    setWifiStaticIP();
-#endif
-
-    if (ssid != "")
-    {
-      // Start Wifi with new values.
-      LOGWARN(F("Connect to new WiFi using new IP parameters"));
-      
-      WiFi.begin(ssid.c_str(), pass.c_str());
-    }
-    else
-    {
-      // Start Wifi with old values.
-      LOGWARN(F("Connect to previous WiFi using new IP parameters"));
-      
-      WiFi.begin();
-    }
-  }
-  else if (WiFi_SSID() == "")
-  {
-    LOGWARN(F("No saved credentials"));
-  }
-
-  int connRes = waitForConnectResult();
-  LOGWARN1("Connection result: ", getStatus(connRes));
+  int connRes = finishConnect();
 
   //not connected, WPS enabled, no pass - first attempt
   if (_tryWPS && connRes != WL_CONNECTED && pass == "")
@@ -795,1187 +1037,3717 @@ int ESP_WiFiManager::connectWifi(String ssid, String pass)
 
 //////////////////////////////////////////
 
-uint8_t ESP_WiFiManager::waitForConnectResult()
+// Blocking : run the connection started by beginConnect() to its end
+int ESP_WiFiManager::finishConnect()
 {
-  if (_connectTimeout == 0)
+  while ( (_connectState == WM_CONNECT_ASSOCIATING) || (_connectState == WM_CONNECT_DHCP) )
   {
-    unsigned long startedAt = millis();
-    
-    // In ESP8266, WiFi.waitForConnectResult() @return wl_status_t (0-255) or -1 on timeout !!!
-    // In ESP32, WiFi.waitForConnectResult() @return wl_status_t (0-255)
-    // So, using int for connRes to be safe
-    //int connRes = WiFi.waitForConnectResult();
-    WiFi.waitForConnectResult();
-    
-    float waited = (millis() - startedAt);
-
-    LOGWARN1(F("Connected after waiting (s) :"), waited / 1000);
-    LOGWARN1(F("Local ip ="), WiFi.localIP());
-
-    // Fix bug from v1.1.0+, connRes is sometimes not correct.
-    //return connRes;
-    return WiFi.status();
+    delay(10);
+    process();
   }
-  else
-  {
-    LOGERROR(F("Waiting WiFi connection with time out"));
-    unsigned long start = millis();
-    bool keepConnecting = true;
-    uint8_t status;
-
-    while (keepConnecting)
-    {
-      status = WiFi.status();
-      if (millis() > start + _connectTimeout)
-      {
-        keepConnecting = false;
-        LOGERROR(F("Connection timed out"));
-      }
 
-      if (status == WL_CONNECTED || status == WL_CONNECT_FAILED)
-      {
-        keepConnecting = false;
-      }
-      delay(100);
-    }
-    return status;
-  }
+  return _connectResult;
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::startWPS()
+int ESP_WiFiManager::connectBest()
 {
-#ifdef ESP8266
-  LOGINFO("START WPS");
-  WiFi.beginWPSConfig();
-  LOGINFO("END WPS");
-#else		//ESP32
-  // TODO
-  LOGINFO("ESP32 WPS TODO");
-#endif
+  if (!beginConnectBest())
+    return _connectResult;
+
+  return finishConnect();
 }
 
 //////////////////////////////////////////
 
-//Convenient for debugging but wasteful of program space.
-//Remove if short of space
-const char* ESP_WiFiManager::getStatus(int status)
+bool ESP_WiFiManager::beginConnectBest()
 {
-  switch (status)
+  const WM_ScanResult* results;
+
+  // One scan for all the known networks, findScanResult() below looks into it
+  getScanResults(&results);
+
+  const WM_Credential* best        = NULL;
+  int                  bestRSSI    = 0;
+  bool                 bestFailing = false;
+  uint32_t             attempt     = lastCredentialAttempt() + 1;
+
+  for (uint8_t i = 0; i < _numCredentials; i++)
   {
-    case WL_IDLE_STATUS:
-      return "WL_IDLE_STATUS";
-    case WL_NO_SSID_AVAIL:
-      return "WL_NO_SSID_AVAIL";
-    case WL_CONNECTED:
-      return "WL_CONNECTED";
-    case WL_CONNECT_FAILED:
-      return "WL_CONNECT_FAILED";
-    case WL_DISCONNECTED:
-      return "WL_DISCONNECTED";
-    default:
-      return "UNKNOWN";
+    const WM_Credential& credential = _credentials[i];
+    const WM_ScanResult* result     = findScanResult(credential._ssid);
+
+    if (!result)
+      continue;
+
+    bool failing  = credentialFailing(credential, attempt);
+    bool better   = !best || (bestFailing && !failing);
+
+    if ( best && (failing == bestFailing) )
+    {
+      better = (credential._priority > best->_priority) ||
+               ( (credential._priority == best->_priority) && (result->_rssi > bestRSSI) );
+    }
+
+    if (better)
+    {
+      best        = &credential;
+      bestRSSI    = result->_rssi;
+      bestFailing = failing;
+    }
   }
-}
 
-//////////////////////////////////////////
+  if (!best)
+  {
+    LOGWARN(F("No known network in range"));
 
-String ESP_WiFiManager::getConfigPortalSSID()
-{
-  return _apName;
-}
+    endConnect(WM_CONNECT_FAILED, WL_NO_SSID_AVAIL);
+    return false;
+  }
 
-//////////////////////////////////////////
+  LOGWARN3(F("Best known network :"), best->_ssid, F(", RSSI ="), bestRSSI);
 
-String ESP_WiFiManager::getConfigPortalPW()
-{
-  return _apPassword;
+  return beginConnect(best->_ssid, best->_pass);
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::resetSettings()
+int ESP_WiFiManager::findCredential(const char* ssid)
 {
-  LOGINFO(F("Previous settings invalidated"));
-  
-#ifdef ESP8266  
-  WiFi.disconnect(true);
-#else
-  WiFi.disconnect(true, true);
-  // New in v1.0.11
-  // Temporary fix for issue of not clearing WiFi SSID/PW from flash of ESP32
-  // See https://github.com/khoih-prog/ESP_WiFiManager/issues/25 and https://github.com/espressif/arduino-esp32/issues/400
-  WiFi.begin("0","0");
-  //////
-#endif
+  for (uint8_t i = 0; i < _numCredentials; i++)
+  {
+    if (strcmp(_credentials[i]._ssid, ssid) == 0)
+      return i;
+  }
 
-  delay(200);
-  return;
+  return -1;
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::setTimeout(unsigned long seconds)
+// Insert after the entries of higher or same priority
+bool ESP_WiFiManager::insertCredential(const WM_Credential& credential)
 {
-  setConfigPortalTimeout(seconds);
-}
+  if (_numCredentials >= WM_MAX_CREDENTIALS)
+    return false;
 
-//////////////////////////////////////////
+  uint8_t i = _numCredentials;
 
-void ESP_WiFiManager::setConfigPortalTimeout(unsigned long seconds)
-{
-  _configPortalTimeout = seconds * 1000;
-}
+  for ( ; (i > 0) && (_credentials[i - 1]._priority < credential._priority); i--)
+    _credentials[i] = _credentials[i - 1];
 
-//////////////////////////////////////////
+  _credentials[i] = credential;
+  _numCredentials++;
 
-void ESP_WiFiManager::setConnectTimeout(unsigned long seconds)
-{
-  _connectTimeout = seconds * 1000;
+  return true;
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::setDebugOutput(bool debug)
+// Order of the attempts of connectKnown() : the networks which keep failing last, then by priority, then by score.
+// All the known networks are in order, the table order is kept among equals.
+uint8_t ESP_WiFiManager::rankCredentials(uint8_t* order)
 {
-  _debug = debug;
-}
+  uint32_t  attempt = lastCredentialAttempt() + 1;
+  uint32_t  scores[WM_MAX_CREDENTIALS];
+  bool      failing[WM_MAX_CREDENTIALS];
 
-//////////////////////////////////////////
+  for (uint8_t i = 0; i < _numCredentials; i++)
+  {
+    order[i]    = i;
+    scores[i]   = credentialScore(_credentials[i]);
+    failing[i]  = credentialFailing(_credentials[i], attempt);
+  }
 
-// KH, new from v1.0.10 to enable dynamic/random channel
-int ESP_WiFiManager::setConfigPortalChannel(int channel)
-{
-  // If channel < MIN_WIFI_CHANNEL - 1 or channel > MAX_WIFI_CHANNEL => channel = 1
-  // If channel == 0 => will use random channel from MIN_WIFI_CHANNEL to MAX_WIFI_CHANNEL
-  // If (MIN_WIFI_CHANNEL <= channel <= MAX_WIFI_CHANNEL) => use it
-  if ( (channel < MIN_WIFI_CHANNEL - 1) || (channel > MAX_WIFI_CHANNEL) )
-    _WiFiAPChannel = 1;
-  else if ( (channel >= MIN_WIFI_CHANNEL - 1) && (channel <= MAX_WIFI_CHANNEL) )
-    _WiFiAPChannel = channel;
+  // Insertion sort, the table is small and already in priority order
+  for (uint8_t i = 1; i < _numCredentials; i++)
+  {
+    uint8_t index = order[i];
+    uint8_t j     = i;
 
-  return _WiFiAPChannel;
-}
+    for ( ; j > 0; j--)
+    {
+      uint8_t previous = order[j - 1];
+      bool    before;
 
-//////////////////////////////////////////
+      if (failing[index] != failing[previous])
+        before = !failing[index];
+      else if (_credentials[index]._priority != _credentials[previous]._priority)
+        before = (_credentials[index]._priority > _credentials[previous]._priority);
+      else
+        before = (scores[index] > scores[previous]);
 
-void ESP_WiFiManager::setAPStaticIPConfig(IPAddress ip, IPAddress gw, IPAddress sn)
-{
-  LOGINFO(F("setAPStaticIPConfig"));
-  _WiFi_AP_IPconfig._ap_static_ip = ip;
-  _WiFi_AP_IPconfig._ap_static_gw = gw;
-  _WiFi_AP_IPconfig._ap_static_sn = sn;
-}
+      if (!before)
+        break;
 
-//////////////////////////////////////////
+      order[j] = previous;
+    }
 
-// New in v1.4.0
-void ESP_WiFiManager::setAPStaticIPConfig(WiFi_AP_IPConfig  WM_AP_IPconfig)
-{
-  LOGINFO(F("setAPStaticIPConfig"));
-  
-  memcpy(&_WiFi_AP_IPconfig, &WM_AP_IPconfig, sizeof(_WiFi_AP_IPconfig));
-}
+    order[j] = index;
+  }
 
-//////////////////////////////////////////
+  for (uint8_t i = 0; i < _numCredentials; i++)
+  {
+    LOGINFO3(F("Rank"), i, F(":"), _credentials[order[i]]._ssid);
+  }
 
-void ESP_WiFiManager::getAPStaticIPConfig(WiFi_AP_IPConfig  &WM_AP_IPconfig)
-{
-  LOGINFO(F("getAPStaticIPConfig"));
-  
-  memcpy(&WM_AP_IPconfig, &_WiFi_AP_IPconfig, sizeof(WM_AP_IPconfig));
+  return _numCredentials;
 }
-//////
+
 //////////////////////////////////////////
 
-void ESP_WiFiManager::setSTAStaticIPConfig(IPAddress ip, IPAddress gw, IPAddress sn)
+// Number of the last connection attempt to any known network
+uint32_t ESP_WiFiManager::lastCredentialAttempt()
 {
-  LOGINFO(F("setSTAStaticIPConfig"));
-  _WiFi_STA_IPconfig._sta_static_ip = ip;
-  _WiFi_STA_IPconfig._sta_static_gw = gw;
-  _WiFi_STA_IPconfig._sta_static_sn = sn;
-}
+  uint32_t attempt = 0;
 
-//////////////////////////////////////////
-// New in v1.4.0
+  for (uint8_t i = 0; i < _numCredentials; i++)
+    attempt = std::max(attempt, _credentials[i]._stats._lastAttempt);
 
-void ESP_WiFiManager::setSTAStaticIPConfig(WiFi_STA_IPConfig WM_STA_IPconfig)
-{
-  LOGINFO(F("setSTAStaticIPConfig"));
-  
-  memcpy(&_WiFi_STA_IPconfig, &WM_STA_IPconfig, sizeof(_WiFi_STA_IPconfig));
+  return attempt;
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::getSTAStaticIPConfig(WiFi_STA_IPConfig &WM_STA_IPconfig)
+// Failed WM_CREDENTIAL_FAIL_STREAK times in a row, and not yet due for another try
+bool ESP_WiFiManager::credentialFailing(const WM_Credential& credential, uint32_t attempt)
 {
-  LOGINFO(F("getSTAStaticIPConfig"));
-  
-  memcpy(&WM_STA_IPconfig, &_WiFi_STA_IPconfig, sizeof(WM_STA_IPconfig));
-}
-//////
-//////////////////////////////////////////
+  const WM_CredentialStats& stats = credential._stats;
 
-#if USE_CONFIGURABLE_DNS
-void ESP_WiFiManager::setSTAStaticIPConfig(IPAddress ip, IPAddress gw, IPAddress sn, IPAddress dns_address_1, IPAddress dns_address_2)
-{
-  LOGINFO(F("setSTAStaticIPConfig for USE_CONFIGURABLE_DNS"));
-  _WiFi_STA_IPconfig._sta_static_ip = ip;
-  _WiFi_STA_IPconfig._sta_static_gw = gw;
-  _WiFi_STA_IPconfig._sta_static_sn = sn;
-  _WiFi_STA_IPconfig._sta_static_dns1 = dns_address_1; //***** Added argument *****
-  _WiFi_STA_IPconfig._sta_static_dns2 = dns_address_2; //***** Added argument *****
+  return (stats._failStreak >= WM_CREDENTIAL_FAIL_STREAK) && (attempt - stats._lastAttempt < WM_CREDENTIAL_RETRY_EVERY);
 }
-#endif
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::setMinimumSignalQuality(int quality)
+// Success rate over the expected time of an attempt, which orders the attempts for the shortest expected time to a
+// connection. One success and one failure are assumed on top of the counts, so a new network gets a fair chance.
+uint32_t ESP_WiFiManager::credentialScore(const WM_Credential& credential)
 {
-  _minimumQuality = quality;
-}
+  const WM_CredentialStats& stats = credential._stats;
 
-//////////////////////////////////////////
+  uint64_t successes    = stats._successes + 1;
+  uint64_t failures     = stats._failures + 1;
+  uint64_t successTime  = medianConnectTime(stats);
+  uint64_t failureTime  = (_connectTimeout != 0) ? _connectTimeout : WM_CONNECT_TIMEOUT_MS;
 
-void ESP_WiFiManager::setBreakAfterConfig(bool shouldBreak)
-{
-  _shouldBreakAfterConfig = shouldBreak;
+  if (successTime == 0)
+    successTime = WM_CONNECT_TIME_DEFAULT_MS;
+
+  return (uint32_t) ( (successes * 1000000ULL) / (successes * successTime + failures * failureTime) );
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::reportStatus(String &page)
+uint16_t ESP_WiFiManager::medianConnectTime(const WM_CredentialStats& stats)
 {
-  page += FPSTR(WM_HTTP_SCRIPT_NTP_MSG);
+  uint16_t times[WM_CONNECT_TIME_SAMPLES];
+  uint8_t  count = 0;
 
-  if (WiFi_SSID() != "")
+  for (uint8_t i = 0; i < WM_CONNECT_TIME_SAMPLES; i++)
   {
-    page += F("Configured to connect to access point <b>");
-    page += WiFi_SSID();
+    if (stats._connectTimes[i] == 0)
+      continue;
 
-    if (WiFi.status() == WL_CONNECTED)
-    {
-      page += F(" and currently connected</b> on IP <a href=\"http://");
-      page += WiFi.localIP().toString();
-      page += F("/\">");
-      page += WiFi.localIP().toString();
-      page += F("</a>");
-    }
-    else
-    {
-      page += F(" but not currently connected</b> to network.");
-    }
-  }
-  else
-  {
-    page += F("No network currently configured.");
+    uint8_t j = count++;
+
+    for ( ; (j > 0) && (times[j - 1] > stats._connectTimes[i]); j--)
+      times[j] = times[j - 1];
+
+    times[j] = stats._connectTimes[i];
   }
+
+  if (count == 0)
+    return 0;
+
+  if (count & 1)
+    return times[count / 2];
+
+  return (times[count / 2 - 1] + times[count / 2]) / 2;
 }
 
 //////////////////////////////////////////
 
-/** Handle root or redirect to captive portal */
-void ESP_WiFiManager::handleRoot()
+// Learn from the attempt which just ended, if it was to a known network
+void ESP_WiFiManager::updateCredentialStats(bool success)
 {
-  LOGDEBUG(F("Handle root"));
+  int index = findCredential(_connectSSID.c_str());
 
-  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
-  _configPortalTimeout = 0;		//KH
+  if (index < 0)
+    return;
 
-  if (captivePortal())
+  WM_CredentialStats& stats = _credentials[index]._stats;
+
+  stats._lastAttempt = lastCredentialAttempt() + 1;
+
+  if (success)
   {
-    // If caprive portal redirect instead of displaying the error page.
-    return;
+    unsigned long connectTime = std::max(std::min(millis() - _connectBegin, 65535UL), 1UL);
+    uint8_t       next        = stats._nextTime % WM_CONNECT_TIME_SAMPLES;
+
+    stats._successes++;
+    stats._failStreak         = 0;
+    stats._lastSuccess        = stats._lastAttempt;
+    stats._lastRSSI           = WiFi.RSSI();
+    stats._connectTimes[next] = connectTime;
+    stats._nextTime           = (next + 1) % WM_CONNECT_TIME_SAMPLES;
   }
+  else
+  {
+    stats._failures++;
 
-  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+    if (stats._failStreak < 255)
+      stats._failStreak++;
+  }
 
-#if USING_CORS_FEATURE
-  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
-  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
-#endif
-    
-  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
-  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+  if (stats._successes + stats._failures > WM_CREDENTIAL_HISTORY)
+  {
+    stats._successes  /= 2;
+    stats._failures   /= 2;
+  }
 
-  String page = FPSTR(WM_HTTP_HEAD_START);
-  
-  page.replace("{v}", "Options");
-  page += FPSTR(WM_HTTP_SCRIPT);
-  page += FPSTR(WM_HTTP_SCRIPT_NTP);
-  page += FPSTR(WM_HTTP_STYLE);
-  page += _customHeadElement;
-  page += FPSTR(WM_HTTP_HEAD_END);
-  page += FPSTR(WM_HTTP_PORTAL_OPTIONS);
-  //page += F("<div class=\"msg\">");
-  //reportStatus(page);
-  //page += F("</div>");
-  page += FPSTR(WM_HTTP_END);
+  LOGINFO3(F("Stats of"), _credentials[index]._ssid, F(", successes ="), stats._successes);
+  LOGINFO3(F("failures ="), stats._failures, F(", median ms ="), medianConnectTime(stats));
+
+  if (_credentialscallback != NULL)
+  {
+    _credentialscallback();
+  }
+}
+
+//////////////////////////////////////////
+
+bool ESP_WiFiManager::addCredential(const char* ssid, const char* pass, uint8_t priority)
+{
+  WM_Credential credential;
 
-  server->send(200, "text/html", page);
+  if ( !ssid || (ssid[0] == 0) || (strlen(ssid) >= sizeof(credential._ssid)) )
+    return false;
 
+  if (!pass)
+    pass = "";
+
+  if (strlen(pass) >= sizeof(credential._pass))
+    return false;
+
+  memset(&credential, 0, sizeof(credential));
+  strcpy(credential._ssid, ssid);
+  strcpy(credential._pass, pass);
+  credential._priority = priority;
+
+  // Same network, what was learned about it still holds
+  int index = findCredential(ssid);
+
+  if ( (index >= 0) && (strcmp(_credentials[index]._pass, pass) == 0) )
+    credential._stats = _credentials[index]._stats;
+
+  return addCredential(credential);
 }
 
 //////////////////////////////////////////
 
-/** Wifi config page handler */
-void ESP_WiFiManager::handleWifi()
+bool ESP_WiFiManager::addCredential(const WM_Credential& credential)
 {
-  LOGDEBUG(F("Handle WiFi"));
+  // Copied, as it may be an entry of the table
+  WM_Credential added = credential;
 
-  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
-  _configPortalTimeout = 0;		//KH
-  
-  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+  added._ssid[sizeof(added._ssid) - 1] = 0;
+  added._pass[sizeof(added._pass) - 1] = 0;
 
-#if USING_CORS_FEATURE
-  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
-  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+  if (added._ssid[0] == 0)
+    return false;
+
+  // Replaced, so that it moves with its new priority
+  removeCredential(added._ssid);
+
+  if (!insertCredential(added))
+  {
+    LOGWARN1(F("Credential table full, not added :"), added._ssid);
+    return false;
+  }
+
+  LOGINFO3(F("Credential added :"), added._ssid, F(", priority ="), added._priority);
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+bool ESP_WiFiManager::removeCredential(const char* ssid)
+{
+  int index = findCredential(ssid);
+
+  if (index < 0)
+    return false;
+
+  for (uint8_t i = index; i < _numCredentials - 1; i++)
+    _credentials[i] = _credentials[i + 1];
+
+  _numCredentials--;
+
+  // No password left behind in RAM
+  memset(&_credentials[_numCredentials], 0, sizeof(WM_Credential));
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+bool ESP_WiFiManager::setCredentialPriority(const char* ssid, uint8_t priority)
+{
+  int index = findCredential(ssid);
+
+  if (index < 0)
+    return false;
+
+  WM_Credential credential = _credentials[index];
+
+  credential._priority = priority;
+
+  removeCredential(ssid);
+  insertCredential(credential);
+  memset(&credential, 0, sizeof(credential));
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::clearCredentials()
+{
+  memset(_credentials, 0, sizeof(_credentials));
+  _numCredentials = 0;
+}
+
+//////////////////////////////////////////
+
+// Start a connection to ssid, or to the saved credentials if ssid is empty, and return at once.
+// process() then follows it. False if there is nothing to connect to.
+bool ESP_WiFiManager::beginConnect(const String& ssid, const String& pass)
+{
+#if USE_WIFI_EVENTS
+  // Older events belong to the previous connection
+  processWiFiEvents();
 #endif
-    
-  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
-  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
-  
-  String page = FPSTR(WM_HTTP_HEAD_START);
-  
-  page.replace("{v}", "Config ESP");
-  page += FPSTR(WM_HTTP_SCRIPT);
-  page += FPSTR(WM_HTTP_SCRIPT_NTP);
-  page += FPSTR(WM_HTTP_STYLE);
-  page += _customHeadElement;
-  page += FPSTR(WM_HTTP_HEAD_END);
-  //page += F("<h2>WiFi Ayarları</h2>");
 
-  //  KH, New, v1.0.6+
-  numberOfNetworks = scanWifiNetworks(&networkIndices);
+  _connectBegin   = millis();
+  _connectHinted  = false;
+  _connectFailure = WM_FAIL_NONE;
+  _connectAbort   = false;
 
-  //Print list of WiFi networks that were found in earlier scan
-  if (numberOfNetworks == 0)
+#if USE_RTC_FAST_CONNECT
+  _fastConnectStats._tried = false;
+  _fastConnectStats._hit   = false;
+#endif
+
+  //KH, from v1.0.10.
+  // Add option if didn't input/update SSID/PW => Use the previous saved Credentials.
+  // But update the Static/DHCP options if changed.
+  if ( (ssid == "") && (WiFi_SSID() == "") )
   {
-    page += F("WiFi scan found no networks. Restart configuration portal to scan again.");
+    LOGWARN(F("No saved credentials"));
+
+    endConnect(WM_CONNECT_FAILED, WiFi.status());
+    return false;
   }
-  else
+
+  //fix for auto connect racing issue. Move up from v1.1.0 to avoid resetSettings()
+  if (WiFi.status() == WL_CONNECTED)
   {
-    // From v1.0.10
-    page += FPSTR(WM_FLDSET_BORDER_START);
-    //////
-    
-    //display networks in page
-    for (int i = 0; i < numberOfNetworks; i++)
-    {
-      if (networkIndices[i] == -1)
-        continue; // skip dups and those that are below the required quality
-      
-      LOGDEBUG1(F("Index ="), i);
-      LOGDEBUG1(F("SSID ="), WiFi.SSID(networkIndices[i]));
-      LOGDEBUG1(F("RSSI ="), WiFi.RSSI(networkIndices[i]));
+    LOGWARN(F("Already connected. Bailing out."));
+
+    endConnect(WM_CONNECT_CONNECTED, WL_CONNECTED);
+    return true;
+  }
 
-      int quality = getRSSIasQuality(WiFi.RSSI(networkIndices[i]));
+  // Kept for a retry without BSSID
+  _connectSSID = (ssid != "") ? ssid : WiFi_SSID();
+  _connectPass = (ssid != "") ? pass : WiFi_Pass();
 
-      String item = FPSTR(WM_HTTP_ITEM);
-      String rssiQ;
-      rssiQ += quality;
-      item.replace("{v}", WiFi.SSID(networkIndices[i]));
-      item.replace("{r}", rssiQ);
+  if (ssid != "")
+    resetSettings();
 
 #ifdef ESP8266
-      if (WiFi.encryptionType(networkIndices[i]) != ENC_TYPE_NONE)
-#else		//ESP32
-      if (WiFi.encryptionType(networkIndices[i]) != WIFI_AUTH_OPEN)
+  setWifiStaticIP();
 #endif
-      {
-        item.replace("{i}", "l");
-      }
-      else
-      {
-        item.replace("{i}", "");
-      }
 
-      //LOGDEBUG(item);
-      page += item;
-      delay(0);
+  WiFi.mode(WIFI_AP_STA); //It will start in station mode if it was previously in AP mode.
+
+  setHostname();
+  
+  // KH, Fix ESP32 staticIP after exiting CP, from v1.0.9
+#ifdef ESP32
+  setWifiStaticIP();
+#endif
+
+#if USE_RTC_FAST_CONNECT_IP
+  // The lease of an earlier fast connect is only for its AP, beginFastConnect() sets it again if it is that one
+  if (_fastConnectIP)
+    restoreDHCP();
+#endif
+
+  if (ssid != "")
+  {
+    // Start Wifi with new values.
+    LOGWARN(F("Connect to new WiFi using new IP parameters"));
+
+#if USE_SCANNED_BSSID
+    // Go straight to the strongest BSSID seen by the Config Portal scan, on its channel
+    const WM_ScanResult* scanned = findScanResult(ssid.c_str());
+
+    if (scanned && scanned->_channel)
+    {
+      LOGWARN1(F("Using scanned BSSID on channel"), scanned->_channel);
+
+      beginHinted(ssid, pass, scanned->_channel, scanned->_bssid);
+      _connectHinted = true;
     }
-    
-    // From v1.0.10
-    page += FPSTR(WM_FLDSET_END);
-    //////
+#endif
+  }
+  else
+  {
+    // Start Wifi with old values.
+    LOGWARN(F("Connect to previous WiFi using new IP parameters"));
+  }
+
+#if USE_RTC_FAST_CONNECT
+  if (!_connectHinted)
+    _connectHinted = beginFastConnect(_connectSSID, _connectPass);
+#endif
+
+  if (!_connectHinted)
+  {
+    if (ssid != "")
+      WiFi.begin(ssid.c_str(), pass.c_str());
+    else
+      WiFi.begin();
+  }
+
+  _connectState = WM_CONNECT_ASSOCIATING;
+  _connectStart = millis();
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+// Follow the connection started by beginConnect(), and run the config portal started with nonBlocking.
+// To be called from loop() until it is connected or failed, and the portal has ended.
+void ESP_WiFiManager::process()
+{
+#if USE_PORTAL_TASK
+  // Both are run by the portal task
+  if (_portalTaskRunning.load())
+    return;
+#endif
+
+  // The config portal follows the connection itself
+  if (_portalNonBlocking && processConfigPortal())
+    return;
+
+  processConnect();
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::processConnect()
+{
+#if USE_WIFI_EVENTS
+  processWiFiEvents();
+#endif
 
-    page += "<br/>";
+  // Still polled, for the timeouts and the failures the events do not tell
+  if ( (_connectState != WM_CONNECT_ASSOCIATING) && (_connectState != WM_CONNECT_DHCP) )
+    return;
+
+  int status = WiFi.status();
+
+  if (status == WL_CONNECTED)
+  {
+    endConnect(WM_CONNECT_CONNECTED, status);
+    return;
   }
 
-  page += FPSTR(WM_HTTP_FORM_START);
-  char parLength[2];
-  
-  page += FPSTR(WM_FLDSET_START);
-  
-  // add the extra parameters to the form
-  for (int i = 0; i < _paramsCount; i++)
+  unsigned long timeout = (_connectTimeout != 0) ? _connectTimeout : WM_CONNECT_TIMEOUT_MS;
+
+  // A wrong hint only delays the association
+  if ( _connectHinted && (_connectState == WM_CONNECT_ASSOCIATING) )
+    timeout = std::min(timeout, (unsigned long) WM_HINTED_ASSOCIATE_TIMEOUT_MS);
+
+  WM_ConnectFailure statusFailure = failureOfStatus(status);
+
+  if ( (statusFailure == WM_FAIL_NONE) && !_connectAbort && (millis() - _connectStart < timeout) )
   {
-    if (_params[i] == NULL)
+    // The RSSI of the AP is known once associated, only the IP is missing then
+    if ( (_connectState == WM_CONNECT_ASSOCIATING) && (WiFi.RSSI() < 0) )
     {
-      break;
+      LOGDEBUG(F("Associated, waiting for IP"));
+
+      _connectState = WM_CONNECT_DHCP;
     }
-    
-    String pitem;
-    switch (_params[i]->getLabelPlacement())
+
+    return;
+  }
+
+  if (statusFailure != WM_FAIL_NONE)
+    _connectFailure = statusFailure;
+  else if (_connectState == WM_CONNECT_DHCP)
+    _connectFailure = WM_FAIL_DHCP_TIMEOUT;
+  else if (!_connectAbort)
+    _connectFailure = WM_FAIL_TIMEOUT;
+
+  // Another BSSID will not make a wrong password right
+  if ( _connectHinted && (_connectFailure != WM_FAIL_AUTH) )
+  {
+    // The AP may have changed channel, or another BSSID of the SSID may do. Let the driver search.
+    LOGWARN1(F("No connection with BSSID hint, retry with any BSSID. Status ="), getStatus(status));
+
+#if USE_RTC_FAST_CONNECT
+    if (_fastConnectStats._tried)
+      missFastConnect();
+#endif
+
+    // The SSID and password are given again, so the BSSID is not kept in the driver configuration
+    WiFi.begin(_connectSSID.c_str(), _connectPass.c_str());
+
+    _connectHinted  = false;
+    _connectFailure = WM_FAIL_NONE;
+    _connectAbort   = false;
+    _connectState   = WM_CONNECT_ASSOCIATING;
+    _connectStart   = millis();
+
+    return;
+  }
+
+  LOGERROR1(F("Connection failed :"), getStatus(_connectFailure));
+
+  endConnect(WM_CONNECT_FAILED, status);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::endConnect(WM_ConnectState state, int result)
+{
+  // Not when bailing out before WiFi.begin()
+  bool attempted  = (_connectState == WM_CONNECT_ASSOCIATING) || (_connectState == WM_CONNECT_DHCP);
+
+  // Connected with the hint : the credentials are saved without it
+  if ( _connectHinted && (state == WM_CONNECT_CONNECTED) )
+    storeCredentials(_connectSSID, _connectPass);
+
+  _connectEnd     = millis();
+  _connectState   = state;
+  _connectResult  = result;
+  _connectPass    = "";
+
+  LOGWARN3(F("Connection result:"), getStatus(result), F(", time (ms) ="), millis() - _connectBegin);
+
+#if USE_RTC_FAST_CONNECT
+  // Hinted still means that the first attempt succeeded
+  _fastConnectStats._hit = _fastConnectStats._tried && _connectHinted && (state == WM_CONNECT_CONNECTED);
+
+  bool lease = !_WiFi_STA_IPconfig._sta_static_ip;
+
+#if USE_RTC_FAST_CONNECT_IP
+  if (_fastConnectIP && (state == WM_CONNECT_CONNECTED))
+  {
+    WM_RTCFastConnect cache;
+
+    readFastConnect(cache);
+
+    // Reconnected by the driver to another AP, or to another SSID : the IP given by the cache is not its lease
+    if (!fastConnectAP(cache))
     {
-      case WFM_LABEL_BEFORE:
-        pitem = FPSTR(WM_HTTP_FORM_LABEL_BEFORE);
-        break;
-      case WFM_LABEL_AFTER:
-        pitem = FPSTR(WM_HTTP_FORM_LABEL_AFTER);
-        break;
-      default:
-        // WFM_NO_LABEL
-        pitem = FPSTR(WM_HTTP_FORM_PARAM);
-        break;
+      restoreDHCP();
+      lease = false;
     }
+  }
+#endif
+
+  if (state == WM_CONNECT_CONNECTED)
+    saveFastConnect(lease);
+
+  _fastConnectStats._connectTime = millis() - _connectBegin;
+
+  LOGWARN1(F("Fast connect :"), _fastConnectStats._tried ? (_fastConnectStats._hit ? "hit" : "miss") : "no hints");
+#endif
+
+  if (attempted)
+    updateCredentialStats(state == WM_CONNECT_CONNECTED);
+}
+
+//////////////////////////////////////////
+
+// A BSSID given to WiFi.begin() is saved with the credentials, and the WiFi driver then only connects to it : in its
+// reconnections, WiFi.begin() without arguments and at the next boots, even once that AP is gone. It is not written
+// to flash, and storeCredentials() removes it once connected.
+void ESP_WiFiManager::beginHinted(const String& ssid, const String& pass, int32_t channel, const uint8_t* bssid)
+{
+#ifdef ESP8266
+  WiFi.persistent(false);
+  WiFi.begin(ssid.c_str(), pass.c_str(), channel, bssid);
+  WiFi.persistent(true);
+#else		//ESP32
+  // WiFi.persistent() is only read when the WiFi driver starts, the storage of the driver decides the NVS writes
+  esp_wifi_set_storage(WIFI_STORAGE_RAM);
+  WiFi.begin(ssid.c_str(), pass.c_str(), channel, bssid);
+  esp_wifi_set_storage(WIFI_STORAGE_FLASH);
+#endif
+}
+
+//////////////////////////////////////////
+
+// Saves the credentials of the connection, without BSSID, and keeps the connection
+void ESP_WiFiManager::storeCredentials(const String& ssid, const String& pass)
+{
+#ifdef ESP8266
+  WiFi.begin(ssid.c_str(), pass.c_str(), 0, NULL, false);
+#else		//ESP32
+  // WiFi.begin() would disconnect to change the configuration
+  wifi_config_t conf;
+
+  (void) ssid;
+  (void) pass;
+
+  esp_wifi_get_config(WIFI_IF_STA, &conf);
+
+  conf.sta.bssid_set = 0;
+
+  esp_wifi_set_config(WIFI_IF_STA, &conf);
+#endif
+}
+
+//////////////////////////////////////////
+
+// Failure told by a disconnect reason of the WiFi driver. WM_FAIL_NONE for our own leave.
+WM_ConnectFailure ESP_WiFiManager::failureOfReason(uint8_t reason)
+{
+  switch (reason)
+  {
+    case WM_REASON_ASSOC_LEAVE:
+      return WM_FAIL_NONE;
+    case WM_REASON_AUTH_FAIL:
+    case WM_REASON_802_1X_AUTH_FAILED:
+      return WM_FAIL_AUTH;
+    case WM_REASON_NO_AP_FOUND:
+      return WM_FAIL_NO_AP;
+    case WM_REASON_4WAY_HANDSHAKE_TIMEOUT:
+    case WM_REASON_HANDSHAKE_TIMEOUT:
+      return WM_FAIL_HANDSHAKE;
+    case WM_REASON_ASSOC_FAIL:
+    case WM_REASON_ASSOC_TOOMANY:
+      return WM_FAIL_ASSOC_REJECT;
+    default:
+      return WM_FAIL_OTHER;
+  }
+}
+
+//////////////////////////////////////////
+
+// Failure told by WiFi.status(), WM_FAIL_NONE while the driver is still trying
+WM_ConnectFailure ESP_WiFiManager::failureOfStatus(int status)
+{
+  switch (status)
+  {
+    case WL_NO_SSID_AVAIL:
+      return WM_FAIL_NO_AP;
+#ifdef ESP8266
+    case WL_WRONG_PASSWORD:
+      return WM_FAIL_AUTH;
+#endif
+    case WL_CONNECT_FAILED:
+      return WM_FAIL_OTHER;
+    default:
+      return WM_FAIL_NONE;
+  }
+}
+
+//////////////////////////////////////////
+
+#if USE_WIFI_EVENTS
+
+// Register the station event handlers, once. Not in the constructor, the WiFi core may not be ready for a global object.
+void ESP_WiFiManager::startWiFiEvents()
+{
+  if (_wifiEventsStarted)
+    return;
+
+  _wifiEventsStarted = true;
+
+  // The handlers run in the WiFi task, they only queue the event
+#ifdef ESP8266
+  _staConnectedHandler = WiFi.onStationModeConnected([this](const WiFiEventStationModeConnected& event)
+  {
+    queueWiFiEvent(WM_EVENT_STA_CONNECTED, 0, event.channel);
+  });
+
+  _staGotIPHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP& event)
+  {
+    (void) event;
+    queueWiFiEvent(WM_EVENT_STA_GOT_IP, 0, 0);
+  });
+
+  _staDisconnectedHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected& event)
+  {
+    queueWiFiEvent(WM_EVENT_STA_DISCONNECTED, event.reason, 0);
+  });
+#else		//ESP32
+  _wifiEventId = WiFi.onEvent([this](WiFiEvent_t event, WiFiEventInfo_t info)
+  {
+    switch (event)
+    {
+      case WM_ESP32_STA_CONNECTED:
+        queueWiFiEvent(WM_EVENT_STA_CONNECTED, 0, info.WM_ESP32_CONNECTED_INFO.channel);
+        break;
+
+      case WM_ESP32_STA_GOT_IP:
+        queueWiFiEvent(WM_EVENT_STA_GOT_IP, 0, 0);
+        break;
+
+      case WM_ESP32_STA_DISCONNECTED:
+        queueWiFiEvent(WM_EVENT_STA_DISCONNECTED, info.WM_ESP32_DISCONNECTED_INFO.reason, 0);
+        break;
+
+      // Only waited for, by setupConfigPortal()
+      case WM_ESP32_AP_START:
+        _apStarted.store(true);
+        break;
+
+      default:
+        break;
+    }
+  });
+#endif
+}
+
+//////////////////////////////////////////
+
+// Producer side, in the WiFi task
+void ESP_WiFiManager::queueWiFiEvent(WM_WiFiEventType type, uint8_t reason, uint8_t channel)
+{
+  WM_WiFiEvent event;
+
+  event._time     = millis();
+  event._type     = type;
+  event._reason   = reason;
+  event._channel  = channel;
+
+  _wifiEvents.push(event);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::processWiFiEvents()
+{
+  WM_WiFiEvent event;
+
+  startWiFiEvents();
+
+  while (_wifiEvents.pop(event))
+    handleWiFiEvent(event);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::handleWiFiEvent(const WM_WiFiEvent& event)
+{
+  switch (event._type)
+  {
+    case WM_EVENT_STA_CONNECTED:
+      LOGDEBUG1(F("WiFi event : associated, channel ="), event._channel);
+
+      if (_connectState == WM_CONNECT_ASSOCIATING)
+        _connectState = WM_CONNECT_DHCP;
+
+      break;
+
+    case WM_EVENT_STA_GOT_IP:
+      LOGDEBUG(F("WiFi event : got IP"));
+
+      if ( (_connectState == WM_CONNECT_ASSOCIATING) || (_connectState == WM_CONNECT_DHCP) )
+      {
+        endConnect(WM_CONNECT_CONNECTED, WL_CONNECTED);
+      }
+      else
+      {
+        // Connected without beginConnect(), or reconnected by the WiFi driver after a failure
+        _connectState   = WM_CONNECT_CONNECTED;
+        _connectResult  = WL_CONNECTED;
+      }
+
+      break;
+
+    case WM_EVENT_STA_DISCONNECTED:
+      LOGWARN1(F("WiFi event : disconnected, reason ="), event._reason);
+
+      if ( (_connectState == WM_CONNECT_ASSOCIATING) || (_connectState == WM_CONNECT_DHCP) )
+      {
+        WM_ConnectFailure failure = failureOfReason(event._reason);
+
+        if (failure != WM_FAIL_NONE)
+          _connectFailure = failure;
+
+#if WM_FAIL_FAST
+        // The driver would only retry the same way until the timeout
+        if ( (failure != WM_FAIL_NONE) && (failure != WM_FAIL_OTHER) )
+          _connectAbort = true;
+#endif
+      }
+      else if (_connectState == WM_CONNECT_CONNECTED)
+      {
+        // Link lost. The WiFi driver reconnects by itself, which is followed as a new connection from now on.
+        _connectState   = WM_CONNECT_ASSOCIATING;
+        _connectResult  = WL_CONNECTION_LOST;
+        _connectBegin   = event._time;
+        _connectStart   = event._time;
+        _connectHinted  = false;
+      }
+
+      break;
+  }
+
+  if (_wifiEventCallback != NULL)
+    _wifiEventCallback(event);
+}
+
+#endif
+
+
+//////////////////////////////////////////
+
+#if USE_RTC_FAST_CONNECT
+
+#ifdef ESP32
+// Not initialized at reset, so it survives ESP.restart() and deep sleep
+static RTC_NOINIT_ATTR WM_RTCFastConnect WM_rtcFastConnect;
+#endif
+
+// Read the fast connect hints, or empty ones if RTC memory holds anything else
+void ESP_WiFiManager::readFastConnect(WM_RTCFastConnect& cache)
+{
+  bool valid;
+
+#ifdef ESP8266
+  valid = ESP.rtcUserMemoryRead(WM_RTC_FAST_CONNECT_ADDRESS, (uint32_t*) &cache, sizeof(cache));
+#else		//ESP32
+  cache = WM_rtcFastConnect;
+  valid = true;
+#endif
+
+  valid = valid && (cache._magic == WM_RTC_FAST_CONNECT_MAGIC) &&
+          (cache._checksum == tagOf(WM_TAG_INIT, &cache._ssidHash, sizeof(cache) - offsetof(WM_RTCFastConnect, _ssidHash)));
+
+  if (!valid)
+  {
+    LOGDEBUG(F("No fast connect hints in RTC memory"));
+
+    memset(&cache, 0, sizeof(cache));
+  }
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::writeFastConnect(WM_RTCFastConnect& cache)
+{
+  cache._magic    = WM_RTC_FAST_CONNECT_MAGIC;
+  cache._checksum = tagOf(WM_TAG_INIT, &cache._ssidHash, sizeof(cache) - offsetof(WM_RTCFastConnect, _ssidHash));
+
+#ifdef ESP8266
+  ESP.rtcUserMemoryWrite(WM_RTC_FAST_CONNECT_ADDRESS, (uint32_t*) &cache, sizeof(cache));
+#else		//ESP32
+  WM_rtcFastConnect = cache;
+#endif
+
+  _fastConnectStats._hits   = cache._hits;
+  _fastConnectStats._misses = cache._misses;
+}
+
+//////////////////////////////////////////
+
+// Start a directed connection to the BSSID and channel of the last one to ssid. False if there is no hint for it.
+bool ESP_WiFiManager::beginFastConnect(const String& ssid, const String& pass)
+{
+  WM_RTCFastConnect cache;
+
+  readFastConnect(cache);
+
+  if ( (cache._channel == 0) || (cache._ssidHash != tagOf(WM_TAG_INIT, ssid)) )
+    return false;
+
+#if USE_RTC_FAST_CONNECT_IP
+  // Last DHCP lease as static IP, unless the sketch configured one
+  if (cache._hasIP && !_WiFi_STA_IPconfig._sta_static_ip)
+  {
+    LOGWARN1(F("Fast connect with IP"), IPAddress(cache._ip));
+
+    WiFi.config(IPAddress(cache._ip), IPAddress(cache._gateway), IPAddress(cache._netmask), IPAddress(cache._dns1), IPAddress(cache._dns2));
+
+    _fastConnectIP = true;
+  }
+#endif
+
+  LOGWARN1(F("Fast connect on channel"), cache._channel);
+
+  beginHinted(ssid, pass, cache._channel, cache._bssid);
+
+  _fastConnectStats._tried = true;
+
+  return true;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::missFastConnect()
+{
+  WM_RTCFastConnect cache;
+
+  readFastConnect(cache);
+
+  cache._misses++;
+  cache._channel  = 0;
+  cache._hasIP    = 0;
+
+  writeFastConnect(cache);
+
+#if USE_RTC_FAST_CONNECT_IP
+  // Back to DHCP, the lease may be what changed
+  if (_fastConnectIP)
+    restoreDHCP();
+#endif
+}
+
+#if USE_RTC_FAST_CONNECT_IP
+//////////////////////////////////////////
+
+// Connected to the SSID and BSSID of the hints
+bool ESP_WiFiManager::fastConnectAP(const WM_RTCFastConnect& cache)
+{
+  uint8_t* bssid = WiFi.BSSID();
+
+  return bssid && (memcmp(bssid, cache._bssid, sizeof(cache._bssid)) == 0) &&
+         (cache._ssidHash == tagOf(WM_TAG_INIT, WiFi.SSID()));
+}
+
+//////////////////////////////////////////
+
+// Back to DHCP from the lease set by beginFastConnect(). A static IP of the sketch is never replaced by one.
+void ESP_WiFiManager::restoreDHCP()
+{
+  LOGWARN(F("Fast connect IP dropped, back to DHCP"));
+
+  WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+
+  _fastConnectIP = false;
+}
+#endif
+
+//////////////////////////////////////////
+
+// Keep the BSSID and channel of the established connection, and its DHCP lease if lease, for the next boot
+void ESP_WiFiManager::saveFastConnect(bool lease)
+{
+  WM_RTCFastConnect cache;
+
+  readFastConnect(cache);
+
+  if (_fastConnectStats._hit)
+    cache._hits++;
+
+  uint8_t* bssid = WiFi.BSSID();
+
+  cache._ssidHash = tagOf(WM_TAG_INIT, WiFi.SSID());
+  cache._channel  = WiFi.channel();
+
+  if (bssid)
+    memcpy(cache._bssid, bssid, sizeof(cache._bssid));
+  else
+    cache._channel = 0;
+
+  // A static IP of the sketch is not a lease
+  cache._hasIP    = lease;
+  cache._ip       = WiFi.localIP();
+  cache._gateway  = WiFi.gatewayIP();
+  cache._netmask  = WiFi.subnetMask();
+  cache._dns1     = WiFi.dnsIP(0);
+  cache._dns2     = WiFi.dnsIP(1);
+
+  writeFastConnect(cache);
+}
+
+#endif
+
+//////////////////////////////////////////
+
+uint8_t ESP_WiFiManager::waitForConnectResult()
+{
+  if (_connectTimeout == 0)
+  {
+    unsigned long startedAt = millis();
+    
+    // In ESP8266, WiFi.waitForConnectResult() @return wl_status_t (0-255) or -1 on timeout !!!
+    // In ESP32, WiFi.waitForConnectResult() @return wl_status_t (0-255)
+    // So, using int for connRes to be safe
+    //int connRes = WiFi.waitForConnectResult();
+    WiFi.waitForConnectResult();
+    
+    float   waited = (millis() - startedAt);
+    uint8_t status = WiFi.status();
+
+    if (status == WL_CONNECTED)
+    {
+      LOGWARN1(F("Connected after waiting (s) :"), waited / 1000);
+      LOGWARN1(F("Local ip ="), WiFi.localIP());
+    }
+    else
+    {
+      LOGWARN3(F("Not connected after waiting (s) :"), waited / 1000, F(", status ="), getStatus(status));
+    }
+
+    // Fix bug from v1.1.0+, connRes is sometimes not correct.
+    //return connRes;
+    return status;
+  }
+  else
+  {
+    LOGERROR(F("Waiting WiFi connection with time out"));
+    unsigned long start = millis();
+    bool keepConnecting = true;
+    uint8_t status;
+
+    while (keepConnecting)
+    {
+      status = WiFi.status();
+      if (millis() > start + _connectTimeout)
+      {
+        keepConnecting = false;
+        LOGERROR(F("Connection timed out"));
+      }
+
+      if ( (status == WL_CONNECTED) || (failureOfStatus(status) != WM_FAIL_NONE) )
+      {
+        keepConnecting = false;
+      }
+      delay(100);
+    }
+    return status;
+  }
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::startWPS()
+{
+#ifdef ESP8266
+  LOGINFO("START WPS");
+  WiFi.beginWPSConfig();
+  LOGINFO("END WPS");
+#else		//ESP32
+  // TODO
+  LOGINFO("ESP32 WPS TODO");
+#endif
+}
+
+//////////////////////////////////////////
+
+//Convenient for debugging but wasteful of program space.
+//Remove if short of space
+const char* ESP_WiFiManager::getStatus(int status)
+{
+  switch (status)
+  {
+    case WL_IDLE_STATUS:
+      return "WL_IDLE_STATUS";
+    case WL_NO_SSID_AVAIL:
+      return "WL_NO_SSID_AVAIL";
+    case WL_CONNECTED:
+      return "WL_CONNECTED";
+    case WL_CONNECT_FAILED:
+      return "WL_CONNECT_FAILED";
+    case WL_DISCONNECTED:
+      return "WL_DISCONNECTED";
+    case WL_CONNECTION_LOST:
+      return "WL_CONNECTION_LOST";
+#ifdef ESP8266
+    case WL_WRONG_PASSWORD:
+      return "WL_WRONG_PASSWORD";
+#endif
+    default:
+      return "UNKNOWN";
+  }
+}
+
+//////////////////////////////////////////
+
+const char* ESP_WiFiManager::getStatus(WM_ConnectFailure failure)
+{
+  switch (failure)
+  {
+    case WM_FAIL_NONE:
+      return "";
+    case WM_FAIL_AUTH:
+      return "Wrong password";
+    case WM_FAIL_NO_AP:
+      return "Network not found";
+    case WM_FAIL_HANDSHAKE:
+      return "Handshake timeout, wrong password?";
+    case WM_FAIL_ASSOC_REJECT:
+      return "Rejected by the access point";
+    case WM_FAIL_DHCP_TIMEOUT:
+      return "No IP address from DHCP";
+    case WM_FAIL_TIMEOUT:
+      return "Timeout";
+    default:
+      return "Disconnected";
+  }
+}
+
+//////////////////////////////////////////
+
+String ESP_WiFiManager::getConfigPortalSSID()
+{
+  return _apName;
+}
+
+//////////////////////////////////////////
+
+String ESP_WiFiManager::getConfigPortalPW()
+{
+  return _apPassword;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::resetSettings()
+{
+  LOGINFO(F("Previous settings invalidated"));
+  
+#ifdef ESP8266  
+  WiFi.disconnect(true);
+#else
+  WiFi.disconnect(true, true);
+  // New in v1.0.11
+  // Temporary fix for issue of not clearing WiFi SSID/PW from flash of ESP32
+  // See https://github.com/khoih-prog/ESP_WiFiManager/issues/25 and https://github.com/espressif/arduino-esp32/issues/400
+  WiFi.begin("0","0");
+  //////
+#endif
+
+  waitUntil([]() { return WiFi.status() != WL_CONNECTED; }, WM_DISCONNECT_TIMEOUT_MS);
+  return;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setTimeout(unsigned long seconds)
+{
+  setConfigPortalTimeout(seconds);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setConfigPortalTimeout(unsigned long seconds)
+{
+  _configPortalTimeout = seconds * 1000;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setConnectTimeout(unsigned long seconds)
+{
+  _connectTimeout = seconds * 1000;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setDebugOutput(bool debug)
+{
+  _debug = debug;
+}
+
+//////////////////////////////////////////
+
+// KH, new from v1.0.10 to enable dynamic/random channel
+int ESP_WiFiManager::setConfigPortalChannel(int channel)
+{
+  // If channel < MIN_WIFI_CHANNEL - 1 or channel > MAX_WIFI_CHANNEL => channel = 1
+  // If channel == 0 => will use random channel from MIN_WIFI_CHANNEL to MAX_WIFI_CHANNEL
+  // If (MIN_WIFI_CHANNEL <= channel <= MAX_WIFI_CHANNEL) => use it
+  if ( (channel < MIN_WIFI_CHANNEL - 1) || (channel > MAX_WIFI_CHANNEL) )
+    _WiFiAPChannel = 1;
+  else if ( (channel >= MIN_WIFI_CHANNEL - 1) && (channel <= MAX_WIFI_CHANNEL) )
+    _WiFiAPChannel = channel;
+
+  return _WiFiAPChannel;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setAPStaticIPConfig(IPAddress ip, IPAddress gw, IPAddress sn)
+{
+  LOGINFO(F("setAPStaticIPConfig"));
+  _WiFi_AP_IPconfig._ap_static_ip = ip;
+  _WiFi_AP_IPconfig._ap_static_gw = gw;
+  _WiFi_AP_IPconfig._ap_static_sn = sn;
+}
+
+//////////////////////////////////////////
+
+// New in v1.4.0
+void ESP_WiFiManager::setAPStaticIPConfig(WiFi_AP_IPConfig  WM_AP_IPconfig)
+{
+  LOGINFO(F("setAPStaticIPConfig"));
+  
+  _WiFi_AP_IPconfig = WM_AP_IPconfig;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::getAPStaticIPConfig(WiFi_AP_IPConfig  &WM_AP_IPconfig)
+{
+  LOGINFO(F("getAPStaticIPConfig"));
+  
+  WM_AP_IPconfig = _WiFi_AP_IPconfig;
+}
+//////
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setSTAStaticIPConfig(IPAddress ip, IPAddress gw, IPAddress sn)
+{
+  LOGINFO(F("setSTAStaticIPConfig"));
+  _WiFi_STA_IPconfig._sta_static_ip = ip;
+  _WiFi_STA_IPconfig._sta_static_gw = gw;
+  _WiFi_STA_IPconfig._sta_static_sn = sn;
+}
+
+//////////////////////////////////////////
+// New in v1.4.0
+
+void ESP_WiFiManager::setSTAStaticIPConfig(WiFi_STA_IPConfig WM_STA_IPconfig)
+{
+  LOGINFO(F("setSTAStaticIPConfig"));
+  
+  _WiFi_STA_IPconfig = WM_STA_IPconfig;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::getSTAStaticIPConfig(WiFi_STA_IPConfig &WM_STA_IPconfig)
+{
+  LOGINFO(F("getSTAStaticIPConfig"));
+  
+  WM_STA_IPconfig = _WiFi_STA_IPconfig;
+}
+//////
+//////////////////////////////////////////
+
+#if USE_CONFIGURABLE_DNS
+void ESP_WiFiManager::setSTAStaticIPConfig(IPAddress ip, IPAddress gw, IPAddress sn, IPAddress dns_address_1, IPAddress dns_address_2)
+{
+  LOGINFO(F("setSTAStaticIPConfig for USE_CONFIGURABLE_DNS"));
+  _WiFi_STA_IPconfig._sta_static_ip = ip;
+  _WiFi_STA_IPconfig._sta_static_gw = gw;
+  _WiFi_STA_IPconfig._sta_static_sn = sn;
+  _WiFi_STA_IPconfig._sta_static_dns1 = dns_address_1; //***** Added argument *****
+  _WiFi_STA_IPconfig._sta_static_dns2 = dns_address_2; //***** Added argument *****
+}
+#endif
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setMinimumSignalQuality(int quality)
+{
+  _minimumQuality = quality;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setBreakAfterConfig(bool shouldBreak)
+{
+  _shouldBreakAfterConfig = shouldBreak;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::reportStatus()
+{
+  pageContent_P(WM_HTTP_SCRIPT_NTP_MSG);
+
+  if (WiFi_SSID() != "")
+  {
+    pageContent(F("Configured to connect to access point <b>"));
+    pageEscaped(WiFi_SSID().c_str(), WM_ESCAPE_HTML);
+
+    if (WiFi.status() == WL_CONNECTED)
+    {
+      String localIP = WiFi.localIP().toString();
+
+      pageContent(F(" and currently connected</b> on IP <a href=\"http://"));
+      pageContent(localIP);
+      pageContent(F("/\">"));
+      pageContent(localIP);
+      pageContent(F("</a>"));
+    }
+    else
+    {
+      pageContent(F(" but not currently connected</b> to network."));
+    }
+  }
+  else
+  {
+    pageContent(F("No network currently configured."));
+  }
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::beginPage(int code, const char* contentType)
+{
+#if USE_CHUNKED_PORTAL_PAGES
+  _pageChunkLen = 0;
+
+  // Unknown length => ESP8266WebServer / WebServer use "Transfer-Encoding: chunked" for HTTP/1.1 clients
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(code, contentType, "");
+#else
+  _pageCode         = code;
+  _pageContentType  = contentType;
+  _page             = "";
+#endif
+}
+
+//////////////////////////////////////////
+
+// Common head of every Config Portal page
+void ESP_WiFiManager::pageHead(const char* title)
+{
+  WM_TemplateSlot slots[] = { { "v", title, WM_ESCAPE_HTML } };
+
+  pageTemplate_P(WM_HTTP_HEAD_START, slots, 1);
+  
+#if USE_PORTAL_ASSETS
+  // Only the versioned links go into the page, the browser caches the assets themselves
+  slots[0]._value = WM_ASSET_WM_JS_VERSION;
+  pageTemplate_P(WM_HTTP_SCRIPT_ASSET, slots, 1);
+  
+#if WM_ASSET_TZ_JS_ENABLED
+  slots[0]._value = WM_ASSET_TZ_JS_VERSION;
+  pageTemplate_P(WM_HTTP_SCRIPT_NTP_ASSET, slots, 1);
+#else
+  pageContent_P(WM_HTTP_SCRIPT_NTP);
+#endif
+  
+  slots[0]._value = WM_ASSET_WM_CSS_VERSION;
+  pageTemplate_P(WM_HTTP_STYLE_ASSET, slots, 1);
+  pageContent(_customHeadElement);
+  
+  slots[0]._value = WM_ASSET_LOGO_PNG_VERSION;
+  pageTemplate_P(WM_HTTP_HEAD_END_ASSET, slots, 1);
+#else
+  pageContent_P(WM_HTTP_SCRIPT);
+  pageContent_P(WM_HTTP_SCRIPT_NTP);
+  pageContent_P(WM_HTTP_STYLE);
+  pageContent(_customHeadElement);
+  pageContent_P(WM_HTTP_HEAD_END);
+#endif
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::pageContent(const char* content, size_t len)
+{
+#if USE_CHUNKED_PORTAL_PAGES
+  while (len > 0)
+  {
+    size_t toCopy = std::min(len, (size_t) (WM_PAGE_CHUNK_SIZE - _pageChunkLen));
+
+    memcpy(&_pageChunk[_pageChunkLen], content, toCopy);
+
+    _pageChunkLen += toCopy;
+    content       += toCopy;
+    len           -= toCopy;
+
+    if (_pageChunkLen == WM_PAGE_CHUNK_SIZE)
+      flushPageChunk();
+  }
+#else
+  _page.reserve(_page.length() + len);
+
+  while (len--)
+    _page += *content++;
+#endif
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::pageContent(const char* content)
+{
+  if (content != NULL)
+    pageContent(content, strlen(content));
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::pageContent(const String& content)
+{
+  pageContent(content.c_str(), content.length());
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::pageContent(const __FlashStringHelper* content)
+{
+  pageContent_P((PGM_P) content);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::pageContent_P(PGM_P content, size_t len)
+{
+#if USE_CHUNKED_PORTAL_PAGES
+  // Copy straight from flash into the chunk buffer, no temporary String
+  while (len > 0)
+  {
+    size_t toCopy = std::min(len, (size_t) (WM_PAGE_CHUNK_SIZE - _pageChunkLen));
+
+    memcpy_P(&_pageChunk[_pageChunkLen], content, toCopy);
+
+    _pageChunkLen += toCopy;
+    content       += toCopy;
+    len           -= toCopy;
+
+    if (_pageChunkLen == WM_PAGE_CHUNK_SIZE)
+      flushPageChunk();
+  }
+#else
+  _page.reserve(_page.length() + len);
+
+  while (len--)
+    _page += (char) pgm_read_byte(content++);
+#endif
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::pageContent_P(PGM_P content)
+{
+  pageContent_P(content, strlen_P(content));
+}
+
+//////////////////////////////////////////
+
+// Write value, escaped for the context it is inserted in.
+// Runs of characters which need no escaping are written at once.
+void ESP_WiFiManager::pageEscaped(const char* value, WM_Escape escape)
+{
+  if (value == NULL)
+    return;
+
+  if (escape == WM_ESCAPE_NONE)
+  {
+    pageContent(value);
+    return;
+  }
+
+  const char* run = value;
+
+  for (const char* c = value; *c != 0; c++)
+  {
+    const char* replacement = NULL;
+    char        unicodeEscape[7];
+
+    if (escape == WM_ESCAPE_HTML)
+    {
+      switch (*c)
+      {
+        case '&':   replacement = "&amp;";  break;
+        case '<':   replacement = "&lt;";   break;
+        case '>':   replacement = "&gt;";   break;
+        case '"':   replacement = "&quot;"; break;
+        case '\'':  replacement = "&#39;";  break;
+        default:                            break;
+      }
+    }
+    else
+    {
+      // WM_ESCAPE_JSON
+      if (*c == '"')
+        replacement = "\\\"";
+      else if (*c == '\\')
+        replacement = "\\\\";
+      else if ((uint8_t) *c < 0x20)
+      {
+        snprintf(unicodeEscape, sizeof(unicodeEscape), "\\u%04x", (uint8_t) *c);
+        replacement = unicodeEscape;
+      }
+    }
+
+    if (replacement != NULL)
+    {
+      pageContent(run, c - run);
+      pageContent(replacement);
+      run = c + 1;
+    }
+  }
+
+  pageContent(run, strlen(run));
+}
+
+//////////////////////////////////////////
+
+// Render a PROGMEM template in a single pass: literal runs are copied from flash as they are found,
+// {name} slots are replaced by their (escaped) values. Unknown slots are written unchanged.
+// No intermediate String is built, whatever the number of slots.
+void ESP_WiFiManager::pageTemplate_P(PGM_P pageTemplate, const WM_TemplateSlot* slots, uint8_t numSlots)
+{
+  PGM_P literal = pageTemplate;
+  PGM_P c       = pageTemplate;
+  char  ch;
+
+  while ( (ch = pgm_read_byte(c)) != 0 )
+  {
+    if (ch != '{')
+    {
+      c++;
+      continue;
+    }
+
+    // Read the slot name, up to WM_TEMPLATE_MAX_SLOT_NAME chars before the closing brace
+    char    name[WM_TEMPLATE_MAX_SLOT_NAME + 1];
+    uint8_t nameLen = 0;
+    PGM_P   end     = c + 1;
+
+    while ( (nameLen < WM_TEMPLATE_MAX_SLOT_NAME) && ((ch = pgm_read_byte(end)) != 0) && (ch != '}') && (ch != '{') )
+    {
+      name[nameLen++] = ch;
+      end++;
+    }
+
+    name[nameLen] = 0;
+
+    const WM_TemplateSlot* slot = NULL;
+
+    if ( (nameLen > 0) && (pgm_read_byte(end) == '}') )
+    {
+      for (uint8_t i = 0; i < numSlots; i++)
+      {
+        if (strcmp(slots[i]._name, name) == 0)
+        {
+          slot = &slots[i];
+          break;
+        }
+      }
+    }
+
+    if (slot == NULL)
+    {
+      // Not a slot we know, keep it as literal text
+      c++;
+      continue;
+    }
+
+    pageContent_P(literal, c - literal);
+    pageEscaped(slot->_value, slot->_escape);
+
+    c       = end + 1;
+    literal = c;
+  }
+
+  pageContent_P(literal, c - literal);
+}
+
+//////////////////////////////////////////
+
+// "Static IP" style label + input of the Config Portal form
+void ESP_WiFiManager::pageStaticIPField(const char* id, const char* label, IPAddress ip)
+{
+  String value = ip.toString();
+
+  WM_TemplateSlot slots[] =
+  {
+    { "i", id,            WM_ESCAPE_HTML },
+    { "n", id,            WM_ESCAPE_HTML },
+    { "p", label,         WM_ESCAPE_HTML },
+    { "l", "15",          WM_ESCAPE_NONE },
+    { "v", value.c_str(), WM_ESCAPE_HTML },
+    { "c", "",            WM_ESCAPE_NONE }
+  };
+
+  pageTemplate_P(WM_HTTP_FORM_LABEL, slots, sizeof(slots) / sizeof(slots[0]));
+  pageTemplate_P(WM_HTTP_FORM_PARAM, slots, sizeof(slots) / sizeof(slots[0]));
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::endPage()
+{
+#if USE_CHUNKED_PORTAL_PAGES
+  flushPageChunk();
+
+  // Zero-length chunk terminates the response
+  server->sendContent("");
+#else
+  server->send(_pageCode, _pageContentType, _page);
+
+  // Release the page memory now, not at the next request
+  _page = String();
+#endif
+}
+
+//////////////////////////////////////////
+
+// Start an object ( '{' ) or array ( '[' ), as member "key" of the enclosing object if key != NULL
+void ESP_WiFiManager::jsonOpen(const char* key, char bracket)
+{
+  if (_jsonDepth == 0)
+    _jsonHasMember = 0;
+  else
+    jsonKey(key);
+
+  pageContent(&bracket, 1);
+
+  _jsonDepth++;
+  _jsonHasMember &= ~(1UL << _jsonDepth);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::jsonClose(char bracket)
+{
+  pageContent(&bracket, 1);
+
+  _jsonDepth--;
+}
+
+//////////////////////////////////////////
+
+// Separator, then "key": unless writing an array element
+void ESP_WiFiManager::jsonKey(const char* key)
+{
+  if (_jsonHasMember & (1UL << _jsonDepth))
+    pageContent(",", 1);
+
+  _jsonHasMember |= (1UL << _jsonDepth);
+
+  if (key == NULL)
+    return;
+
+  pageContent("\"", 1);
+  pageEscaped(key, WM_ESCAPE_JSON);
+  pageContent("\":", 2);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::jsonString(const char* key, const char* value)
+{
+  jsonKey(key);
+
+  pageContent("\"", 1);
+  pageEscaped(value, WM_ESCAPE_JSON);
+  pageContent("\"", 1);
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::jsonString(const char* key, const String& value)
+{
+  jsonString(key, value.c_str());
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::jsonBool(const char* key, bool value)
+{
+  jsonKey(key);
+
+  pageContent(value ? "true" : "false");
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::jsonNumber(const char* key, long value)
+{
+  char number[12];
+
+  jsonKey(key);
+
+  snprintf(number, sizeof(number), "%ld", value);
+  pageContent(number);
+}
+
+//////////////////////////////////////////
+
+#if USE_CHUNKED_PORTAL_PAGES
+void ESP_WiFiManager::flushPageChunk()
+{
+  // A zero-length chunk would end the response
+  if (_pageChunkLen == 0)
+    return;
+
+#ifdef ESP8266
+  server->sendContent(_pageChunk, _pageChunkLen);
+#else		//ESP32
+  server->sendContent_P(_pageChunk, _pageChunkLen);
+#endif
+
+  _pageChunkLen = 0;
+
+  yield();
+}
+#endif
+
+//////////////////////////////////////////
+
+uint32_t ESP_WiFiManager::tagOf(uint32_t tag, const void* data, size_t len)
+{
+  const uint8_t* bytes = (const uint8_t*) data;
+
+  while (len--)
+  {
+    tag ^= *bytes++;
+    tag *= 16777619UL;
+  }
+
+  return tag;
+}
+
+//////////////////////////////////////////
+
+uint32_t ESP_WiFiManager::tagOf(uint32_t tag, const char* value)
+{
+  // Keep the terminating 0, so that "ab" + "c" and "a" + "bc" differ
+  return value ? tagOf(tag, value, strlen(value) + 1) : tagOf(tag, "", 1);
+}
+
+//////////////////////////////////////////
+
+uint32_t ESP_WiFiManager::tagOf(uint32_t tag, const String& value)
+{
+  return tagOf(tag, value.c_str());
+}
+
+//////////////////////////////////////////
+
+uint32_t ESP_WiFiManager::tagOf(uint32_t tag, IPAddress ip)
+{
+  uint32_t address = (uint32_t) ip;
+
+  return tagOf(tag, &address, sizeof(address));
+}
+
+//////////////////////////////////////////
+
+#if USE_PORTAL_ETAG
+
+// Inputs common to the portal pages : custom head, parameters and IP config
+uint32_t ESP_WiFiManager::configTag()
+{
+  uint32_t tag = tagOf(WM_TAG_INIT, _customHeadElement);
+
+  for (int i = 0; i < _paramsCount; i++)
+  {
+    if (_params[i] == NULL)
+      break;
+
+    tag = tagOf(tag, _params[i]->getID());
+    tag = tagOf(tag, _params[i]->getValue());
+    tag = tagOf(tag, _params[i]->getPlaceholder());
+    tag = tagOf(tag, _params[i]->getCustomHTML());
+  }
+
+  tag = tagOf(tag, _WiFi_STA_IPconfig._sta_static_ip);
+  tag = tagOf(tag, _WiFi_STA_IPconfig._sta_static_gw);
+  tag = tagOf(tag, _WiFi_STA_IPconfig._sta_static_sn);
+  tag = tagOf(tag, _WiFi_STA_IPconfig._sta_static_dns1);
+  tag = tagOf(tag, _WiFi_STA_IPconfig._sta_static_dns2);
+  tag = tagOf(tag, _WiFi_AP_IPconfig._ap_static_ip);
+
+  // The saved networks listed on /wifi, not their passwords
+  for (uint8_t i = 0; i < _numCredentials; i++)
+  {
+    tag = tagOf(tag, _credentials[i]._ssid);
+    tag = tagOf(tag, &_credentials[i]._priority, sizeof(_credentials[i]._priority));
+  }
+
+  return tag;
+}
+
+//////////////////////////////////////////
+
+// Station and soft AP state, as shown in /i and /state
+uint32_t ESP_WiFiManager::connectionTag(uint32_t tag)
+{
+  uint8_t wifiStatus    = WiFi.status();
+  bool    hasPassword   = (WiFi.psk() != "");
+
+  tag = tagOf(tag, &wifiStatus, sizeof(wifiStatus));
+  tag = tagOf(tag, &hasPassword, sizeof(hasPassword));
+  tag = tagOf(tag, WiFi_SSID());
+  tag = tagOf(tag, WiFi.localIP());
+  tag = tagOf(tag, WiFi.softAPIP());
+  tag = tagOf(tag, &_connectState, sizeof(_connectState));
+  tag = tagOf(tag, &_connectFailure, sizeof(_connectFailure));
+
+  return tag;
+}
+
+//////////////////////////////////////////
+
+// Only what the pages show counts, so that RSSI jitter within the same quality does not change the tag
+void ESP_WiFiManager::updateScanTag()
+{
+  _scanTag = WM_TAG_INIT;
+
+  for (int i = 0; i < _numScanResults; i++)
+  {
+    const WM_ScanResult& result = _scanResults[i];
+
+    _scanTag = tagOf(_scanTag, result._ssid);
+    _scanTag = tagOf(_scanTag, &result._quality, sizeof(result._quality));
+    _scanTag = tagOf(_scanTag, &result._encryption, sizeof(result._encryption));
+    _scanTag = tagOf(_scanTag, result._bssid, sizeof(result._bssid));
+    _scanTag = tagOf(_scanTag, &result._channel, sizeof(result._channel));
+    _scanTag = tagOf(_scanTag, &result._numBSSIDs, sizeof(result._numBSSIDs));
+  }
+}
+
+//////////////////////////////////////////
+
+// Send the ETag of the page. Returns true, after an empty 304, if the client already has this version.
+bool ESP_WiFiManager::notModified(uint32_t tag)
+{
+  char etag[11];
+
+  tag = tagOf(tag, WM_TAG_BUILD);
+
+  snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long) tag);
+
+  server->sendHeader(FPSTR(WM_HTTP_ETAG), etag);
+
+  if (server->header(FPSTR(WM_HTTP_IF_NONE_MATCH)).indexOf(etag) < 0)
+    return false;
+
+  LOGDEBUG1(F("Not modified, ETag ="), etag);
+
+  server->send(304, FPSTR(WM_HTTP_HEAD_CT2), "");
+
+  return true;
+}
+
+#endif
+
+//////////////////////////////////////////
+
+/** Handle root or redirect to captive portal */
+void ESP_WiFiManager::handleRoot()
+{
+  LOGDEBUG(F("Handle root"));
+
+  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
+  _configPortalTimeout = 0;		//KH
+
+  if (captivePortal())
+  {
+    // If caprive portal redirect instead of displaying the error page.
+    return;
+  }
+
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_REVALIDATE));
+
+#if USING_CORS_FEATURE
+  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+    
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+#if USE_PORTAL_ETAG
+  if (notModified(configTag()))
+    return;
+#endif
+
+  beginPage(200, "text/html");
+  
+  pageHead("Options");
+  pageContent_P(WM_HTTP_PORTAL_OPTIONS);
+  //pageContent(F("<div class=\"msg\">"));
+  //reportStatus();
+  //pageContent(F("</div>"));
+  pageContent_P(WM_HTTP_END);
+
+  endPage();
+}
+
+//////////////////////////////////////////
+
+/** Wifi config page handler */
+void ESP_WiFiManager::handleWifi()
+{
+  LOGDEBUG(F("Handle WiFi"));
+
+  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
+  _configPortalTimeout = 0;		//KH
+  
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_REVALIDATE));
+
+#if USING_CORS_FEATURE
+  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+    
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+#if USE_ASYNC_WIFI_SCAN
+  // Shown from the scan results cache. A background scan is started if they are missing or too old. Meanwhile the
+  // previous results, even restored from RTC memory, are shown, or a waiting message reloading the page if none.
+  if (!scanResultsFresh())
+    startScan();
+
+  bool scanning = (_scanState == WM_SCAN_RUNNING) && (_numScanResults == 0);
+#else
+  //  KH, New, v1.0.6+
+  // Scan before the response is started, the client would otherwise wait on an open chunked stream
+  if (!scanResultsFresh())
+    scanNow();
+
+  bool scanning = false;
+#endif
+
+  _scanServed = true;
+
+  WM_ScanFilter filter;
+  String        ssidPrefix;
+  int           matched = 0;
+  int           shown   = 0;
+
+  parseScanFilter(filter, ssidPrefix, WM_WIFI_PAGE_SIZE);
+
+#if USE_PORTAL_ETAG
+  uint32_t tag = scanFilterTag(tagOf(configTag(), &_scanTag, sizeof(_scanTag)), filter);
+
+  if (notModified(tagOf(tag, &scanning, sizeof(scanning))))
+    return;
+#endif
+
+  beginPage(200, "text/html");
+  
+  pageHead("Config ESP");
+  //pageContent(F("<h2>WiFi Ayarları</h2>"));
+
+  //Print list of WiFi networks that were found in earlier scan
+  if (scanning)
+  {
+    pageContent_P(WM_HTTP_SCANNING);
+  }
+  else if (_numScanResults == 0)
+  {
+    pageContent(F("WiFi scan found no networks. Restart configuration portal to scan again."));
+  }
+  else
+  {
+    // From v1.0.10
+    pageContent_P(WM_FLDSET_BORDER_START);
+    //////
+    
+    //display networks in page
+    for (int i = 0; i < _numScanResults; i++)
+    {
+      const WM_ScanResult& result = _scanResults[i];
+
+      if ( !scanResultMatches(result, filter) || (matched++ < filter._offset) || (filter._limit && (shown >= filter._limit)) )
+        continue;
+
+      shown++;
+
+      LOGDEBUG1(F("Index ="), i);
+      LOGDEBUG1(F("SSID ="), result._ssid);
+      LOGDEBUG1(F("RSSI ="), result._rssi);
+
+      char quality[4];
+
+      snprintf(quality, sizeof(quality), "%d", result._quality);
+
+      WM_TemplateSlot slots[] =
+      {
+        { "v", result._ssid,  WM_ESCAPE_HTML },
+        { "r", quality,       WM_ESCAPE_NONE },
+#ifdef ESP8266
+        { "i", (result._encryption != ENC_TYPE_NONE)  ? "l" : "", WM_ESCAPE_NONE }
+#else		//ESP32
+        { "i", (result._encryption != WIFI_AUTH_OPEN) ? "l" : "", WM_ESCAPE_NONE }
+#endif
+      };
+
+      pageTemplate_P(WM_HTTP_ITEM, slots, sizeof(slots) / sizeof(slots[0]));
+      delay(0);
+    }
+
+    if (matched > filter._offset + shown)
+    {
+      char offset[12];
+      char limit[12];
+
+      snprintf(offset, sizeof(offset), "%d", filter._offset + shown);
+      snprintf(limit,  sizeof(limit),  "%d", filter._limit);
+
+      // The next page keeps the filter
+      String filterArgs;
+
+      appendFilterArgs(filterArgs);
+
+      WM_TemplateSlot slots[] =
+      {
+        { "o", offset,              WM_ESCAPE_NONE },
+        { "l", limit,               WM_ESCAPE_NONE },
+        { "f", filterArgs.c_str(),  WM_ESCAPE_HTML }
+      };
+
+      pageTemplate_P(WM_HTTP_MORE_NETWORKS, slots, sizeof(slots) / sizeof(slots[0]));
+    }
+    
+    // From v1.0.10
+    pageContent_P(WM_FLDSET_END);
+    //////
+
+    pageContent("<br/>");
+  }
+
+  if (_numCredentials > 0)
+  {
+    pageContent_P(WM_HTTP_CREDENTIALS_START);
+
+    for (uint8_t i = 0; i < _numCredentials; i++)
+    {
+      char priority[4];
+
+      snprintf(priority, sizeof(priority), "%d", _credentials[i]._priority);
+
+      WM_TemplateSlot slots[] =
+      {
+        { "v", _credentials[i]._ssid, WM_ESCAPE_HTML },
+        { "r", priority,              WM_ESCAPE_NONE }
+      };
+
+      pageTemplate_P(WM_HTTP_CREDENTIAL, slots, sizeof(slots) / sizeof(slots[0]));
+    }
+
+    pageContent_P(WM_FLDSET_END);
+    pageContent("<br/>");
+  }
+
+  pageContent_P(WM_HTTP_FORM_START);
+  char parLength[6];
+  
+  pageContent_P(WM_FLDSET_START);
+  
+  // add the extra parameters to the form
+  for (int i = 0; i < _paramsCount; i++)
+  {
+    if (_params[i] == NULL)
+    {
+      break;
+    }
+    
+    PGM_P pitem;
+    switch (_params[i]->getLabelPlacement())
+    {
+      case WFM_LABEL_BEFORE:
+        pitem = WM_HTTP_FORM_LABEL_BEFORE;
+        break;
+      case WFM_LABEL_AFTER:
+        pitem = WM_HTTP_FORM_LABEL_AFTER;
+        break;
+      default:
+        // WFM_NO_LABEL
+        pitem = WM_HTTP_FORM_PARAM;
+        break;
+    }
+
+    if (_params[i]->getID() != NULL)
+    {
+      snprintf(parLength, sizeof(parLength), "%d", _params[i]->getValueLength());
+
+      WM_TemplateSlot slots[] =
+      {
+        { "i", _params[i]->getID(),           WM_ESCAPE_HTML },
+        { "n", _params[i]->getID(),           WM_ESCAPE_HTML },
+        { "p", _params[i]->getPlaceholder(),  WM_ESCAPE_HTML },
+        { "l", parLength,                     WM_ESCAPE_NONE },
+        { "v", _params[i]->getValue(),        WM_ESCAPE_HTML },
+        { "c", _params[i]->getCustomHTML(),   WM_ESCAPE_NONE }
+      };
+
+      pageTemplate_P(pitem, slots, sizeof(slots) / sizeof(slots[0]));
+    }
+    else
+    {
+      pageContent(_params[i]->getCustomHTML());
+    }
+  }
+  
+  // From v1.0.10
+  if (_paramsCount > 0)
+  {
+    pageContent_P(WM_FLDSET_END);
+  }
+  //////
+
+  if (_params[0] != NULL)
+  {
+    pageContent("<br/>");
+  }
+
+  LOGDEBUG1(F("Static IP ="), _WiFi_STA_IPconfig._sta_static_ip.toString());
+  
+  // KH, Comment out in v1.0.9 to permit changing from DHCP to static IP, or vice versa
+  // and add staticIP label in CP
+  
+  // From v1.0.10 to permit disable/enable StaticIP configuration in Config Portal from sketch. Valid only if DHCP is used.
+  // You'll loose the feature of dynamically changing from DHCP to static IP, or vice versa
+  // You have to explicitly specify false to disable the feature.
+
+#if !USE_STATIC_IP_CONFIG_IN_CP
+  if (_WiFi_STA_IPconfig._sta_static_ip)
+#endif  
+  {
+    // From v1.0.10
+    pageContent_P(WM_FLDSET_START);
+    //////
+    
+    pageStaticIPField("ip", "Static IP",  _WiFi_STA_IPconfig._sta_static_ip);
+    pageStaticIPField("gw", "Gateway IP", _WiFi_STA_IPconfig._sta_static_gw);
+    pageStaticIPField("sn", "Subnet",     _WiFi_STA_IPconfig._sta_static_sn);
+
+  #if USE_CONFIGURABLE_DNS
+    //***** Added for DNS address options *****
+    pageStaticIPField("dns1", "DNS1 IP",  _WiFi_STA_IPconfig._sta_static_dns1);
+    pageStaticIPField("dns2", "DNS2 IP",  _WiFi_STA_IPconfig._sta_static_dns2);
+    //***** End added for DNS address options *****
+  #endif
+    
+    // From v1.0.10
+    pageContent_P(WM_FLDSET_END);
+    //////
+
+    pageContent("<br/>");
+  }
+
+  pageContent_P(WM_HTTP_FORM_END);
+
+  pageContent_P(WM_HTTP_END);
+
+  endPage();
+
+  LOGDEBUG(F("Sent config page"));
+}
+
+//////////////////////////////////////////
+
+/** Handle the WLAN save form and redirect to WLAN config page again */
+void ESP_WiFiManager::handleWifiSave()
+{
+  LOGDEBUG(F("WiFi save"));
+
+  // Obvious mistakes are told at once, before anything changes and while the portal is still up
+  if (server->arg("force") == "")
+  {
+    bool        canForce  = false;
+    const char* error     = checkCredentials(server->arg("s"), server->arg("p"), canForce);
+
+    if (error)
+    {
+      sendSaveError(error, canForce);
+      return;
+    }
+  }
+
+  //SAVE/connect here
+  _ssid = server->arg("s").c_str();
+  _pass = server->arg("p").c_str();
+
+  // New from v1.1.0
+  String ssid1 = server->arg("s1");
+  //////
+
+  // Known from now on, a known network keeping its priority. A new one replaces the last one, of lowest priority,
+  // when the table is full.
+  if (_ssid != "")
+  {
+    int index = findCredential(_ssid.c_str());
+
+    if ( (index < 0) && (_numCredentials == WM_MAX_CREDENTIALS) )
+      removeCredential(_credentials[_numCredentials - 1]._ssid);
+
+    addCredential(_ssid.c_str(), _pass.c_str(), (index >= 0) ? _credentials[index]._priority : 0);
+  }
+
+  if (ssid1 != "")
+  {
+    int index = findCredential(ssid1.c_str());
+
+    addCredential(ssid1.c_str(), server->arg("p1").c_str(), (index >= 0) ? _credentials[index]._priority : 0);
+  }
+  
+  //parameters
+  for (int i = 0; i < _paramsCount; i++)
+  {
+    if (_params[i] == NULL)
+    {
+      break;
+    }
+
+    //read parameter
+    String value = server->arg(_params[i]->getID()).c_str();
+    
+    //store it in array
+    // New in v1.4.0
+    value.toCharArray(_params[i]->_WMParam_data._value, _params[i]->_WMParam_data._length);
+    //////
+    
+    LOGDEBUG2(F("Parameter and value :"), _params[i]->getID(), value);
+  }
+
+  if (server->arg("ip") != "")
+  {
+    String ip = server->arg("ip");
+    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_ip, ip.c_str());
+    
+    LOGDEBUG1(F("New Static IP ="), _WiFi_STA_IPconfig._sta_static_ip.toString());
+  }
+
+  if (server->arg("gw") != "")
+  {
+    String gw = server->arg("gw");
+    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_gw, gw.c_str());
+    
+    LOGDEBUG1(F("New Static Gateway ="), _WiFi_STA_IPconfig._sta_static_gw.toString());
+  }
+
+  if (server->arg("sn") != "")
+  {
+    String sn = server->arg("sn");
+    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_sn, sn.c_str());
+    
+    LOGDEBUG1(F("New Static Netmask ="), _WiFi_STA_IPconfig._sta_static_sn.toString());
+  }
+
+#if USE_CONFIGURABLE_DNS
+  //*****  Added for DNS Options *****
+  if (server->arg("dns1") != "")
+  {
+    String dns1 = server->arg("dns1");
+    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_dns1, dns1.c_str());
+    
+    LOGDEBUG1(F("New Static DNS1 ="), _WiFi_STA_IPconfig._sta_static_dns1.toString());
+  }
+
+  if (server->arg("dns2") != "")
+  {
+    String dns2 = server->arg("dns2");
+    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_dns2, dns2.c_str());
+    
+    LOGDEBUG1(F("New Static DNS2 ="), _WiFi_STA_IPconfig._sta_static_dns2.toString());
+  }
+  //*****  End added for DNS Options *****
+#endif
+
+  beginPage(200, "text/html");
+
+  pageHead("Credentials Saved");
+
+  pageContent_P(WM_HTTP_SAVED);
+  pageContent_P(WM_HTTP_SAVED_STATUS);
+  pageContent_P(WM_HTTP_END);
+
+  endPage();
+
+  LOGDEBUG(F("Sent wifi save page"));
+
+  // The save page follows the coming connection through /state, not a previous one
+  if ( (_connectState != WM_CONNECT_ASSOCIATING) && (_connectState != WM_CONNECT_DHCP) )
+  {
+    _connectState   = WM_CONNECT_IDLE;
+    _connectFailure = WM_FAIL_NONE;
+  }
+
+  connect = true; //signal ready to connect/reset
+
+  // Restore when Press Save WiFi
+  _configPortalTimeout = DEFAULT_PORTAL_TIMEOUT;
+}
+
+//////////////////////////////////////////
+
+// Check the credentials against the rules of 802.11 and the scan results cache. NULL if they may be right, else why
+// not. canForce tells if the user may know better, as for a hidden network missing from the scan.
+const char* ESP_WiFiManager::checkCredentials(const String& ssid, const String& pass, bool& canForce)
+{
+  canForce = false;
+
+  // Empty for the saved credentials
+  if (ssid == "")
+    return NULL;
+
+  if (ssid.length() > 32)
+    return "The SSID is longer than 32 characters";
+
+  if (pass.length() > 64)
+    return "The password is longer than 64 characters";
+
+  const WM_ScanResult* result = findScanResult(ssid.c_str());
+
+  if (!result)
+  {
+    // Nothing to check against without a scan
+    if ( (_numScanResults == 0) && !_scanPartial )
+      return NULL;
+
+    canForce = true;
+
+    // Maybe in range, but filtered out of the results
+    if (_scanPartial)
+      return "Network not in the scan results, it may be weak or hidden. Connect anyway to try it.";
+
+    return "Network not in range. Connect anyway if it is hidden.";
+  }
+
+  size_t  length  = pass.length();
+  bool    hex     = true;
+
+  for (size_t i = 0; i < length; i++)
+    hex = hex && isxdigit(pass[i]);
+
+#ifdef ESP8266
+  if (result->_encryption == ENC_TYPE_NONE)
+#else		//ESP32
+  if (result->_encryption == WIFI_AUTH_OPEN)
+#endif
+  {
+    if (length > 0)
+      return "This network is open, leave the password empty";
+  }
+#ifdef ESP8266
+  else if (result->_encryption == ENC_TYPE_WEP)
+#else		//ESP32
+  else if (result->_encryption == WIFI_AUTH_WEP)
+#endif
+  {
+    if ( (length != 5) && (length != 13) && !( hex && ( (length == 10) || (length == 26) ) ) )
+      return "WEP keys have 5 or 13 characters, or 10 or 26 hex digits";
+  }
+#ifdef ESP32
+  else if (result->_encryption == WIFI_AUTH_WPA2_ENTERPRISE)
+  {
+    return "WPA2 Enterprise networks are not supported";
+  }
+#endif
+  else if ( (length < 8) || ( (length == 64) && !hex ) )
+  {
+    return "WPA passwords have 8 to 63 characters, or 64 hex digits";
+  }
+
+  return NULL;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::sendSaveError(const char* error, bool canForce)
+{
+  LOGERROR1(F("Credentials rejected :"), error);
+
+  // The page holds the submitted form
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+
+#if USING_CORS_FEATURE
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+  beginPage(400, "text/html");
+
+  pageHead("Credentials Error");
+
+  WM_TemplateSlot slots[] =
+  {
+    { "v", error, WM_ESCAPE_HTML }
+  };
+
+  pageTemplate_P(WM_HTTP_SAVE_ERROR, slots, sizeof(slots) / sizeof(slots[0]));
+
+  if (canForce)
+  {
+    // The same request again, without the checks. The passwords are not echoed back over plain HTTP.
+    pageContent_P(WM_HTTP_FORCE_START);
+
+    for (int i = 0; i < server->args(); i++)
+    {
+      String name   = server->argName(i);
+      String value  = server->arg(i);
+
+      if ( (name == "p") || (name == "p1") )
+        continue;
+
+      WM_TemplateSlot hidden[] =
+      {
+        { "n", name.c_str(),  WM_ESCAPE_HTML },
+        { "v", value.c_str(), WM_ESCAPE_HTML }
+      };
+
+      pageTemplate_P(WM_HTTP_FORM_HIDDEN, hidden, sizeof(hidden) / sizeof(hidden[0]));
+    }
+
+    // To be typed again, for each network of the form
+    static const char* const passwords[][2] = { { "s", "p" }, { "s1", "p1" } };
+
+    for (const auto& password : passwords)
+    {
+      String ssid = server->arg(password[0]);
+
+      if (ssid == "")
+        continue;
+
+      WM_TemplateSlot field[] =
+      {
+        { "n", password[1],   WM_ESCAPE_NONE },
+        { "v", ssid.c_str(),  WM_ESCAPE_HTML }
+      };
+
+      pageTemplate_P(WM_HTTP_FORCE_PASS, field, sizeof(field) / sizeof(field[0]));
+    }
+
+    pageContent_P(WM_HTTP_FORCE_END);
+  }
+
+  pageContent_P(WM_HTTP_SAVE_BACK);
+  pageContent_P(WM_HTTP_END);
+
+  endPage();
+}
+
+//////////////////////////////////////////
+
+// Change the priority of a saved network ( s, pr, a=set ) or remove it ( s, a=del ), then back to /wifi.
+// POST only : a GET from a prefetcher, a captive portal probe or another page must not change the saved networks.
+void ESP_WiFiManager::handleCredential()
+{
+  LOGDEBUG(F("Handle credential"));
+
+  if (server->method() != HTTP_POST)
+  {
+    server->sendHeader(F("Allow"), F("POST"));
+    server->send(405, "text/plain", "Method not allowed");
+    return;
+  }
+
+  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
+  _configPortalTimeout = 0;
+
+  String  ssid    = server->arg("s");
+  String  action  = server->arg("a");
+
+  if ( (ssid == "") || ( (action != "del") && (server->arg("pr") == "") ) )
+  {
+    server->send(400, "text/plain", "Missing network or priority");
+    return;
+  }
+
+  int index = findCredential(ssid.c_str());
+
+  if (index < 0)
+  {
+    server->send(404, "text/plain", "Unknown network");
+    return;
+  }
+
+  bool changed = false;
+
+  if (action == "del")
+  {
+    changed = removeCredential(ssid.c_str());
+  }
+  else
+  {
+    uint8_t priority = constrain(server->arg("pr").toInt(), 0, 255);
+
+    changed = (_credentials[index]._priority != priority) && setCredentialPriority(ssid.c_str(), priority);
+  }
+
+  if ( changed && (_credentialscallback != NULL) )
+  {
+    _credentialscallback();
+  }
+
+  server->sendHeader(F("Location"), F("/wifi"), true);
+  server->send(303, FPSTR(WM_HTTP_HEAD_CT2), "");
+}
+
+//////////////////////////////////////////
+
+/** Handle shut down the server page */
+void ESP_WiFiManager::handleServerClose()
+{
+  LOGDEBUG(F("Server Close"));
+  
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+
+#if USING_CORS_FEATURE
+  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+    
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+  beginPage(200, "text/html");
+  
+  pageHead("Close Server");
+  pageContent(F("<div class=\"msg\">"));
+  pageContent(F("My network is <b>"));
+  pageEscaped(WiFi_SSID().c_str(), WM_ESCAPE_HTML);
+  pageContent(F("</b><br>"));
+  pageContent(F("IP address is <b>"));
+  pageContent(WiFi.localIP().toString());
+  pageContent(F("</b><br><br>"));
+  pageContent(F("Portal closed...<br><br>"));
+  
+  //pageContent(F("Push button on device to restart configuration server!"));
+  
+  pageContent_P(WM_HTTP_END);
+  
+  endPage();
+  
+  stopConfigPortal = true; //signal ready to shutdown config portal
+  
+  LOGDEBUG(F("Sent server close page"));
+
+  // Restore when Press Save WiFi
+  _configPortalTimeout = DEFAULT_PORTAL_TIMEOUT;
+}
+
+//////////////////////////////////////////
+
+/** Handle the info page */
+void ESP_WiFiManager::handleInfo()
+{
+  LOGDEBUG(F("Info"));
+
+  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
+  _configPortalTimeout = 0;		//KH
+
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_REVALIDATE));
+
+#if USING_CORS_FEATURE
+  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+    
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+#if USE_PORTAL_ETAG
+  // Device data is fixed, the rest is covered by the connection and AP state
+  if (notModified(connectionTag(configTag())))
+    return;
+#endif
+
+  beginPage(200, "text/html");
+  
+  pageHead("Info");
+  
+  pageContent(F("<h2>WiFi Information</h2>"));
+  
+  reportStatus();
+  
+  pageContent_P(WM_FLDSET_START);
+  
+  pageContent(F("<h3>Device Data</h3>"));
+  pageContent(F("<table class=\"table\">"));
+  pageContent(F("<thead><tr><th>Name</th><th>Value</th></tr></thead><tbody><tr><td>Chip ID</td><td>"));
+
+#ifdef ESP8266
+  pageContent(String(ESP.getChipId(), HEX));		//ESP.getChipId();
+#else		//ESP32
+  pageContent(String((uint32_t)ESP.getEfuseMac(), HEX));		//ESP.getChipId();
+#endif
+
+  pageContent(F("</td></tr>"));
+  pageContent(F("<tr><td>Flash Chip ID</td><td>"));
+
+#ifdef ESP8266
+  pageContent(String(ESP.getFlashChipId(), HEX));		//ESP.getFlashChipId();
+#else		//ESP32
+  // TODO
+  pageContent(F("TODO"));
+#endif
+
+  pageContent(F("</td></tr>"));
+  pageContent(F("<tr><td>IDE Flash Size</td><td>"));
+  pageContent(String(ESP.getFlashChipSize()));
+  pageContent(F(" bytes</td></tr>"));
+  pageContent(F("<tr><td>Real Flash Size</td><td>"));
+
+#ifdef ESP8266
+  pageContent(String(ESP.getFlashChipRealSize()));
+#else		//ESP32
+  // TODO
+  pageContent(F("TODO"));
+#endif
+
+  pageContent(F(" bytes</td></tr>"));
+  pageContent(F("<tr><td>Access Point IP</td><td>"));
+  pageContent(WiFi.softAPIP().toString());
+  pageContent(F("</td></tr>"));
+  pageContent(F("<tr><td>Access Point MAC</td><td>"));
+  pageContent(WiFi.softAPmacAddress());
+  pageContent(F("</td></tr>"));
+
+  pageContent(F("<tr><td>SSID</td><td>"));
+  pageEscaped(WiFi_SSID().c_str(), WM_ESCAPE_HTML);
+  pageContent(F("</td></tr>"));
+
+  pageContent(F("<tr><td>Station IP</td><td>"));
+  pageContent(WiFi.localIP().toString());
+  pageContent(F("</td></tr>"));
+
+  pageContent(F("<tr><td>Station MAC</td><td>"));
+  pageContent(WiFi.macAddress());
+  pageContent(F("</td></tr>"));
+  pageContent(F("</tbody></table>"));
+
+  pageContent_P(WM_FLDSET_END);
+  
+#if USE_AVAILABLE_PAGES  
+  pageContent_P(WM_FLDSET_START);
+  
+  pageContent_P(WM_HTTP_AVAILABLE_PAGES);
+  
+  pageContent_P(WM_FLDSET_END);
+#endif
+
+  pageContent(F("<p/>More information about ESP_WiFiManager at"));
+  pageContent(F("<p/><a href=\"https://github.com/khoih-prog/ESP_WiFiManager\">https://github.com/khoih-prog/ESP_WiFiManager</a>"));
+  pageContent_P(WM_HTTP_END);
+
+  endPage();
+
+  LOGDEBUG(F("Sent info page"));
+}
+
+//////////////////////////////////////////
+
+/** Handle the state page */
+void ESP_WiFiManager::handleState()
+{
+  LOGDEBUG(F("State - json"));
+  
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_REVALIDATE));
+
+#if USING_CORS_FEATURE
+  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+    
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+#if USE_PORTAL_ETAG
+  if (notModified(connectionTag(WM_TAG_INIT)))
+    return;
+#endif
+  
+  beginPage(200, "application/json");
+
+  jsonOpen(NULL, '{');
+  jsonString("Soft_AP_IP",  WiFi.softAPIP().toString());
+  jsonString("Soft_AP_MAC", WiFi.softAPmacAddress());
+  jsonString("Station_IP",  WiFi.localIP().toString());
+  jsonString("Station_MAC", WiFi.macAddress());
+  jsonBool("Password",      WiFi.psk() != "");
+  jsonString("SSID",        WiFi_SSID());
+
+  jsonString("Connection",  connectStateName(_connectState));
+  jsonString("Failure",     getStatus(_connectFailure));
+  jsonClose('}');
+
+  endPage();
+  
+  LOGDEBUG(F("Sent state page in json format"));
+}
+
+//////////////////////////////////////////
+
+const char* ESP_WiFiManager::connectStateName(WM_ConnectState state)
+{
+  static const char* const names[] = { "idle", "associating", "dhcp", "connected", "failed" };
+
+  return names[state];
+}
+
+//////////////////////////////////////////
+
+// Progress of the connection started by the save page, polled by it. Not cached, the elapsed time always changes.
+void ESP_WiFiManager::handleConnectStatus()
+{
+  LOGDEBUG(F("Connect status - json"));
+
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+
+#if USING_CORS_FEATURE
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+  bool          running = (_connectState == WM_CONNECT_ASSOCIATING) || (_connectState == WM_CONNECT_DHCP);
+  unsigned long elapsed = 0;
+
+  if (running)
+    elapsed = millis() - _connectBegin;
+  else if (_connectState != WM_CONNECT_IDLE)
+    elapsed = _connectEnd - _connectBegin;
+
+  beginPage(200, "application/json");
+
+  jsonOpen(NULL, '{');
+  jsonString("State",     connectStateName(_connectState));
+  jsonString("SSID",      _connectSSID);
+  jsonNumber("Elapsed",   elapsed);
+  jsonString("IP",        (_connectState == WM_CONNECT_CONNECTED) ? WiFi.localIP().toString() : String(""));
+  jsonString("Failure",   getStatus(_connectFailure));
+  jsonClose('}');
+
+  endPage();
+
+  if ( ( (_connectState == WM_CONNECT_CONNECTED) || (_connectState == WM_CONNECT_FAILED) ) && (_connectResultServed == 0) )
+    _connectResultServed = millis();
+}
+
+//////////////////////////////////////////
+
+/** Handle the scan page */
+void ESP_WiFiManager::handleScan()
+{
+  LOGDEBUG(F("Scan"));
+
+  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
+  _configPortalTimeout = 0;		//KH
+
+  LOGDEBUG(F("State-Json"));
+  
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_REVALIDATE));
+
+#if USING_CORS_FEATURE
+  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
+  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
+#endif
+    
+  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
+  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+
+  // /scan?refresh=1 asks for a new scan instead of the cached results
+  bool refresh = scanRefreshRequested();
+
+#if USE_ASYNC_WIFI_SCAN
+  if (refresh || !scanResultsFresh())
+  {
+    // Join the running scan, or start one, and tell the client to come back
+    startScan();
+
+    beginPage(202, "application/json");
+
+    jsonOpen(NULL, '{');
+    jsonString("Scan", (_scanState == WM_SCAN_RUNNING) ? "running" : "failed");
+    jsonNumber("Elapsed_ms", millis() - _scanStart);
+    jsonClose('}');
+
+    endPage();
+
+    LOGDEBUG(F("Scan running, sent 202"));
+    return;
+  }
+#else
+  if (refresh || !scanResultsFresh())
+    scanNow();
+#endif
+
+  _scanServed = true;
+
+  WM_ScanFilter filter;
+  String        ssidPrefix;
+
+  parseScanFilter(filter, ssidPrefix, 0);
+
+#if USE_PORTAL_ETAG
+  if (notModified(scanFilterTag(_scanTag, filter)))
+    return;
+#endif
+
+  beginPage(200, "application/json");
+
+  jsonOpen(NULL, '{');
+  jsonOpen("Access_Points", '[');
+
+  int matched = 0;
+  int shown   = 0;
+
+  //display networks in page
+  for (int i = 0; i < _numScanResults; i++)
+  {
+    const WM_ScanResult& result = _scanResults[i];
+
+    // Matches out of the page are counted only, for Total
+    if ( !scanResultMatches(result, filter) || (matched++ < filter._offset) || (filter._limit && (shown >= filter._limit)) )
+      continue;
+
+    shown++;
+
+    LOGDEBUG1(F("Index ="), i);
+    LOGDEBUG1(F("SSID ="), result._ssid);
+    LOGDEBUG1(F("RSSI ="), result._rssi);
+
+    // Quality stays a string, as before
+    char quality[4];
+
+    snprintf(quality, sizeof(quality), "%d", result._quality);
+
+    jsonOpen(NULL, '{');
+    jsonString("SSID", result._ssid);
+#ifdef ESP8266
+    jsonBool("Encryption", result._encryption != ENC_TYPE_NONE);
+#else		//ESP32
+    jsonBool("Encryption", result._encryption != WIFI_AUTH_OPEN);
+#endif
+    jsonString("Quality", quality);
+
+    // Grouped view for mesh networks: the strongest BSSID of the SSID, its channel and how many others were seen
+    char bssid[18];
+
+    snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X", result._bssid[0], result._bssid[1],
+             result._bssid[2], result._bssid[3], result._bssid[4], result._bssid[5]);
+
+    jsonString("BSSID", bssid);
+    jsonNumber("Channel", result._channel);
+    jsonNumber("Other_BSSIDs", (result._numBSSIDs > 0) ? result._numBSSIDs - 1 : 0);
+    jsonClose('}');
+
+    delay(0);
+  }
+
+  jsonClose(']');
+  jsonNumber("Offset", filter._offset);
+  jsonNumber("Total", matched);
+  jsonClose('}');
+  
+  endPage();
+  
+  LOGDEBUG(F("Sent WiFiScan Data in Json format"));
+}
+
+//////////////////////////////////////////
+
+/** Handle the reset page */
+void ESP_WiFiManager::handleReset()
+{
+  LOGDEBUG(F("Reset"));
+  
+  server->sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server->sendHeader("Pragma", "no-cache");
+  server->sendHeader("Expires", "-1");
+  
+  beginPage(200, "text/html");
+  
+  pageHead("WiFi Information");
+  pageContent(F("Resetting"));
+  pageContent_P(WM_HTTP_END);
+  
+  endPage();
+
+  LOGDEBUG(F("Sent reset page"));
+
+  // The reset would drop what is still in the TCP buffers : wait for the page to leave before closing.
+  // On ESP8266 flush() waits until the data is acknowledged, ESP32 sends it from the lwIP task after stop().
+  server->client().flush();
+  server->client().stop();
+
+#ifdef ESP32
+  delay(100);
+#endif
+  
+  // New in v1.0.11
+  // Temporary fix for issue of not clearing WiFi SSID/PW from flash of ESP32
+  // See https://github.com/khoih-prog/ESP_WiFiManager/issues/25 and https://github.com/espressif/arduino-esp32/issues/400
+  resetSettings();
+  //WiFi.disconnect(true); // Wipe out WiFi credentials.
+  //////
+
+#ifdef ESP8266
+  ESP.reset();
+#else		//ESP32
+  ESP.restart();
+#endif
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::handleNotFound()
+{
+  if (captivePortal())
+  {
+    // If caprive portal redirect instead of displaying the error page.
+    return;
+  }
+
+  String message = "File Not Found\n\n";
+  
+  message += "URI: ";
+  message += server->uri();
+  message += "\nMethod: ";
+  message += (server->method() == HTTP_GET) ? "GET" : "POST";
+  message += "\nArguments: ";
+  message += server->args();
+  message += "\n";
+
+  for (uint8_t i = 0; i < server->args(); i++)
+  {
+    message += " " + server->argName(i) + ": " + server->arg(i) + "\n";
+  }
+
+  server->sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server->sendHeader("Pragma", "no-cache");
+  server->sendHeader("Expires", "-1");
+  
+  server->send(404, "text/plain", message);
+}
+
+//////////////////////////////////////////
+
+#if USE_PORTAL_ASSETS
+
+// Serve one pre-gzipped asset straight from flash
+void ESP_WiFiManager::handleAsset(const WM_PortalAsset* asset)
+{
+  LOGDEBUG1(F("Handle asset"), asset->_uri);
+  
+  server->sendHeader(FPSTR(WM_HTTP_ETAG), asset->_etag);
+  
+  if (server->header(FPSTR(WM_HTTP_IF_NONE_MATCH)).indexOf(asset->_etag) >= 0)
+  {
+    // Browser copy is still valid
+    server->send(304, FPSTR(WM_HTTP_HEAD_CT2), "");
+    return;
+  }
+  
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_CACHE_FOREVER));
+  
+  if (asset->_gzipped)
+    server->sendHeader(FPSTR(WM_HTTP_CONTENT_ENCODING), FPSTR(WM_HTTP_GZIP));
+  
+  server->send_P(200, asset->_contentType, (PGM_P) asset->_data, asset->_length);
+}
+
+#endif
+
+//////////////////////////////////////////
+
+/**
+   HTTPD redirector
+   Redirect to captive portal if we got a request for another domain.
+   Return true in that case so the page handler do not try to handle the request again.
+*/
+bool ESP_WiFiManager::captivePortal()
+{
+  String host = server->hostHeader();
+
+#if (WM_HTTP_PORT != 80)
+  // The port is then in the Host header, and must be in the redirection
+  if (host.indexOf(':') >= 0)
+    host = host.substring(0, host.indexOf(':'));
+#endif
+
+  if (!isIp(host))
+  {
+    LOGDEBUG(F("Request redirected to captive portal"));
+    
+    String location = (String)F("http://") + toStringIp(server->client().localIP());
+
+#if (WM_HTTP_PORT != 80)
+    location += ':';
+    location += String(WM_HTTP_PORT);
+#endif
+
+    server->sendHeader(F("Location"), location, true);
+    server->send(302, FPSTR(WM_HTTP_HEAD_CT2), ""); // Empty content inhibits Content-length header so we have to close the socket ourselves.
+    server->client().stop(); // Stop is needed because we sent no content length
+    
+    return true;
+  }
+  return false;
+}
+
+//////////////////////////////////////////
+
+//start up config portal callback
+void ESP_WiFiManager::setAPCallback(void(*func)(ESP_WiFiManager* myWiFiManager))
+{
+  _apcallback = func;
+}
+
+//////////////////////////////////////////
+
+//start up save config callback
+void ESP_WiFiManager::setSaveConfigCallback(void(*func)())
+{
+  _savecallback = func;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setPortalReadyCallback(void(*func)(unsigned long bringUpTime))
+{
+  _portalreadycallback = func;
+}
+
+//////////////////////////////////////////
+
+void ESP_WiFiManager::setCredentialsCallback(void(*func)())
+{
+  _credentialscallback = func;
+}
+
+//////////////////////////////////////////
+
+#if USE_WIFI_EVENTS
+void ESP_WiFiManager::setWiFiEventCallback(void(*func)(const WM_WiFiEvent&))
+{
+  _wifiEventCallback = func;
+}
+#endif
+
+//////////////////////////////////////////
+
+//sets a custom element to add to head, like a new style tag
+void ESP_WiFiManager::setCustomHeadElement(const char* element) {
+  _customHeadElement = element;
+}
+
+//if this is true, remove duplicated Access Points - defaut true
+void ESP_WiFiManager::setRemoveDuplicateAPs(bool removeDuplicates)
+{
+  _removeDuplicateAPs = removeDuplicates;
+}
+
+//////////////////////////////////////////
+
+//Scan for WiFiNetworks in range and sort by signal strength
+//space for indices array allocated on the heap and should be freed when no longer required
+int ESP_WiFiManager::scanWifiNetworks(int **indicesptr)
+{
+  LOGDEBUG(F("Scanning Network"));
+
+  int n = WiFi.scanNetworks();
+
+  LOGDEBUG1(F("scanWifiNetworks: Done, Scanned Networks n ="), n); 
+
+  //KH, Terrible bug here. WiFi.scanNetworks() returns n < 0 => malloc( negative == very big ) => crash!!!
+  //In .../esp32/libraries/WiFi/src/WiFiType.h
+  //#define WIFI_SCAN_RUNNING   (-1)
+  //#define WIFI_SCAN_FAILED    (-2)
+  //if (n == 0)
+  return processScanResults(n, indicesptr);
+}
+
+//////////////////////////////////////////
+
+// Sort, remove duplicates and filter the n results of a completed scan.
+// numBSSIDs, if given, gets for each position of indices the number of BSSIDs grouped under its SSID.
+// numWeak, if given, gets the number of SSIDs below the minimum quality.
+int ESP_WiFiManager::processScanResults(int n, int **indicesptr, uint8_t *numBSSIDs, int *numWeak)
+{
+  if (numWeak)
+    *numWeak = 0;
+
+  if (n <= 0)
+  {
+    LOGDEBUG(F("No network found"));
+    return (0);
+  }
+  else
+  {
+    // Allocate space off the heap for indices array.
+    // This space should be freed when no longer required.
+    int* indices = (int *)malloc(n * sizeof(int));
+
+    // Snapshot and SSID hash set are only needed during the scan processing
+    WM_ScanEntry* entries = (WM_ScanEntry *)malloc(n * sizeof(WM_ScanEntry));
+
+    // Open addressing, at most half full. Slots hold the position + 1 of the entry kept for that SSID.
+    int       setSize = 2;
+
+    while (setSize < 2 * n)
+      setSize <<= 1;
 
-    if (_params[i]->getID() != NULL)
+    uint16_t* ssidSet = (uint16_t *)calloc(setSize, sizeof(uint16_t));
+
+    if ( (indices == NULL) || (entries == NULL) || (ssidSet == NULL) )
     {
-      pitem.replace("{i}", _params[i]->getID());
-      pitem.replace("{n}", _params[i]->getID());
-      pitem.replace("{p}", _params[i]->getPlaceholder());
-      snprintf(parLength, 2, "%d", _params[i]->getValueLength());
-      pitem.replace("{l}", parLength);
-      pitem.replace("{v}", _params[i]->getValue());
-      pitem.replace("{c}", _params[i]->getCustomHTML());
+      LOGDEBUG(F("ERROR: Out of memory"));
+
+      free(indices);
+      free(entries);
+      free(ssidSet);
+
+      *indicesptr = NULL;
+      return (0);
     }
-    else
+
+    *indicesptr = indices;
+
+    // Read every BSSID once
+    for (int i = 0; i < n; i++)
     {
-      pitem = _params[i]->getCustomHTML();
+      WM_ScanEntry& entry = entries[i];
+
+      entry._index      = i;
+      entry._rssi       = (int8_t) WiFi.RSSI(i);
+      entry._quality    = getRSSIasQuality(entry._rssi);
+      entry._channel    = WiFi.channel(i);
+      entry._encryption = WiFi.encryptionType(i);
+      entry._ssid       = scanSSID(i, entry._ssidLen);
+      entry._ssidHash   = tagOf(WM_TAG_INIT, entry._ssid, entry._ssidLen);
     }
 
-    page += pitem;
-  }
-  
-  // From v1.0.10
-  if (_paramsCount > 0)
-  {
-    page += FPSTR(WM_FLDSET_END);
-  }
-  //////
+    LOGDEBUG(F("Sorting"));
 
-  if (_params[0] != NULL)
-  {
-    page += "<br/>";
-  }
+    // RSSI SORT, strongest first. Index as tie-breaker to keep the order of the driver.
+    std::sort(entries, entries + n, [](const WM_ScanEntry& a, const WM_ScanEntry& b)
+    {
+      return (a._rssi != b._rssi) ? (a._rssi > b._rssi) : (a._index < b._index);
+    });
 
-  LOGDEBUG1(F("Static IP ="), _WiFi_STA_IPconfig._sta_static_ip.toString());
-  
-  // KH, Comment out in v1.0.9 to permit changing from DHCP to static IP, or vice versa
-  // and add staticIP label in CP
-  
-  // From v1.0.10 to permit disable/enable StaticIP configuration in Config Portal from sketch. Valid only if DHCP is used.
-  // You'll loose the feature of dynamically changing from DHCP to static IP, or vice versa
-  // You have to explicitly specify false to disable the feature.
+    LOGDEBUG(F("Removing Dup"));
 
-#if !USE_STATIC_IP_CONFIG_IN_CP
-  if (_WiFi_STA_IPconfig._sta_static_ip)
-#endif  
-  {
-    // From v1.0.10
-    page += FPSTR(WM_FLDSET_START);
-    //////
-    
-    String item = FPSTR(WM_HTTP_FORM_LABEL);
-    item += FPSTR(WM_HTTP_FORM_PARAM);
-    item.replace("{i}", "ip");
-    item.replace("{n}", "ip");
-    item.replace("{p}", "Static IP");
-    item.replace("{l}", "15");
-    item.replace("{v}", _WiFi_STA_IPconfig._sta_static_ip.toString());
-
-    page += item;
-
-    item = FPSTR(WM_HTTP_FORM_LABEL);
-    item += FPSTR(WM_HTTP_FORM_PARAM);
-    item.replace("{i}", "gw");
-    item.replace("{n}", "gw");
-    item.replace("{p}", "Gateway IP");
-    item.replace("{l}", "15");
-    item.replace("{v}", _WiFi_STA_IPconfig._sta_static_gw.toString());
-
-    page += item;
-
-    item = FPSTR(WM_HTTP_FORM_LABEL);
-    item += FPSTR(WM_HTTP_FORM_PARAM);
-    item.replace("{i}", "sn");
-    item.replace("{n}", "sn");
-    item.replace("{p}", "Subnet");
-    item.replace("{l}", "15");
-    item.replace("{v}", _WiFi_STA_IPconfig._sta_static_sn.toString());
+    for (int i = 0; i < n; i++)
+    {
+      const WM_ScanEntry& entry = entries[i];
 
-  #if USE_CONFIGURABLE_DNS
-    //***** Added for DNS address options *****
-    page += item;
-
-    item = FPSTR(WM_HTTP_FORM_LABEL);
-    item += FPSTR(WM_HTTP_FORM_PARAM);
-    item.replace("{i}", "dns1");
-    item.replace("{n}", "dns1");
-    item.replace("{p}", "DNS1 IP");
-    item.replace("{l}", "15");
-    item.replace("{v}", _WiFi_STA_IPconfig._sta_static_dns1.toString());
-
-    page += item;
-
-    item = FPSTR(WM_HTTP_FORM_LABEL);
-    item += FPSTR(WM_HTTP_FORM_PARAM);
-    item.replace("{i}", "dns2");
-    item.replace("{n}", "dns2");
-    item.replace("{p}", "DNS2 IP");
-    item.replace("{l}", "15");
-    item.replace("{v}", _WiFi_STA_IPconfig._sta_static_dns2.toString());
-    //***** End added for DNS address options *****
-  #endif
+      indices[i] = entry._index;
 
-    page += item;
-    
-    // From v1.0.10
-    page += FPSTR(WM_FLDSET_END);
-    //////
+      if (numBSSIDs)
+        numBSSIDs[i] = 1;
 
-    page += "<br/>";
-  }
+      // remove duplicates ( entries are RSSI sorted, so the strongest BSSID of each SSID is kept )
+      if (_removeDuplicateAPs)
+      {
+        uint32_t slot = entry._ssidHash & (setSize - 1);
+        bool     dup  = false;
 
-  page += FPSTR(WM_HTTP_FORM_END);
+        while (ssidSet[slot] != 0)
+        {
+          const WM_ScanEntry& kept = entries[ssidSet[slot] - 1];
 
-  page += FPSTR(WM_HTTP_END);
+          // Same hash, confirm with the SSIDs themselves
+          if ( (kept._ssidHash == entry._ssidHash) && (kept._ssidLen == entry._ssidLen) &&
+               (memcmp(kept._ssid, entry._ssid, entry._ssidLen) == 0) )
+          {
+            dup = true;
+            break;
+          }
 
-  server->send(200, "text/html", page);
+          slot = (slot + 1) & (setSize - 1);
+        }
 
-  LOGDEBUG(F("Sent config page"));
-}
+        if (dup)
+        {
+          if ( numBSSIDs && (numBSSIDs[ssidSet[slot] - 1] < 255) )
+            numBSSIDs[ssidSet[slot] - 1]++;
 
-//////////////////////////////////////////
+          LOGDEBUG1("DUP AP:", WiFi.SSID(entry._index));
+          indices[i] = -1; // set dup aps to index -1
+          continue;
+        }
 
-/** Handle the WLAN save form and redirect to WLAN config page again */
-void ESP_WiFiManager::handleWifiSave()
-{
-  LOGDEBUG(F("WiFi save"));
+        ssidSet[slot] = i + 1;
+      }
 
-  //SAVE/connect here
-  _ssid = server->arg("s").c_str();
-  _pass = server->arg("p").c_str();
+      if (!(_minimumQuality == -1 || _minimumQuality < entry._quality))
+      {
+        indices[i] = -1;
+        LOGDEBUG(F("Skipping low quality"));
 
-  // New from v1.1.0
-  _ssid1 = server->arg("s1").c_str();
-  _pass1 = server->arg("p1").c_str();
-  //////
-  
-  //parameters
-  for (int i = 0; i < _paramsCount; i++)
-  {
-    if (_params[i] == NULL)
-    {
-      break;
+        if (numWeak)
+          (*numWeak)++;
+      }
     }
 
-    //read parameter
-    String value = server->arg(_params[i]->getID()).c_str();
-    
-    //store it in array
-    // New in v1.4.0
-    value.toCharArray(_params[i]->_WMParam_data._value, _params[i]->_WMParam_data._length);
-    //////
-    
-    LOGDEBUG2(F("Parameter and value :"), _params[i]->getID(), value);
-  }
+    free(entries);
+    free(ssidSet);
 
-  if (server->arg("ip") != "")
-  {
-    String ip = server->arg("ip");
-    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_ip, ip.c_str());
-    
-    LOGDEBUG1(F("New Static IP ="), _WiFi_STA_IPconfig._sta_static_ip.toString());
-  }
+#if (DEBUG_WIFIMGR > 2)
+    for (int i = 0; i < n; i++)
+    {
+      if (indices[i] == -1)
+        continue; // skip dups
+      else
+        Serial.println(WiFi.SSID(indices[i]));
+    }
+#endif
 
-  if (server->arg("gw") != "")
-  {
-    String gw = server->arg("gw");
-    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_gw, gw.c_str());
-    
-    LOGDEBUG1(F("New Static Gateway ="), _WiFi_STA_IPconfig._sta_static_gw.toString());
+    return (n);
   }
+}
 
-  if (server->arg("sn") != "")
-  {
-    String sn = server->arg("sn");
-    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_sn, sn.c_str());
-    
-    LOGDEBUG1(F("New Static Netmask ="), _WiFi_STA_IPconfig._sta_static_sn.toString());
-  }
+//////////////////////////////////////////
 
-#if USE_CONFIGURABLE_DNS
-  //*****  Added for DNS Options *****
-  if (server->arg("dns1") != "")
-  {
-    String dns1 = server->arg("dns1");
-    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_dns1, dns1.c_str());
-    
-    LOGDEBUG1(F("New Static DNS1 ="), _WiFi_STA_IPconfig._sta_static_dns1.toString());
-  }
+// The SSID of scan result index, in the scan record of the WiFi driver : no String, valid until the next scan
+const char* ESP_WiFiManager::scanSSID(int index, uint8_t& length)
+{
+#ifdef ESP8266
+  bss_info*         info = WiFi.getScanInfoByIndex(index);
+#else		//ESP32
+  wifi_ap_record_t* info = (wifi_ap_record_t*) WiFi.getScanInfoByIndex(index);
+#endif
 
-  if (server->arg("dns2") != "")
+  if (info == NULL)
   {
-    String dns2 = server->arg("dns2");
-    optionalIPFromString(&_WiFi_STA_IPconfig._sta_static_dns2, dns2.c_str());
-    
-    LOGDEBUG1(F("New Static DNS2 ="), _WiFi_STA_IPconfig._sta_static_dns2.toString());
+    length = 0;
+    return "";
   }
-  //*****  End added for DNS Options *****
-#endif
 
-  String page = FPSTR(WM_HTTP_HEAD_START);
-  
-  page.replace("{v}", "Credentials Saved");
-  page += FPSTR(WM_HTTP_SCRIPT);
-  page += FPSTR(WM_HTTP_SCRIPT_NTP);
-  page += FPSTR(WM_HTTP_STYLE);
-  page += _customHeadElement;
-  page += FPSTR(WM_HTTP_HEAD_END);
-  page += FPSTR(WM_HTTP_SAVED);
-  page.replace("{v}", _apName);
-  page.replace("{x}", _ssid);
-  
-  // KH, update from v1.1.0
-  page.replace("{x1}", _ssid1);
-  //////
-  
-  page += FPSTR(WM_HTTP_END);
-
-  server->send(200, "text/html", page);
-
-  LOGDEBUG(F("Sent wifi save page"));
-
-  connect = true; //signal ready to connect/reset
+  // As WiFi.SSID(index) : up to the first NUL
+  length = strnlen((const char*) info->ssid, sizeof(info->ssid));
 
-  // Restore when Press Save WiFi
-  _configPortalTimeout = DEFAULT_PORTAL_TIMEOUT;
+  return (const char*) info->ssid;
 }
 
 //////////////////////////////////////////
 
-/** Handle shut down the server page */
-void ESP_WiFiManager::handleServerClose()
+// Copy the networks kept from the n results of the WiFi driver into the scan results cache
+void ESP_WiFiManager::storeScanResults(int n)
 {
-  LOGDEBUG(F("Server Close"));
-  
-  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+  int*      indices   = NULL;
+  uint8_t*  numBSSIDs = (n > 0) ? (uint8_t *)malloc(n) : NULL;
+  int       count     = 0;
+  int       kept      = 0;
+  int       numWeak   = 0;
 
-#if USING_CORS_FEATURE
-  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
-  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
-#endif
-    
-  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
-  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
-  
-  String page = FPSTR(WM_HTTP_HEAD_START);
-  
-  page.replace("{v}", "Close Server");
-  page += FPSTR(WM_HTTP_SCRIPT);
-  page += FPSTR(WM_HTTP_SCRIPT_NTP);
-  page += FPSTR(WM_HTTP_STYLE);
-  page += _customHeadElement;
-  page += FPSTR(WM_HTTP_HEAD_END);
-  page += F("<div class=\"msg\">");
-  page += F("My network is <b>");
-  page += WiFi_SSID();
-  page += F("</b><br>");
-  page += F("IP address is <b>");
-  page += WiFi.localIP().toString();
-  page += F("</b><br><br>");
-  page += F("Portal closed...<br><br>");
-  
-  //page += F("Push button on device to restart configuration server!");
-  
-  page += FPSTR(WM_HTTP_END);
-  
-  server->send(200, "text/html", page);
-  
-  stopConfigPortal = true; //signal ready to shutdown config portal
-  
-  LOGDEBUG(F("Sent server close page"));
+  n = processScanResults(n, &indices, numBSSIDs, &numWeak);
 
-  // Restore when Press Save WiFi
-  _configPortalTimeout = DEFAULT_PORTAL_TIMEOUT;
-}
+  for (int i = 0; i < n; i++)
+  {
+    if (indices[i] != -1)
+      count++;
+  }
 
-//////////////////////////////////////////
+  _scanPartial = (numWeak > 0);
 
-/** Handle the info page */
-void ESP_WiFiManager::handleInfo()
-{
-  LOGDEBUG(F("Info"));
+  // The snapshot is sorted by RSSI, the K strongest come first
+  if ( (_scanTopK > 0) && (count > _scanTopK) )
+  {
+    count         = _scanTopK;
+    _scanPartial  = true;
+  }
 
-  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
-  _configPortalTimeout = 0;		//KH
+  WM_ScanResult* results = (count > 0) ? (WM_ScanResult *)malloc(count * sizeof(WM_ScanResult)) : NULL;
 
-  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+  if ( (count > 0) && (results == NULL) )
+  {
+    LOGDEBUG(F("ERROR: Out of memory"));
+  }
 
-#if USING_CORS_FEATURE
-  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
-  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
-#endif
-    
-  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
-  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
-  
-  String page = FPSTR(WM_HTTP_HEAD_START);
-  
-  page.replace("{v}", "Info");
-  page += FPSTR(WM_HTTP_SCRIPT);
-  page += FPSTR(WM_HTTP_SCRIPT_NTP);
-  page += FPSTR(WM_HTTP_STYLE);
-  page += _customHeadElement;
-  page += FPSTR(WM_HTTP_HEAD_END);
-  
-  page += F("<h2>WiFi Information</h2>");
-  
-  reportStatus(page);
-  
-  page += FPSTR(WM_FLDSET_START);
-  
-  page += F("<h3>Device Data</h3>");
-  page += F("<table class=\"table\">");
-  page += F("<thead><tr><th>Name</th><th>Value</th></tr></thead><tbody><tr><td>Chip ID</td><td>");
+  for (int i = 0; (i < n) && (kept < count) && results; i++)
+  {
+    if (indices[i] == -1)
+      continue;
 
-#ifdef ESP8266
-  page += String(ESP.getChipId(), HEX);		//ESP.getChipId();
-#else		//ESP32
-  page += String((uint32_t)ESP.getEfuseMac(), HEX);		//ESP.getChipId();
-#endif
+    WM_ScanResult& result = results[kept++];
+    uint8_t*       bssid  = WiFi.BSSID(indices[i]);
 
-  page += F("</td></tr>");
-  page += F("<tr><td>Flash Chip ID</td><td>");
+    memset(&result, 0, sizeof(result));
+    strncpy(result._ssid, WiFi.SSID(indices[i]).c_str(), sizeof(result._ssid) - 1);
 
-#ifdef ESP8266
-  page += String(ESP.getFlashChipId(), HEX);		//ESP.getFlashChipId();
-#else		//ESP32
-  // TODO
-  page += F("TODO");
-#endif
+    if (bssid)
+      memcpy(result._bssid, bssid, sizeof(result._bssid));
 
-  page += F("</td></tr>");
-  page += F("<tr><td>IDE Flash Size</td><td>");
-  page += ESP.getFlashChipSize();
-  page += F(" bytes</td></tr>");
-  page += F("<tr><td>Real Flash Size</td><td>");
+    result._rssi        = WiFi.RSSI(indices[i]);
+    result._quality     = getRSSIasQuality(result._rssi);
+    result._channel     = WiFi.channel(indices[i]);
+    result._encryption  = WiFi.encryptionType(indices[i]);
+    result._numBSSIDs   = numBSSIDs ? numBSSIDs[i] : 1;
+  }
 
-#ifdef ESP8266
-  page += ESP.getFlashChipRealSize();
-#else		//ESP32
-  // TODO
-  page += F("TODO");
-#endif
+  if (indices)
+    free(indices);
 
-  page += F(" bytes</td></tr>");
-  page += F("<tr><td>Access Point IP</td><td>");
-  page += WiFi.softAPIP().toString();
-  page += F("</td></tr>");
-  page += F("<tr><td>Access Point MAC</td><td>");
-  page += WiFi.softAPmacAddress();
-  page += F("</td></tr>");
+  if (numBSSIDs)
+    free(numBSSIDs);
 
-  page += F("<tr><td>SSID</td><td>");
-  page += WiFi_SSID();
-  page += F("</td></tr>");
+  if (_scanResults)
+    free(_scanResults);
 
-  page += F("<tr><td>Station IP</td><td>");
-  page += WiFi.localIP().toString();
-  page += F("</td></tr>");
+  _scanResults    = results;
+  _numScanResults = kept;
+  _scanDone       = millis();
+  _scanState      = WM_SCAN_DONE;
+  _scanServed     = false;
 
-  page += F("<tr><td>Station MAC</td><td>");
-  page += WiFi.macAddress();
-  page += F("</td></tr>");
-  page += F("</tbody></table>");
+#if USE_PORTAL_ETAG
+  updateScanTag();
+#endif
 
-  page += FPSTR(WM_FLDSET_END);
-  
-#if USE_AVAILABLE_PAGES  
-  page += FPSTR(WM_FLDSET_START);
-  
-  page += FPSTR(WM_HTTP_AVAILABLE_PAGES);
-  
-  page += FPSTR(WM_FLDSET_END);
+#if USE_RTC_SCAN_CACHE
+  saveScanResultsToRTC();
 #endif
+}
 
-  page += F("<p/>More information about ESP_WiFiManager at");
-  page += F("<p/><a href=\"https://github.com/khoih-prog/ESP_WiFiManager\">https://github.com/khoih-prog/ESP_WiFiManager</a>");
-  page += FPSTR(WM_HTTP_END);
+//////////////////////////////////////////
 
-  server->send(200, "text/html", page);
+// Blocking scan into the scan results cache
+void ESP_WiFiManager::scanNow()
+{
+  LOGDEBUG(F("Scanning Network"));
 
-  LOGDEBUG(F("Sent info page"));
+  storeScanResults(WiFi.scanNetworks());
 }
 
 //////////////////////////////////////////
 
-/** Handle the state page */
-void ESP_WiFiManager::handleState()
+bool ESP_WiFiManager::scanResultsFresh()
 {
-  LOGDEBUG(F("State - json"));
-  
-  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
+  if (_scanState != WM_SCAN_DONE)
+    return false;
 
-#if USING_CORS_FEATURE
-  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
-  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
-#endif
-    
-  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
-  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
-  
-  String page = F("{\"Soft_AP_IP\":\"");
-  
-  page += WiFi.softAPIP().toString();
-  page += F("\",\"Soft_AP_MAC\":\"");
-  page += WiFi.softAPmacAddress();
-  page += F("\",\"Station_IP\":\"");
-  page += WiFi.localIP().toString();
-  page += F("\",\"Station_MAC\":\"");
-  page += WiFi.macAddress();
-  page += F("\",");
+  unsigned long age = millis() - _scanDone;
 
-  if (WiFi.psk() != "")
-  {
-    page += F("\"Password\":true,");
-  }
-  else
-  {
-    page += F("\"Password\":false,");
-  }
+#if USE_ASYNC_WIFI_SCAN
+  if (!_scanServed && (age < WM_ASYNC_SCAN_GRACE_MS))
+    return true;
+#endif
 
-  page += F("\"SSID\":\"");
-  page += WiFi_SSID();
-  page += F("\"}");
-  
-  server->send(200, "application/json", page);
-  
-  LOGDEBUG(F("Sent state page in json format"));
+  return (age < _scanCacheTTL);
 }
 
 //////////////////////////////////////////
 
-/** Handle the scan page */
-void ESP_WiFiManager::handleScan()
+// ?refresh=1 asks for a new scan. Once the results of the last one have been served only,
+// so that a client polling with refresh=1 does not restart the scan forever.
+bool ESP_WiFiManager::scanRefreshRequested()
 {
-  LOGDEBUG(F("Scan"));
-
-  // Disable _configPortalTimeout when someone accessing Portal to give some time to config
-  _configPortalTimeout = 0;		//KH
-
-  LOGDEBUG(F("State-Json"));
-  
-  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_NO_STORE));
-
-#if USING_CORS_FEATURE
-  // New from v1.1.1, for configure CORS Header, default to WM_HTTP_CORS_ALLOW_ALL = "*"
-  server->sendHeader(FPSTR(WM_HTTP_CORS), _CORS_Header);
-#endif
-    
-  server->sendHeader(FPSTR(WM_HTTP_PRAGMA), FPSTR(WM_HTTP_NO_CACHE));
-  server->sendHeader(FPSTR(WM_HTTP_EXPIRES), "-1");
+  return _scanServed && (server->arg("refresh") == "1");
+}
 
-  int n;
-  int *indices;
+//////////////////////////////////////////
 
-  //Space for indices array allocated on heap in scanWifiNetworks
-  //and should be freed when indices no longer required.
+WM_ScanFilter ESP_WiFiManager::defaultScanFilter()
+{
+  WM_ScanFilter filter;
 
-  n = scanWifiNetworks(&indices);
-  LOGDEBUG(F("In handleScan, scanWifiNetworks done"));
-  String page = F("{\"Access_Points\":[");
+  filter._offset      = 0;
+  filter._limit       = 0;
+  filter._minRSSI     = -128;
+  filter._ssidPrefix  = NULL;
+  filter._auth        = WM_AUTH_ANY;
+  filter._channel     = 0;
+  filter._band        = 0;
 
-  //display networks in page
-  for (int i = 0; i < n; i++)
-  {
-    if (indices[i] == -1)
-      continue; // skip duplicates and those that are below the required quality
+  return filter;
+}
 
-    if (i != 0)
-      page += F(", ");
+//////////////////////////////////////////
 
-    LOGDEBUG1(F("Index ="), i);
-    LOGDEBUG1(F("SSID ="), WiFi.SSID(indices[i]));
-    LOGDEBUG1(F("RSSI ="), WiFi.RSSI(indices[i]));
+bool ESP_WiFiManager::scanResultMatches(const WM_ScanResult& result, const WM_ScanFilter& filter)
+{
+  if (result._rssi < filter._minRSSI)
+    return false;
 
-    int quality = getRSSIasQuality(WiFi.RSSI(indices[i]));
-    String item = FPSTR(JSON_ITEM);
-    String rssiQ;
-    
-    rssiQ += quality;
-    item.replace("{v}", WiFi.SSID(indices[i]));
-    item.replace("{r}", rssiQ);
+  if ( filter._ssidPrefix && (strncmp(result._ssid, filter._ssidPrefix, strlen(filter._ssidPrefix)) != 0) )
+    return false;
 
 #ifdef ESP8266
-    if (WiFi.encryptionType(indices[i]) != ENC_TYPE_NONE)
+  bool open = (result._encryption == ENC_TYPE_NONE);
 #else		//ESP32
-    if (WiFi.encryptionType(indices[i]) != WIFI_AUTH_OPEN)
+  bool open = (result._encryption == WIFI_AUTH_OPEN);
 #endif
-    {
-      item.replace("{i}", "true");
-    }
-    else
-    {
-      item.replace("{i}", "false");
-    }
-    //LOGDEBUG(item);
-    page += item;
-    delay(0);
-  }
 
-  if (indices)
-  {
-    free(indices); //indices array no longer required so free memory
-  }
+  if ( (filter._auth == WM_AUTH_SECURED) && open )
+    return false;
 
-  page += F("]}");
-  
-  server->send(200, "application/json", page);
-  
-  LOGDEBUG(F("Sent WiFiScan Data in Json format"));
+  if ( (filter._auth >= 0) && (result._encryption != filter._auth) )
+    return false;
+
+  if ( filter._channel && (result._channel != filter._channel) )
+    return false;
+
+  // Channels above 14 are in the 5GHz band
+  if ( filter._band && ( (filter._band == 5) != (result._channel > 14) ) )
+    return false;
+
+  return true;
 }
 
 //////////////////////////////////////////
 
-/** Handle the reset page */
-void ESP_WiFiManager::handleReset()
+// Filter from the ?offset=&limit=&rssi=&prefix=&auth=&channel=&band= arguments of the request.
+// auth is open, secured or the encryption type number of the driver. ssidPrefix keeps the prefix of the filter.
+void ESP_WiFiManager::parseScanFilter(WM_ScanFilter& filter, String& ssidPrefix, int defaultLimit)
 {
-  LOGDEBUG(F("Reset"));
-  
-  server->sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  server->sendHeader("Pragma", "no-cache");
-  server->sendHeader("Expires", "-1");
-  
-  String page = FPSTR(WM_HTTP_HEAD_START);
-  
-  page.replace("{v}", "WiFi Information");
-  page += FPSTR(WM_HTTP_SCRIPT);
-  page += FPSTR(WM_HTTP_SCRIPT_NTP);
-  page += FPSTR(WM_HTTP_STYLE);
-  page += _customHeadElement;
-  page += FPSTR(WM_HTTP_HEAD_END);
-  page += F("Resetting");
-  page += FPSTR(WM_HTTP_END);
-  
-  server->send(200, "text/html", page);
+  filter        = defaultScanFilter();
+  filter._limit = defaultLimit;
 
-  LOGDEBUG(F("Sent reset page"));
-  delay(5000);
-  
-  // New in v1.0.11
-  // Temporary fix for issue of not clearing WiFi SSID/PW from flash of ESP32
-  // See https://github.com/khoih-prog/ESP_WiFiManager/issues/25 and https://github.com/espressif/arduino-esp32/issues/400
-  resetSettings();
-  //WiFi.disconnect(true); // Wipe out WiFi credentials.
-  //////
+  if (server->hasArg("offset"))
+    filter._offset = std::max(0L, server->arg("offset").toInt());
+
+  if (server->hasArg("limit"))
+    filter._limit = std::max(0L, server->arg("limit").toInt());
+
+  if (server->hasArg("rssi"))
+    filter._minRSSI = server->arg("rssi").toInt();
+
+  ssidPrefix = server->arg("prefix");
 
+  if (ssidPrefix.length() > 0)
+    filter._ssidPrefix = ssidPrefix.c_str();
+
+  String auth = server->arg("auth");
+
+  if (auth == "open")
+  {
 #ifdef ESP8266
-  ESP.reset();
+    filter._auth = ENC_TYPE_NONE;
 #else		//ESP32
-  ESP.restart();
+    filter._auth = WIFI_AUTH_OPEN;
 #endif
+  }
+  else if (auth == "secured")
+    filter._auth = WM_AUTH_SECURED;
+  else if (auth.length() > 0)
+    filter._auth = auth.toInt();
 
-  delay(2000);
+  if (server->hasArg("channel"))
+    filter._channel = server->arg("channel").toInt();
+
+  if (server->hasArg("band"))
+    filter._band = server->arg("band").toInt();
 }
 
 //////////////////////////////////////////
 
-void ESP_WiFiManager::handleNotFound()
+// The filter arguments of the request but offset and limit, as &name=value with the values percent-encoded
+void ESP_WiFiManager::appendFilterArgs(String& query)
 {
-  if (captivePortal())
+  static const char* const names[] = { "rssi", "prefix", "auth", "channel", "band" };
+
+  for (const char* name : names)
   {
-    // If caprive portal redirect instead of displaying the error page.
-    return;
-  }
+    String value = server->arg(name);
 
-  String message = "File Not Found\n\n";
-  
-  message += "URI: ";
-  message += server->uri();
-  message += "\nMethod: ";
-  message += (server->method() == HTTP_GET) ? "GET" : "POST";
-  message += "\nArguments: ";
-  message += server->args();
-  message += "\n";
+    if (value.length() == 0)
+      continue;
 
-  for (uint8_t i = 0; i < server->args(); i++)
-  {
-    message += " " + server->argName(i) + ": " + server->arg(i) + "\n";
-  }
+    query += '&';
+    query += name;
+    query += '=';
 
-  server->sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  server->sendHeader("Pragma", "no-cache");
-  server->sendHeader("Expires", "-1");
-  
-  server->send(404, "text/plain", message);
+    for (const char* c = value.c_str(); *c != 0; c++)
+    {
+      if ( isalnum((uint8_t) *c) || (*c == '-') || (*c == '_') || (*c == '.') || (*c == '~') )
+      {
+        query += *c;
+      }
+      else
+      {
+        char hex[4];
+
+        snprintf(hex, sizeof(hex), "%%%02X", (uint8_t) *c);
+        query += hex;
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////
 
-/**
-   HTTPD redirector
-   Redirect to captive portal if we got a request for another domain.
-   Return true in that case so the page handler do not try to handle the request again.
-*/
-bool ESP_WiFiManager::captivePortal()
+#if USE_PORTAL_ETAG
+uint32_t ESP_WiFiManager::scanFilterTag(uint32_t tag, const WM_ScanFilter& filter)
 {
-  if (!isIp(server->hostHeader()))
-  {
-    LOGDEBUG(F("Request redirected to captive portal"));
-    
-    server->sendHeader(F("Location"), (String)F("http://") + toStringIp(server->client().localIP()), true);
-    server->send(302, FPSTR(WM_HTTP_HEAD_CT2), ""); // Empty content inhibits Content-length header so we have to close the socket ourselves.
-    server->client().stop(); // Stop is needed because we sent no content length
-    
-    return true;
-  }
-  return false;
+  tag = tagOf(tag, &filter._offset,   sizeof(filter._offset));
+  tag = tagOf(tag, &filter._limit,    sizeof(filter._limit));
+  tag = tagOf(tag, &filter._minRSSI,  sizeof(filter._minRSSI));
+  tag = tagOf(tag, &filter._auth,     sizeof(filter._auth));
+  tag = tagOf(tag, &filter._channel,  sizeof(filter._channel));
+  tag = tagOf(tag, &filter._band,     sizeof(filter._band));
+
+  return tagOf(tag, filter._ssidPrefix ? filter._ssidPrefix : "");
 }
+#endif
 
 //////////////////////////////////////////
 
-//start up config portal callback
-void ESP_WiFiManager::setAPCallback(void(*func)(ESP_WiFiManager* myWiFiManager))
+int ESP_WiFiManager::getScanResults(const WM_ScanResult **results, bool refresh)
 {
-  _apcallback = func;
+#if USE_ASYNC_WIFI_SCAN
+  // Let a background scan finish rather than starting another one
+  while (_scanState == WM_SCAN_RUNNING)
+  {
+    processScan();
+    delay(10);
+  }
+#endif
+
+  if ( !scanResultsFresh() || (refresh && _scanServed) )
+    scanNow();
+
+  _scanServed = true;
+
+  *results = _scanResults;
+
+  return _numScanResults;
 }
 
 //////////////////////////////////////////
 
-//start up save config callback
-void ESP_WiFiManager::setSaveConfigCallback(void(*func)())
+const WM_ScanResult* ESP_WiFiManager::findScanResult(const char* ssid)
 {
-  _savecallback = func;
+  // Results are RSSI sorted, the first one is the strongest BSSID
+  for (int i = 0; i < _numScanResults; i++)
+  {
+    if (strcmp(_scanResults[i]._ssid, ssid) == 0)
+      return &_scanResults[i];
+  }
+
+  return NULL;
 }
 
 //////////////////////////////////////////
 
-//sets a custom element to add to head, like a new style tag
-void ESP_WiFiManager::setCustomHeadElement(const char* element) {
-  _customHeadElement = element;
-}
+#if USE_ASYNC_WIFI_SCAN
 
-//if this is true, remove duplicated Access Points - defaut true
-void ESP_WiFiManager::setRemoveDuplicateAPs(bool removeDuplicates)
+// Start a background scan, unless one is already running. The current results stay available meanwhile.
+void ESP_WiFiManager::startScan()
 {
-  _removeDuplicateAPs = removeDuplicates;
+  if (_scanState == WM_SCAN_RUNNING)
+    return;
+
+  LOGDEBUG(F("Start async scan"));
+
+  if (WiFi.scanNetworks(true) == WIFI_SCAN_FAILED)
+  {
+    LOGDEBUG(F("Async scan failed to start"));
+
+    _scanState = WM_SCAN_IDLE;
+    return;
+  }
+
+  _scanStart = millis();
+  _scanState = WM_SCAN_RUNNING;
 }
 
 //////////////////////////////////////////
 
-//Scan for WiFiNetworks in range and sort by signal strength
-//space for indices array allocated on the heap and should be freed when no longer required
-int ESP_WiFiManager::scanWifiNetworks(int **indicesptr)
+// Called from the Config Portal loop, picks up the results of the background scan
+void ESP_WiFiManager::processScan()
 {
-  LOGDEBUG(F("Scanning Network"));
+  if (_scanState != WM_SCAN_RUNNING)
+    return;
 
-  int n = WiFi.scanNetworks();
+  int n = WiFi.scanComplete();
 
-  LOGDEBUG1(F("scanWifiNetworks: Done, Scanned Networks n ="), n); 
+  if ( (n == WIFI_SCAN_RUNNING) && (millis() - _scanStart < WM_ASYNC_SCAN_TIMEOUT_MS) )
+    return;
 
-  //KH, Terrible bug here. WiFi.scanNetworks() returns n < 0 => malloc( negative == very big ) => crash!!!
-  //In .../esp32/libraries/WiFi/src/WiFiType.h
-  //#define WIFI_SCAN_RUNNING   (-1)
-  //#define WIFI_SCAN_FAILED    (-2)
-  //if (n == 0)
-  if (n <= 0)
+  LOGDEBUG1(F("Async scan done, n ="), n);
+
+  if (n < 0)
   {
-    LOGDEBUG(F("No network found"));
-    return (0);
+    // Failed or timed out, keep the previous results. They are not fresh, so the next request retries.
+    _scanState = WM_SCAN_IDLE;
+    return;
   }
-  else
-  {
-    // Allocate space off the heap for indices array.
-    // This space should be freed when no longer required.
-    int* indices = (int *)malloc(n * sizeof(int));
 
-    if (indices == NULL)
-    {
-      LOGDEBUG(F("ERROR: Out of memory"));
-      *indicesptr = NULL;
-      return (0);
-    }
+  storeScanResults(n);
+}
 
-    *indicesptr = indices;
-   
-    //sort networks
-    for (int i = 0; i < n; i++)
-    {
-      indices[i] = i;
-    }
+#endif
 
-    LOGDEBUG(F("Sorting"));
+//////////////////////////////////////////
 
-    // RSSI SORT
-    // old sort
-    for (int i = 0; i < n; i++)
-    {
-      for (int j = i + 1; j < n; j++)
-      {
-        if (WiFi.RSSI(indices[j]) > WiFi.RSSI(indices[i]))
-        {
-          std::swap(indices[i], indices[j]);
-        }
-      }
-    }
+#if USE_RTC_SCAN_CACHE
 
-    LOGDEBUG(F("Removing Dup"));
+#ifdef ESP32
+// Not initialized at reset, so it survives ESP.restart()
+static RTC_NOINIT_ATTR WM_RTCScanCache WM_rtcScanCache;
+#endif
 
-    // remove duplicates ( must be RSSI sorted )
-    if (_removeDuplicateAPs)
-    {
-      String cssid;
-      for (int i = 0; i < n; i++)
-      {
-        if (indices[i] == -1)
-          continue;
+void ESP_WiFiManager::saveScanResultsToRTC()
+{
+  WM_RTCScanCache cache;
 
-        cssid = WiFi.SSID(indices[i]);
-        for (int j = i + 1; j < n; j++)
-        {
-          if (cssid == WiFi.SSID(indices[j]))
-          {
-            LOGDEBUG1("DUP AP:", WiFi.SSID(indices[j]));
-            indices[j] = -1; // set dup aps to index -1
-          }
-        }
-      }
-    }
+  memset(&cache, 0, sizeof(cache));
 
-    for (int i = 0; i < n; i++)
-    {
-      if (indices[i] == -1)
-        continue; // skip dups
+  cache._magic  = WM_RTC_SCAN_MAGIC;
+  cache._count  = std::min(_numScanResults, WM_RTC_SCAN_RESULTS);
 
-      int quality = getRSSIasQuality(WiFi.RSSI(indices[i]));
+  memcpy(cache._results, _scanResults, cache._count * sizeof(WM_ScanResult));
 
-      if (!(_minimumQuality == -1 || _minimumQuality < quality))
-      {
-        indices[i] = -1;
-        LOGDEBUG(F("Skipping low quality"));
-      }
-    }
+  cache._checksum = tagOf(tagOf(WM_TAG_INIT, &cache._count, sizeof(cache._count)), cache._results, sizeof(cache._results));
 
-#if (DEBUG_WIFIMGR > 2)
-    for (int i = 0; i < n; i++)
-    {
-      if (indices[i] == -1)
-        continue; // skip dups
-      else
-        Serial.println(WiFi.SSID(indices[i]));
-    }
+#ifdef ESP8266
+  ESP.rtcUserMemoryWrite(WM_RTC_SCAN_ADDRESS, (uint32_t*) &cache, sizeof(cache));
+#else		//ESP32
+  WM_rtcScanCache = cache;
 #endif
+}
 
-    return (n);
+//////////////////////////////////////////
+
+void ESP_WiFiManager::loadScanResultsFromRTC()
+{
+  WM_RTCScanCache cache;
+
+#ifdef ESP8266
+  if (!ESP.rtcUserMemoryRead(WM_RTC_SCAN_ADDRESS, (uint32_t*) &cache, sizeof(cache)))
+    return;
+#else		//ESP32
+  cache = WM_rtcScanCache;
+#endif
+
+  if ( (cache._magic != WM_RTC_SCAN_MAGIC) || (cache._count == 0) || (cache._count > WM_RTC_SCAN_RESULTS) ||
+       (cache._checksum != tagOf(tagOf(WM_TAG_INIT, &cache._count, sizeof(cache._count)), cache._results, sizeof(cache._results))) )
+  {
+    LOGDEBUG(F("No scan results in RTC memory"));
+    return;
   }
+
+  WM_ScanResult* results = (WM_ScanResult *)malloc(cache._count * sizeof(WM_ScanResult));
+
+  if (results == NULL)
+    return;
+
+  memcpy(results, cache._results, cache._count * sizeof(WM_ScanResult));
+
+  if (_scanResults)
+    free(_scanResults);
+
+  _scanResults    = results;
+  _numScanResults = cache._count;
+  // Only the strongest ones are kept in RTC memory
+  _scanPartial    = true;
+
+  // Shown, but not fresh : _scanState stays WM_SCAN_IDLE
+
+#if USE_PORTAL_ETAG
+  updateScanTag();
+#endif
+
+  LOGDEBUG1(F("Scan results restored from RTC memory, n ="), _numScanResults);
 }
 
+#endif
+
 //////////////////////////////////////////
 
 int ESP_WiFiManager::getRSSIasQuality(int RSSI)
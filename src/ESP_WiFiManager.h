@@ -59,10 +59,36 @@
 
 #include <DNSServer.h>
 #include <memory>
+#include <atomic>
 #undef min
 #undef max
 #include <algorithm>
 
+// Servers of the Config Portal. Another transport, such as the POSIX sockets of the host build in extras/linux,
+// is given as classes with the API of ESP8266WebServer / WebServer and DNSServer.
+#ifndef WM_WEB_SERVER_TYPE
+  #ifdef ESP8266
+    #define WM_WEB_SERVER_TYPE        ESP8266WebServer
+  #else		//ESP32
+    #define WM_WEB_SERVER_TYPE        WebServer
+  #endif
+#endif
+
+#ifndef WM_DNS_SERVER_TYPE
+  #define WM_DNS_SERVER_TYPE          DNSServer
+#endif
+
+typedef WM_WEB_SERVER_TYPE            WM_WebServer;
+typedef WM_DNS_SERVER_TYPE            WM_DNSServer;
+
+#ifndef WM_HTTP_PORT
+  #define WM_HTTP_PORT                80
+#endif
+
+#ifndef WM_DNS_PORT
+  #define WM_DNS_PORT                 53
+#endif
+
 //KH, for ESP32
 #ifdef ESP8266
   extern "C"
@@ -114,38 +140,291 @@ typedef struct
   #define USING_CORS_FEATURE     false
 #endif
 
+// Stream Config Portal pages with chunked transfer encoding instead of building the whole page in one String.
+// Heap used per request is then bounded by WM_PAGE_CHUNK_SIZE, whatever the number of networks or parameters.
+#ifndef USE_CHUNKED_PORTAL_PAGES
+  #define USE_CHUNKED_PORTAL_PAGES    true
+#endif
+
+// Small fragments are coalesced into one chunk of this size before being written to the client
+#ifndef WM_PAGE_CHUNK_SIZE
+  #define WM_PAGE_CHUNK_SIZE          512
+#endif
+
+// Serve style, scripts and logo as separate, gzipped and browser-cached files (/wm.css, /wm.js, /tz.js, /logo.png)
+// instead of inlining them in every page. You have to explicitly specify false to disable the feature.
+#ifndef USE_PORTAL_ASSETS
+  #define USE_PORTAL_ASSETS           true
+#endif
+
+// Tag pages and JSON replies with an ETag derived from what they show, and answer a matching If-None-Match
+// with an empty 304. Polling /state, /scan or /i then costs a few dozen bytes as long as nothing changed.
+#ifndef USE_PORTAL_ETAG
+  #define USE_PORTAL_ETAG             true
+#endif
+
+// Scan in the background while the Config Portal keeps serving DNS and HTTP. Requests arriving during a scan
+// share it: /wifi shows the last results or a waiting message, /scan answers 202 until the results are in.
+#ifndef USE_ASYNC_WIFI_SCAN
+  #define USE_ASYNC_WIFI_SCAN         true
+#endif
+
+#if USE_ASYNC_WIFI_SCAN
+  // A scan not completed after this time, in ms, is given up
+  #ifndef WM_ASYNC_SCAN_TIMEOUT_MS
+    #define WM_ASYNC_SCAN_TIMEOUT_MS  15000
+  #endif
+
+  // Results nobody fetched yet stay fresh this long, in ms, whatever the TTL, for the clients polling /scan
+  #ifndef WM_ASYNC_SCAN_GRACE_MS
+    #define WM_ASYNC_SCAN_GRACE_MS    5000
+  #endif
+#endif
+
+// Connect to the BSSID and channel found by the last scan for the SSID saved in the Config Portal, which saves
+// the scan of all channels by the WiFi driver. Falls back to any BSSID of the SSID if that fails.
+#ifndef USE_SCANNED_BSSID
+  #define USE_SCANNED_BSSID           true
+#endif
+
+// Known networks kept by ESP_WiFiManager, see addCredential(). Each one takes sizeof(WM_Credential) = 128 bytes of RAM.
+#ifndef WM_MAX_CREDENTIALS
+  #define WM_MAX_CREDENTIALS          4
+#endif
+
+// Connection statistics of the known networks, which order the attempts of connectKnown(). Past this number of
+// attempts, the success and failure counts are halved so that the recent ones weigh more.
+#ifndef WM_CREDENTIAL_HISTORY
+  #define WM_CREDENTIAL_HISTORY       32
+#endif
+
+// A network which failed that many times in a row is skipped, but for one attempt every WM_CREDENTIAL_RETRY_EVERY
+// connections, or when no other network could connect.
+#ifndef WM_CREDENTIAL_FAIL_STREAK
+  #define WM_CREDENTIAL_FAIL_STREAK   3
+#endif
+
+#ifndef WM_CREDENTIAL_RETRY_EVERY
+  #define WM_CREDENTIAL_RETRY_EVERY   8
+#endif
+
+// Follow the station link with the WiFi events of the core instead of polling WiFi.status(). Events are queued by
+// the WiFi task and handled by process(), which updates connectionState() and calls the setWiFiEventCallback().
+#ifndef USE_WIFI_EVENTS
+  #define USE_WIFI_EVENTS             true
+#endif
+
+#if USE_WIFI_EVENTS
+  // Events waiting for process(), power of 2. Further ones are dropped, and counted.
+  #ifndef WM_WIFI_EVENT_QUEUE_SIZE
+    #define WM_WIFI_EVENT_QUEUE_SIZE  8
+  #endif
+
+  #ifdef ESP32
+    // Event names and info fields changed with the ESP32 core v2.0.0
+    #if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 2) )
+      #define WM_ESP32_STA_CONNECTED        ARDUINO_EVENT_WIFI_STA_CONNECTED
+      #define WM_ESP32_STA_GOT_IP           ARDUINO_EVENT_WIFI_STA_GOT_IP
+      #define WM_ESP32_STA_DISCONNECTED     ARDUINO_EVENT_WIFI_STA_DISCONNECTED
+      #define WM_ESP32_AP_START             ARDUINO_EVENT_WIFI_AP_START
+      #define WM_ESP32_CONNECTED_INFO       wifi_sta_connected
+      #define WM_ESP32_DISCONNECTED_INFO    wifi_sta_disconnected
+    #else
+      #define WM_ESP32_STA_CONNECTED        SYSTEM_EVENT_STA_CONNECTED
+      #define WM_ESP32_STA_GOT_IP           SYSTEM_EVENT_STA_GOT_IP
+      #define WM_ESP32_STA_DISCONNECTED     SYSTEM_EVENT_STA_DISCONNECTED
+      #define WM_ESP32_AP_START             SYSTEM_EVENT_AP_START
+      #define WM_ESP32_CONNECTED_INFO       connected
+      #define WM_ESP32_DISCONNECTED_INFO    disconnected
+    #endif
+  #endif
+#endif
+
+// A connection directed to a BSSID ( scanned or from RTC memory ) and not associated after this time, in ms,
+// is retried with any BSSID
+#ifndef WM_HINTED_ASSOCIATE_TIMEOUT_MS
+  #define WM_HINTED_ASSOCIATE_TIMEOUT_MS    3000
+#endif
+
+// Time given to a connection when setConnectTimeout() was not called, in ms, as WiFi.waitForConnectResult()
+#ifndef WM_CONNECT_TIMEOUT_MS
+  #define WM_CONNECT_TIMEOUT_MS       60000
+#endif
+
+// End a connection as soon as the WiFi driver reports a failure which retrying cannot fix ( wrong password, network
+// not found, handshake timeout, association rejected ) instead of waiting for the timeout. Needs USE_WIFI_EVENTS
+// for the disconnect reasons, otherwise only the failures of WiFi.status() are seen.
+#ifndef WM_FAIL_FAST
+  #define WM_FAIL_FAST                true
+#endif
+
+// Delay between the save page and the connection to the new AP, for the page to reach the client, in ms
+#ifndef WM_SAVE_CONNECT_DELAY_MS
+  #define WM_SAVE_CONNECT_DELAY_MS    2000
+#endif
+
+// Upper bounds of the waits for the WiFi driver, in ms. The waits end as soon as it is ready : soft AP started with
+// its IP address, station disconnected, or connected for autoConnect()
+#ifndef WM_AP_START_TIMEOUT_MS
+  #define WM_AP_START_TIMEOUT_MS      1000
+#endif
+
+#ifndef WM_DISCONNECT_TIMEOUT_MS
+  #define WM_DISCONNECT_TIMEOUT_MS    200
+#endif
+
+#ifndef WM_AUTOCONNECT_WAIT_MS
+  #define WM_AUTOCONNECT_WAIT_MS      10000
+#endif
+
+// Once the connection from the Config Portal has ended, the portal keeps running until /connectstatus has told the
+// result to the browser, or at most this time, in ms
+#ifndef WM_CONNECT_RESULT_GRACE_MS
+  #define WM_CONNECT_RESULT_GRACE_MS  5000
+#endif
+
+// Run the non-blocking Config Portal, with its DNS server, web server, background scan and connection, in a task of
+// its own instead of the loop() task, so that a slow handler does not stall the sketch. See startConfigPortalTask().
+// FreeRTOS task on ESP32, std::thread on a host build.
+#ifndef USE_PORTAL_TASK
+  #define USE_PORTAL_TASK             false
+#endif
+
+#if USE_PORTAL_TASK
+  #if defined(ARDUINO_ARCH_ESP8266)
+    #error USE_PORTAL_TASK needs ESP32, the ESP8266 core has no tasks
+  #endif
+
+  #if ( defined(ESP32) && defined(ESP_PLATFORM) )
+    #define WM_PORTAL_TASK_FREERTOS   true
+  #else
+    #define WM_PORTAL_TASK_FREERTOS   false
+  #endif
+
+  // Core the task is pinned to, or tskNO_AFFINITY. loop() runs on core 1, the WiFi driver on core 0.
+  #ifndef WM_PORTAL_TASK_CORE
+    #define WM_PORTAL_TASK_CORE       0
+  #endif
+
+  // Same as the loop() task
+  #ifndef WM_PORTAL_TASK_PRIORITY
+    #define WM_PORTAL_TASK_PRIORITY   1
+  #endif
+
+  // In bytes, as xTaskCreatePinnedToCore() takes it
+  #ifndef WM_PORTAL_TASK_STACK_SIZE
+    #define WM_PORTAL_TASK_STACK_SIZE 8192
+  #endif
+
+  // Longest wait of stopConfigPortalTask() for the task to end, in ms. The portal ends at the next process() of the
+  // task, unless a handler or a scan is running.
+  #ifndef WM_PORTAL_TASK_STOP_TIMEOUT_MS
+    #define WM_PORTAL_TASK_STOP_TIMEOUT_MS  5000
+  #endif
+
+  // Portal events waiting for getPortalEvent(), power of 2. Further ones are dropped.
+  #ifndef WM_PORTAL_EVENT_QUEUE_SIZE
+    #define WM_PORTAL_EVENT_QUEUE_SIZE  8
+  #endif
+
+  #include <mutex>
+
+  #if WM_PORTAL_TASK_FREERTOS
+    #include <freertos/FreeRTOS.h>
+    #include <freertos/task.h>
+  #else
+    #include <thread>
+  #endif
+#endif
+
+// Scan results are shared by /wifi, /scan and getScanResults(), and only rescanned once older than this, in ms.
+// Can be changed at runtime with setScanCacheTTL()
+#ifndef WM_SCAN_CACHE_TTL_MS
+  #define WM_SCAN_CACHE_TTL_MS        10000
+#endif
+
+// Keep only the K strongest networks of each scan in memory, 0 for all. Can be changed with setScanTopK()
+#ifndef WM_SCAN_TOP_K
+  #define WM_SCAN_TOP_K               0
+#endif
+
+// Networks listed per /wifi page, 0 for all. A link leads to the next ones.
+#ifndef WM_WIFI_PAGE_SIZE
+  #define WM_WIFI_PAGE_SIZE           20
+#endif
+
+// Keep the strongest networks of the last scan in RTC memory, to show them at once after a reboot into the Config Portal
+#ifndef USE_RTC_SCAN_CACHE
+  #define USE_RTC_SCAN_CACHE          false
+#endif
+
+#if USE_RTC_SCAN_CACHE
+  // Number of networks kept
+  #ifndef WM_RTC_SCAN_RESULTS
+    #define WM_RTC_SCAN_RESULTS       6
+  #endif
+
+  // ESP8266 only : offset in RTC user memory, in 4-byte blocks. Default leaves the first 128 bytes to
+  // ESP_DoubleResetDetector and the sketch.
+  #ifndef WM_RTC_SCAN_ADDRESS
+    #define WM_RTC_SCAN_ADDRESS       32
+  #endif
+#endif
+
+// Keep the BSSID and channel of the last successful connection in RTC memory, and connect straight to them after a
+// reset or deep sleep instead of letting the WiFi driver scan all channels. Falls back to a normal connection on a miss.
+#ifndef USE_RTC_FAST_CONNECT
+  #define USE_RTC_FAST_CONNECT        false
+#endif
+
+#if USE_RTC_FAST_CONNECT
+  // Also reuse the DHCP lease ( IP, gateway, mask and DNS ) as static IP, which saves the DHCP exchange.
+  // Not used when a static IP is configured. Only safe if the DHCP server keeps giving the same address.
+  #ifndef USE_RTC_FAST_CONNECT_IP
+    #define USE_RTC_FAST_CONNECT_IP   false
+  #endif
+
+  // ESP8266 only : offset in RTC user memory, in 4-byte blocks. Default is after the scan cache.
+  #ifndef WM_RTC_FAST_CONNECT_ADDRESS
+    #define WM_RTC_FAST_CONNECT_ADDRESS   104
+  #endif
+#endif
+
 //KH
 //Mofidy HTTP_HEAD to WM_HTTP_HEAD_START to avoid conflict in Arduino esp8266 core 2.6.0+
 const char WM_HTTP_200[] PROGMEM = "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\n\r\n";
 const char WM_HTTP_HEAD_START[] PROGMEM = "<!DOCTYPE html><html lang=\"en\"><head><meta name=\"viewport\" content=\"width=device-width, initial-scale=1, user-scalable=no\"/><meta http-equiv=\"Content-Type\" content=\"text/html; charset=utf-8\" /><title>{v}</title>";
 
-// KH, update from v1.0.10
-const char WM_HTTP_STYLE[] PROGMEM = "<style>div{padding:2px;font-size:1em;}body,textarea,input,select{background: 0;border-radius: 0;font: 14px sans-serif;margin: 0}textarea,input,select{outline: 0;font-size: 12px;padding: 8px;width: 90%} input{border-radius:0.5em} .btn a{text-decoration: none}.container{margin: auto;width: 100%}@media(min-width:1200px){.container{margin: auto;width: 30%}}@media(min-width:768px) and (max-width:1200px){.container{margin: auto;width: 50%;padding:20px;}}.btn{font-size: 1em;},.h2{font-size: 0em;}h1{font-size: 2em}.btn{background: #6A9C31;border-radius: 4px;border: 0;color: #fff;cursor: pointer;display: inline-block;margin: 2px 0;padding: 10px 14px 11px;width: 100%}.btn:hover{background: #810D70}.btn:active,.btn:focus{background: #08b}label>*{display: inline}form>*{display: block;margin-bottom: 10px}textarea:focus,input:focus,select:focus{border-color: #5ab}.msg{background: #def;border-left: 5px solid #59d;padding: 1.5em}.q{float: right;width: 64px;text-align: right}.l{background: url('data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAACAAAAAgCAMAAABEpIrGAAAALVBMVEX///8EBwfBwsLw8PAzNjaCg4NTVVUjJiZDRUUUFxdiZGSho6OSk5Pg4eFydHTCjaf3AAAAZElEQVQ4je2NSw7AIAhEBamKn97/uMXEGBvozkWb9C2Zx4xzWykBhFAeYp9gkLyZE0zIMno9n4g19hmdY39scwqVkOXaxph0ZCXQcqxSpgQpONa59wkRDOL93eAXvimwlbPbwwVAegLS1HGfZAAAAABJRU5ErkJggg==') no-repeat left center;background-size: 1em}input[type='checkbox']{float: left;width: 20px}.table td{padding:.5em;text-align:left}.table tbody>:nth-child(2n-1){background:#ddd}fieldset{border:0px;margin:0px;}</style>";
-//////
-
-// KH, update from v1.1.0
-const char WM_HTTP_SCRIPT[] PROGMEM = "<script>function c(l){document.getElementById('s').value=l.innerText||l.textContent;document.getElementById('p').focus();document.getElementById('s1').value=l.innerText||l.textContent;document.getElementById('p1').focus();}</script>";
-//////
-
 // From v1.0.9 to permit disable or configure NTP from sketch
 #ifndef USE_ESP_WIFIMANAGER_NTP
   // From v1.0.6 to enable NTP config
   #define USE_ESP_WIFIMANAGER_NTP     true
 #endif
 
-#if USE_ESP_WIFIMANAGER_NTP
-
-const char WM_HTTP_SCRIPT_NTP_MSG[] PROGMEM = "";
-
 // From v1.0.9 to permit disable or configure NTP from sketch
 #ifndef USE_CLOUDFLARE_NTP
   #define USE_CLOUDFLARE_NTP          false
 #endif
 
+// Style, scripts and logo generated from extras/portal, served as files or inlined below
+#include "ESP_WiFiManager_Assets.h"
+
+// KH, update from v1.0.10
+const char WM_HTTP_STYLE[] PROGMEM = "<style>" WM_ASSET_WM_CSS_INLINE "</style>";
+//////
+
+// KH, update from v1.1.0
+const char WM_HTTP_SCRIPT[] PROGMEM = "<script>" WM_ASSET_WM_JS_INLINE "</script>";
+//////
+
+#if USE_ESP_WIFIMANAGER_NTP
+
+const char WM_HTTP_SCRIPT_NTP_MSG[] PROGMEM = "";
+
 #if USE_CLOUDFLARE_NTP
 const char WM_HTTP_SCRIPT_NTP[] PROGMEM = "<script src='https://cdnjs.cloudflare.com/ajax/libs/jstimezonedetect/1.0.4/jstz.min.js'></script><script>var timezone=jstz.determine();console.log('Your timezone is:' + timezone.name());document.getElementById('timezone').innerHTML = timezone.name();</script>";
 #else
-const char WM_HTTP_SCRIPT_NTP[] PROGMEM = "<script>(function(e){var t=function(){\"use strict\";var e=\"s\",n=function(e){var t=-e.getTimezoneOffset();return t!==null?t:0},r=function(e,t,n){var r=new Date;return e!==undefined&&r.setFullYear(e),r.setDate(n),r.setMonth(t),r},i=function(e){return n(r(e,0,2))},s=function(e){return n(r(e,5,2))},o=function(e){var t=e.getMonth()>7?s(e.getFullYear()):i(e.getFullYear()),r=n(e);return t-r!==0},u=function(){var t=i(),n=s(),r=i()-s();return r<0?t+\",1\":r>0?n+\",1,\"+e:t+\",0\"},a=function(){var e=u();return new t.TimeZone(t.olson.timezones[e])},f=function(e){var t=new Date(2010,6,15,1,0,0,0),n={\"America/Denver\":new Date(2011,2,13,3,0,0,0),\"America/Mazatlan\":new Date(2011,3,3,3,0,0,0),\"America/Chicago\":new Date(2011,2,13,3,0,0,0),\"America/Mexico_City\":new Date(2011,3,3,3,0,0,0),\"America/Asuncion\":new Date(2012,9,7,3,0,0,0),\"America/Santiago\":new Date(2012,9,3,3,0,0,0),\"America/Campo_Grande\":new Date(2012,9,21,5,0,0,0),\"America/Montevideo\":new Date(2011,9,2,3,0,0,0),\"America/Sao_Paulo\":new Date(2011,9,16,5,0,0,0),\"America/Los_Angeles\":new Date(2011,2,13,8,0,0,0),\"America/Santa_Isabel\":new Date(2011,3,5,8,0,0,0),\"America/Havana\":new Date(2012,2,10,2,0,0,0),\"America/New_York\":new Date(2012,2,10,7,0,0,0),\"Asia/Beirut\":new Date(2011,2,27,1,0,0,0),\"Europe/Helsinki\":new Date(2011,2,27,4,0,0,0),\"Europe/Istanbul\":new Date(2011,2,28,5,0,0,0),\"Asia/Damascus\":new Date(2011,3,1,2,0,0,0),\"Asia/Jerusalem\":new Date(2011,3,1,6,0,0,0),\"Asia/Gaza\":new Date(2009,2,28,0,30,0,0),\"Africa/Cairo\":new Date(2009,3,25,0,30,0,0),\"Pacific/Auckland\":new Date(2011,8,26,7,0,0,0),\"Pacific/Fiji\":new Date(2010,11,29,23,0,0,0),\"America/Halifax\":new Date(2011,2,13,6,0,0,0),\"America/Goose_Bay\":new Date(2011,2,13,2,1,0,0),\"America/Miquelon\":new Date(2011,2,13,5,0,0,0),\"America/Godthab\":new Date(2011,2,27,1,0,0,0),\"Europe/Moscow\":t,\"Asia/Yekaterinburg\":t,\"Asia/Omsk\":t,\"Asia/Krasnoyarsk\":t,\"Asia/Irkutsk\":t,\"Asia/Yakutsk\":t,\"Asia/Vladivostok\":t,\"Asia/Kamchatka\":t,\"Avrupa/Türkiye\":t,\"Australia/Perth\":new Date(2008,10,1,1,0,0,0)};return n[e]};return{determine:a,date_is_dst:o,dst_start_for:f}}();t.TimeZone=function(e){\"use strict\";var n={\"America/Denver\":[\"America/Denver\",\"America/Mazatlan\"],\"America/Chicago\":[\"America/Chicago\",\"America/Mexico_City\"],\"America/Santiago\":[\"America/Santiago\",\"America/Asuncion\",\"America/Campo_Grande\"],\"America/Montevideo\":[\"America/Montevideo\",\"America/Sao_Paulo\"],\"Asia/Beirut\":[\"Asia/Beirut\",\"Europe/Helsinki\",\"Europe/Istanbul\",\"Asia/Damascus\",\"Asia/Jerusalem\",\"Asia/Gaza\"],\"Pacific/Auckland\":[\"Pacific/Auckland\",\"Pacific/Fiji\"],\"America/Los_Angeles\":[\"America/Los_Angeles\",\"America/Santa_Isabel\"],\"America/New_York\":[\"America/Havana\",\"America/New_York\"],\"America/Halifax\":[\"America/Goose_Bay\",\"America/Halifax\"],\"America/Godthab\":[\"America/Miquelon\",\"America/Godthab\"],\"Asia/Dubai\":[\"Europe/Moscow\"],\"Asia/Dhaka\":[\"Asia/Yekaterinburg\"],\"Asia/Jakarta\":[\"Asia/Omsk\"],\"Asia/Shanghai\":[\"Asia/Krasnoyarsk\",\"Australia/Perth\"],\"Asia/Tokyo\":[\"Asia/Irkutsk\"],\"Australia/Brisbane\":[\"Asia/Yakutsk\"],\"Pacific/Noumea\":[\"Asia/Vladivostok\"],\"Pacific/Tarawa\":[\"Asia/Kamchatka\"],\"Africa/Johannesburg\":[\"Asia/Gaza\",\"Africa/Cairo\"],\"Asia/Baghdad\":[\"Europe/Minsk\"]},r=e,i=function(){var e=n[r],i=e.length,s=0,o=e[0];for(;s<i;s+=1){o=e[s];if(t.date_is_dst(t.dst_start_for(o))){r=o;return}}},s=function(){return typeof n[r]!=\"undefined\"};return s()&&i(),{name:function(){return r}}},t.olson={},t.olson.timezones={\"-720,0\":\"Etc/GMT+12\",\"-660,0\":\"Pacific/Pago_Pago\",\"-600,1\":\"America/Adak\",\"-600,0\":\"Pacific/Honolulu\",\"-570,0\":\"Pacific/Marquesas\",\"-540,0\":\"Pacific/Gambier\",\"-540,1\":\"America/Anchorage\",\"-480,1\":\"America/Los_Angeles\",\"-480,0\":\"Pacific/Pitcairn\",\"-420,0\":\"America/Phoenix\",\"-420,1\":\"America/Denver\",\"-360,0\":\"America/Guatemala\",\"-360,1\":\"America/Chicago\",\"-360,1,s\":\"Pacific/Easter\",\"-300,0\":\"America/Bogota\",\"-300,1\":\"America/New_York\",\"-270,0\":\"America/Caracas\",\"-240,1\":\"America/Halifax\",\"-240,0\":\"America/Santo_Domingo\",\"-240,1,s\":\"America/Santiago\",\"-210,1\":\"America/St_Johns\",\"-180,1\":\"America/Godthab\",\"-180,0\":\"America/Argentina/Buenos_Aires\",\"-180,1,s\":\"America/Montevideo\",\"-120,0\":\"Etc/GMT+2\",\"-120,1\":\"Etc/GMT+2\",\"-60,1\":\"Atlantic/Azores\",\"-60,0\":\"Atlantic/Cape_Verde\",\"0,0\":\"Etc/UTC\",\"0,1\":\"Europe/London\",\"60,1\":\"Europe/Berlin\",\"60,0\":\"Africa/Lagos\",\"60,1,s\":\"Africa/Windhoek\",\"120,1\":\"Asia/Beirut\",\"120,0\":\"Africa/Johannesburg\",\"180,0\":\"Asia/Baghdad\",\"180,1\":\"Europe/Moscow\",\"210,1\":\"Asia/Tehran\",\"240,0\":\"Asia/Dubai\",\"240,1\":\"Asia/Baku\",\"270,0\":\"Asia/Kabul\",\"300,1\":\"Asia/Yekaterinburg\",\"300,0\":\"Asia/Karachi\",\"330,0\":\"Asia/Kolkata\",\"345,0\":\"Asia/Kathmandu\",\"360,0\":\"Asia/Dhaka\",\"360,1\":\"Asia/Omsk\",\"390,0\":\"Asia/Rangoon\",\"420,1\":\"Asia/Krasnoyarsk\",\"420,0\":\"Asia/Jakarta\",\"480,0\":\"Asia/Shanghai\",\"480,1\":\"Asia/Irkutsk\",\"525,0\":\"Australia/Eucla\",\"525,1,s\":\"Australia/Eucla\",\"540,1\":\"Asia/Yakutsk\",\"540,0\":\"Asia/Tokyo\",\"570,0\":\"Australia/Darwin\",\"570,1,s\":\"Australia/Adelaide\",\"600,0\":\"Australia/Brisbane\",\"600,1\":\"Asia/Vladivostok\",\"600,1,s\":\"Australia/Sydney\",\"630,1,s\":\"Australia/Lord_Howe\",\"660,1\":\"Asia/Kamchatka\",\"660,0\":\"Pacific/Noumea\",\"690,0\":\"Pacific/Norfolk\",\"720,1,s\":\"Pacific/Auckland\",\"720,0\":\"Pacific/Tarawa\",\"765,1,s\":\"Pacific/Chatham\",\"780,0\":\"Pacific/Tongatapu\",\"780,1,s\":\"Pacific/Apia\",\"840,0\":\"Pacific/Kiritimati\"},typeof exports!=\"undefined\"?exports.jstz=t:e.jstz=t})(this);</script><script>var timezone=jstz.determine();console.log('Your timezone is:' + timezone.name());document.getElementById('timezone').innerHTML = timezone.name();</script>";
+const char WM_HTTP_SCRIPT_NTP[] PROGMEM = "<script>" WM_ASSET_TZ_JS_INLINE "</script>";
 #endif
 
 #else
@@ -154,7 +433,17 @@ const char WM_HTTP_SCRIPT_NTP[] PROGMEM = "";
 #endif
 
 // KH, update from v1.0.10
-const char WM_HTTP_HEAD_END[] PROGMEM = "</head><body><div class=\"container\"><div style=\"text-align:center;margin:auto;display:block;\"><img style=\"padding:20px\" width=\"200px\" src=\"data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAQoAAABcCAIAAAAZCWzAAAAACXBIWXMAAAsTAAALEwEAmpwYAAAKT2lDQ1BQaG90b3Nob3AgSUNDIHByb2ZpbGUAAHjanVNnVFPpFj333vRCS4iAlEtvUhUIIFJCi4AUkSYqIQkQSoghodkVUcERRUUEG8igiAOOjoCMFVEsDIoK2AfkIaKOg6OIisr74Xuja9a89+bN/rXXPues852zzwfACAyWSDNRNYAMqUIeEeCDx8TG4eQuQIEKJHAAEAizZCFz/SMBAPh+PDwrIsAHvgABeNMLCADATZvAMByH/w/qQplcAYCEAcB0kThLCIAUAEB6jkKmAEBGAYCdmCZTAKAEAGDLY2LjAFAtAGAnf+bTAICd+Jl7AQBblCEVAaCRACATZYhEAGg7AKzPVopFAFgwABRmS8Q5ANgtADBJV2ZIALC3AMDOEAuyAAgMADBRiIUpAAR7AGDIIyN4AISZABRG8lc88SuuEOcqAAB4mbI8uSQ5RYFbCC1xB1dXLh4ozkkXKxQ2YQJhmkAuwnmZGTKBNA/g88wAAKCRFRHgg/P9eM4Ors7ONo62Dl8t6r8G/yJiYuP+5c+rcEAAAOF0ftH+LC+zGoA7BoBt/qIl7gRoXgugdfeLZrIPQLUAoOnaV/Nw+H48PEWhkLnZ2eXk5NhKxEJbYcpXff5nwl/AV/1s+X48/Pf14L7iJIEyXYFHBPjgwsz0TKUcz5IJhGLc5o9H/LcL//wd0yLESWK5WCoU41EScY5EmozzMqUiiUKSKcUl0v9k4t8s+wM+3zUAsGo+AXuRLahdYwP2SycQWHTA4vcAAPK7b8HUKAgDgGiD4c93/+8//UegJQCAZkmScQAAXkQkLlTKsz/HCAAARKCBKrBBG/TBGCzABhzBBdzBC/xgNoRCJMTCQhBCCmSAHHJgKayCQiiGzbAdKmAv1EAdNMBRaIaTcA4uwlW4Dj1wD/phCJ7BKLyBCQRByAgTYSHaiAFiilgjjggXmYX4IcFIBBKLJCDJiBRRIkuRNUgxUopUIFVIHfI9cgI5h1xGupE7yAAygvyGvEcxlIGyUT3UDLVDuag3GoRGogvQZHQxmo8WoJvQcrQaPYw2oefQq2gP2o8+Q8cwwOgYBzPEbDAuxsNCsTgsCZNjy7EirAyrxhqwVqwDu4n1Y8+xdwQSgUXACTYEd0IgYR5BSFhMWE7YSKggHCQ0EdoJNwkDhFHCJyKTqEu0JroR+cQYYjIxh1hILCPWEo8TLxB7iEPENyQSiUMyJ7mQAkmxpFTSEtJG0m5SI+ksqZs0SBojk8naZGuyBzmULCAryIXkneTD5DPkG+Qh8lsKnWJAcaT4U+IoUspqShnlEOU05QZlmDJBVaOaUt2ooVQRNY9aQq2htlKvUYeoEzR1mjnNgxZJS6WtopXTGmgXaPdpr+h0uhHdlR5Ol9BX0svpR+iX6AP0dwwNhhWDx4hnKBmbGAcYZxl3GK+YTKYZ04sZx1QwNzHrmOeZD5lvVVgqtip8FZHKCpVKlSaVGyovVKmqpqreqgtV81XLVI+pXlN9rkZVM1PjqQnUlqtVqp1Q61MbU2epO6iHqmeob1Q/pH5Z/YkGWcNMw09DpFGgsV/jvMYgC2MZs3gsIWsNq4Z1gTXEJrHN2Xx2KruY/R27iz2qqaE5QzNKM1ezUvOUZj8H45hx+Jx0TgnnKKeX836K3hTvKeIpG6Y0TLkxZVxrqpaXllirSKtRq0frvTau7aedpr1Fu1n7gQ5Bx0onXCdHZ4/OBZ3nU9lT3acKpxZNPTr1ri6qa6UbobtEd79up+6Ynr5egJ5Mb6feeb3n+hx9L/1U/W36p/VHDFgGswwkBtsMzhg8xTVxbzwdL8fb8VFDXcNAQ6VhlWGX4YSRudE8o9VGjUYPjGnGXOMk423GbcajJgYmISZLTepN7ppSTbmmKaY7TDtMx83MzaLN1pk1mz0x1zLnm+eb15vft2BaeFostqi2uGVJsuRaplnutrxuhVo5WaVYVVpds0atna0l1rutu6cRp7lOk06rntZnw7Dxtsm2qbcZsOXYBtuutm22fWFnYhdnt8Wuw+6TvZN9un2N/T0HDYfZDqsdWh1+c7RyFDpWOt6azpzuP33F9JbpL2dYzxDP2DPjthPLKcRpnVOb00dnF2e5c4PziIuJS4LLLpc+Lpsbxt3IveRKdPVxXeF60vWdm7Obwu2o26/uNu5p7ofcn8w0nymeWTNz0MPIQ+BR5dE/C5+VMGvfrH5PQ0+BZ7XnIy9jL5FXrdewt6V3qvdh7xc+9j5yn+M+4zw33jLeWV/MN8C3yLfLT8Nvnl+F30N/I/9k/3r/0QCngCUBZwOJgUGBWwL7+Hp8Ib+OPzrbZfay2e1BjKC5QRVBj4KtguXBrSFoyOyQrSH355jOkc5pDoVQfujW0Adh5mGLw34MJ4WHhVeGP45wiFga0TGXNXfR3ENz30T6RJZE3ptnMU85ry1KNSo+qi5qPNo3ujS6P8YuZlnM1VidWElsSxw5LiquNm5svt/87fOH4p3iC+N7F5gvyF1weaHOwvSFpxapLhIsOpZATIhOOJTwQRAqqBaMJfITdyWOCnnCHcJnIi/RNtGI2ENcKh5O8kgqTXqS7JG8NXkkxTOlLOW5hCepkLxMDUzdmzqeFpp2IG0yPTq9MYOSkZBxQqohTZO2Z+pn5mZ2y6xlhbL+xW6Lty8elQfJa7OQrAVZLQq2QqboVFoo1yoHsmdlV2a/zYnKOZarnivN7cyzytuQN5zvn//tEsIS4ZK2pYZLVy0dWOa9rGo5sjxxedsK4xUFK4ZWBqw8uIq2Km3VT6vtV5eufr0mek1rgV7ByoLBtQFr6wtVCuWFfevc1+1dT1gvWd+1YfqGnRs+FYmKrhTbF5cVf9go3HjlG4dvyr+Z3JS0qavEuWTPZtJm6ebeLZ5bDpaql+aXDm4N2dq0Dd9WtO319kXbL5fNKNu7g7ZDuaO/PLi8ZafJzs07P1SkVPRU+lQ27tLdtWHX+G7R7ht7vPY07NXbW7z3/T7JvttVAVVN1WbVZftJ+7P3P66Jqun4lvttXa1ObXHtxwPSA/0HIw6217nU1R3SPVRSj9Yr60cOxx++/p3vdy0NNg1VjZzG4iNwRHnk6fcJ3/ceDTradox7rOEH0x92HWcdL2pCmvKaRptTmvtbYlu6T8w+0dbq3nr8R9sfD5w0PFl5SvNUyWna6YLTk2fyz4ydlZ19fi753GDborZ752PO32oPb++6EHTh0kX/i+c7vDvOXPK4dPKy2+UTV7hXmq86X23qdOo8/pPTT8e7nLuarrlca7nuer21e2b36RueN87d9L158Rb/1tWeOT3dvfN6b/fF9/XfFt1+cif9zsu72Xcn7q28T7xf9EDtQdlD3YfVP1v+3Njv3H9qwHeg89HcR/cGhYPP/pH1jw9DBY+Zj8uGDYbrnjg+OTniP3L96fynQ89kzyaeF/6i/suuFxYvfvjV69fO0ZjRoZfyl5O/bXyl/erA6xmv28bCxh6+yXgzMV70VvvtwXfcdx3vo98PT+R8IH8o/2j5sfVT0Kf7kxmTk/8EA5jz/GMzLdsAAAAgY0hSTQAAeiUAAICDAAD5/wAAgOkAAHUwAADqYAAAOpgAABdvkl/FRgAAG9FJREFUeNrsXXtYU1e23wkhCXlAgPCQh0EeAiIIgkTwAW0RFLW1to6OtdZb63RG207v1Lb66VhF+9D5vDptraPt197WdvRqpdo6pb4qVlEe4SEIKBgQDJAHkBBCSEhI7h9nmjKQs3NyHort+f2hJHuffXbO2b+911p7rbUZdrsd/DZgthp6jW1tuspuQ6verDYO6UxWg9k6aP/3I2CyPXgcloDHFnlzggIFkRLf5ADBJLaHF6DxWwXjV08Pha6qva9KoatRGZpMFgMAwG4H9l/+ZQAw8iMYWYHr6R0sjJkoSpzkNz3SP5UeLjQ9fiXoNytvay7cUp3VDMjRRr9LetgBsAMA7MAOQAA/Ijl0/pSgrAD+RHrc0PR4WNFrbK3uOFav/JcN2MDPQ5w4PRxfTg1+ZG7kynDRFHr00PR4yFaMa3c/atJccIxmKuiBfBMTkJ47eR1NEpoeDwXs19sO1nQcHbYPjxrHFNEDKUoJyV2c8GcBW0SPJJoe4xTt2usldz/oHbwLGccU0cNuB16e3vPjXsyULKEHE02PcYfy9kOVis9djmNPJk/kFS7kBAs5ATy2H8/Tj+vpzfbgeTDZwG63A/ugRW+09OlNmj6TUjeo7BlQ9Jk0WOjxs0KS9XTSRiHHjx5SND3GBQaGNOeatqj6b6JN8wwGa4IwIcQnOdJvlj8/ku3Bc9qOzW41WQdsdqt1eMhiM5uthkFLv96kURtauvrvdA/cGzD3DtttcHrYAfBiCZ9PfzfKP4UeVTQ9HjDu6a5fbH7LZB2xjzGCHhF+s6L8syW+Uj5bPPIqVf+tDn1dz0Bbr/Fen0llGOoxWYxOhSsWkyPgiJkMT6NFbxzqc6nSOL58IuHl7KgV9MCi6fHA0KT512X523YAbCNVBQA8mV7xQY/HBuQFCuIclbWD7QpdzT1ddWd/vdaoIF33GP2lHWRFLX9y6iv02KLp8QBQrzxxrW0fMhYd9GAwPBOCl6SGruax/ZFqZquhpfdKs6ZY3nOFUtV8LD3sAKSG5a5OfYseXg87WA9Xd290HaloPzjqS4lv5pzI14ScCcjHPlPHTeXpuq5TJqsBPCDuyxTnLMNDa9PfpkcYvXrcJ9xUHi1r/2DkVO3B5D0StTXSPxupoDd1lrYfvq0+dz8Nu05XD+Tj9LCcNWk76EFGrx6UQ95ztrz9g5HfTBRlzonchCjfZqu+tP1wfdcpG7CNnz5XKi6IuEFLpq6nxxlNDwrRPXDrJ/l/TMMpoWvSwv+A/N2o+ras/fCApXcc9vxC81diQejsiCfooUbTgxJYhgeKbm0Y+c2siI1TgpYCAAaG1Fdb/6el56fxLCAerd4zURQ3URRLjzZa9yAf527/uUNf4RD3cyfvDRdlAADudJ8rlr9rtZndUhLup+7h+Mhisvc9foHJ8KAH3MMF5jjvX6PqeKe+wvFxfux+hBs1nUd+vLPdajM/FE/ZMjz0Yclr9GijhSsyYbL0lt/bj/xtB+CxmPdCfdKRjw4z7gMEh8UL5Ef48cOEbD8Oi4fQQG/q6TZ2qQzt/ab/0IUa1RXl7WfTJ+bRY46mBzkolm9x/J0heU3iO9fxMco/56byRJe+7v73SswPj/ZPm+SXHBOQzvP0dlrHarM0qstua2Q3u65pBjqQL/9X9nZ8kFTIEdHDjtY9iEJlqDl7az0ivscEPD4rYtOoCmpD/Td169xVEnDrHkzAig+amz5xSZSbQec1ncUXmo/Je+qAHaSEPvKHmbvoYUfTgygK65YazEo7ACJu5BNTv3Rap+TuvrquE1TTg8fymR35zLSQPG+OGPfPaVCVfV37Qae+9U+Zu6dNmE2PPJoe+NGuu3xZvtluB3bAWJp4QsgJQWfRC6r+Boro4eXpMzty1YywJzgsPim/60Tt+1UdxW9mHxJ5BdCDj6YHTpy+uVxvvme3g8yILdHihZCaNrvl/2qe1Q62k06PhKBHF8Zv5LF9yP1pzd01XBY/XBRDDz6aHnjQ0Vdy6c7rdgD8eQn58R+7rD9ss3xz808qQwNZ9PDnReRM/lNsAC0C0fQYf/S4JN/YobtmB+DppO+8PP0xXnW1df+NzuME6eHrFZ4V+V+JE2jzKw0AxqFh12ozdfaVAgBiA57Czg0AwOxJr0b6ZZUrPrunleG4b5S/dFrIoilBj7p1lU6nUyqVTovEYrFYLKZHGE0PMnGn+1s7sDGZnBkT/9vda0N8Upb4pNzVXm/WXLyrLRsY6nF5SaAgKtJfOjlgbphPIo7eVldXHzt2zGlRTk7OsmXL6BFG04NMyHu+BQAkBK1i4HV4ifDNiPDNGLYNyXt+Uhuaeo3t/UPqwSG9xWYGgOHJ9OJ6+vhwJwTwo8NE08J8koj01tPTE62Iw+HQw4umB5kwW/t0gy1MBitpwhqCTXkw2ZMDciYH5Di+sdmtADDI9QtkMBg4imjQ9MADzUAtACA+cAWDAudWJoNFv28a7o2ZcdWb1p7vAQBxgcvpF0ODpsdo3NNd9uFGuGWwokHjN0GPgSEVACAldAP9VmjQ9BgNtaEKABDqM4t+KzRoeozRyw01frw4+pXQoOnhBMO2oUj/fPqV0KDp4QR8dvAEbyn9SmjQ9BgNq21QyJ0o4ITSr4QGTY/RGLL289nBjHGfOYXGbwrjZSOZxeJ6MyT0+6BB08MJ2ExvHCvH4OCgUqlUq9W9vb0Gg8FoNP5MNpZAIPDz8wsMDAwJCREKhePniQ8ODioUiq6uLq1WazAYrFYrAIDBYAgEAqFQKBaLg4ODJ0x4MGmKtFqtUqnUaDR9fX0Gg2FoaAj53svLC+kb8jwhjpj3Gd3d3Uqlsru7G+kw8jABADwez9vbWywWBwUFhYSEMJk4pRJWaWnp8PCw0zJ/f/+4OHIsrVVVVYODg06LvHhe01Omu9WaXq+vq6urrKyUy+Umkwle2dPTMyIiQiqVJiYmikQip3UqKyudtpOQkIB2CQ40NjZevXq1vr4e7VE4EBAQkJqampaWFh4efh8GmUKhqK2trays7OjocBkeJxQK4+Li0tPTExISPDw8nHKsoaHBmYDASktLc3qJu2htba2urr5x4wZasM1IiESihISEGTNmxMfHO62gVCrlcvnY3kqlUlZ1dXVNTQ1a0wcPHsTNPAd6enoOHTqEVpqbm4udHgqFoqio6MaNGxaLBeMlFoulubm5ubmZxWIlJycvXLgwJGR0YofDhw87vXbDhg2k0KOxsbGwsLC9vR1jfY1G88MPP/zwww9xcXGPP/54VFQURcSorKy8cOFCS0sL9kv6+/srKioqKipEIlFGRkZ+fj6bzR5ZQS6Xf/HFF06vTUpK8vLyItLhkpKSS5cu3bt3D/slOp2upKSkpKQkMDBw7ty5OTk5o5ypq6urT506NfZCqVTKWr58OYQejY2NCQkJBN8BpH0Wi/Xkk09i/JGFhYVlZWW4u2G1WmUymUwmy8jIWLZsGZ/PH7lO9vT0OF15cN/OsSZ/9dVXP/30E75Gbt26devWrczMzOeee45cYjQ0NJw5c2bsrOnWsCsqKiopKZk3b15ubu4vcvJ/ssUBDodDxMm/vLy8qKios7MTdwtqtfrrr78uLi5esGDB7Nm/JBJwylgkXIfl5+cXHh6ORseSkhLi9Lhy5QpaUUpKCpbV6cqVKydOnDCbycmoe/369Zs3b65cuXL69H+vWmivjcjrDAwMBADs27fv1q1bBDt87dq1tra2devWkaKTWK3Wr7/++tKlS6Q8TL1ef/Lkyfr6+pUrVwYFBUFq4n6YAwMDR48eraioIEtdOXLkSENDw+9//3uIUor0lgkAWLhwIWTx1ev1RHrT0tLS1dWFVvrYY4+5bOHzzz//8ssvyeKGQ0I4dOjQd999h3y02cg/NMdoNH711VfEuYGgo6OjoKCgra2NYDsajWbHjh1kcWPkKrd9+/ampiZAdhxYS0vLtm3byOLGyIFdUFCgUqkAABB1i4lM4SMljbENEewHWlF4ePikSZMg19rt9t27d1+7do0iyfvMmTPff/89RB4ggpMnT+KWqZzCZrPt2bNHo9HgbqGpqWn79u1qtZqKh2mz2fbu3avT6SZOnEhWmzKZbPfu3QaDgYoO6/X6goICAEBYWBiMHgCA1FTUvLEEiQuhR0ZGBvxx79y50y2tEQdOnz5dWlpKRUoRKlYkq9W6d+9e3OaBvXv3OkyfFOFvf/tbbW0ti0XChkFZWdnHH39MaW+tVuv+/fsVCgXaisdyCDloU51cLler1YgkjWNl1Gq1aLJdeno65No9e/Z0dHRgvFFkZGRQUJCvr6+XlxeTyTSZTHq9XqVStbW1ubSifvbZZ5DFkwogxngfHx8ejwcAMJlMSEIgLHqnVqs9cuTIs88+69Ydu7q69u/fj7Eyn8+XSCSBgYHe3t5cLnd4eNhoNPb29qpUqrt377qU7L/88kvi9Kivr//0008xVvb19Q0PDxeLxUKhkMPhWK3WgYGBnp4epVKpUChczhq3b99GNR0h/wUHB0+ePBmRHcfi8uXL+HLSnD9/Hq1IKpVCFKNPPvmktbXVZfthYWEzZsxIS0tDm/6NRmNVVVVVVVV9fT1c+bsPrGAwGBkZGVKpFG03SS6Xl5aWXrlyBb75cPXq1fnz5wcEYM3Sa7FY9uzZg6XmtGnTpk+fnpKSgpZmRaVSVVRUyGQyiD6JzMpEHlRPT8/777+PpWZaWlpqampycjKagaetra2qqqqiosKpZdLlOv8LyzMzM9HoUV1djYMeNputrg71/I05c+agFV2+fNmlRCcUCpcuXZqZmQmvxuPxZs+ePXv2bLlcfuzYMew7D6QjJiZm9erV8EU4KioqKipq3rx5hw8fhpv2T506tW7dOoy3PnjwoMOfAHLrp59+OjIy0uW6t2jRokWLFhUXF586dcrlyowPBw4ccFknKSlp2bJlLoUaiUQikUiWLFlSVFT07bffupsT9BfOOaycTtmMw2bS2NiItnknFAqjo6PR5vt//vOf8JYTExN37drlkhujXv+WLVsWLVr0QLiRlZW1ceNGjAJqYGDg1q1b4UYLmUwGmQ5HLTXwlRMA8NRTT73xxhsuuTES2dnZO3funDp1KunP6tSpUy6F6ueee27Dhg3YBX4Gg5Gfn79jxw53vRB+oQeHw4HM6OfOnSNRspo/fz5aEdoGtgO5ubkvvfQSl8vF8egXL1784osv3mduzJkzZ+XKle5e9frrr8N/IxaLotFoPH78OLzOSy+9NHJTDzuEQuHLL7/8yCOPkPisent7i4qKIBW4XO6bb77p1sw4cunbunVrWloaHnogIw+tXk1NDZprFprVrLGxEa105J7lSCgUCshVAIC8vLynnnqKyAuYPn36K6+8ct+4ERYWtmrVKhwXenh4rF27FlIBy45KYWEhfL/otddeS0xMJPIDV6xYMXfuXLIe1+eff+6SG26tcmOxbt26adOm4aFHYGAg2san1Wq9efMm9k7cuHEDrSg+Ph5tXkTLV+vQ5pcuXUr8HSQkJKxevfr+0GPNmjW4r01KSoJsk7vUoywWy9WrVyEV1q5dO3nyZOK/8ZlnniHIMcfSAef8K6+8MtZfDgfWr18fGhrqNj0AAPPmzUOreuHCBew9KCkpQSvKz3ceUK5Wq5ubm9Gu8vHxef7558katbNmzXJrkcWH6Ohogi63M2bMQCvq7++HWy3Pnz8P0USzsrLghnW38Mc//lEgEBBs5OzZs5DS3/3udyS6Zv7lL3/BYn1mjhV70Pzwmpqa+vr6sNy7s7MTzSzr6+uLNmPBhekNG0jOf7V69Wp8Cgx2LFiwgGALkO1aRBaFlEL27LlcLg51CAIWi/XCCy8QacFqtUI6HBISgsX/CDsEAgEWYyxzrI6fnJyMVruqqgrLvWUyGURAQiuCeOPGxMRIJCTHEnI4HIzOwrhHDHHRJTg4GLKjD7GrqlQqtA1ZAAC53HDIzHBrGxy3b9+G7D+QKDg4kJ2d7e3t7R49ANRNsLy8nCA90BxJlEolZKdpxYoVFNmUSInOcYrQ0FBSXLkg6ocjms8txZ3H40EmKSJYvhx/cmSIXB0aGkpRWJjL+dEJPSZNmoTWm5aWFsTJEf470erExsYGBwc7LYLskQcHB0OcxojAw8MDYssmCHxuOGMBiceCTLcQuYsibiAjx8cH50mlEOc66jqcnp4Onx+ZaJor2gWXL1+G3xJiLYHYyCFLR1JSEqAM1D163ANl7GSPVgRxHYdMN5CXSxz4NgqNRiPa6sFkMkk0IYwVgGNiYtymh1QqRWOVS/WjtrYWrSuQgd7d3Q2Zk6h7nWFhYRQlFiDrdCgc3TMYDGg+KTwej9L4dYjiCoFGo0FbCUNCQnx9fanrcGxsrNv04PF4aBuTWq0WEoHZ3NyM5t6TlZUFWcggNjGypBSnYLPZ8Bg33CAeo+9yiUADRCmnOgcKvmAPSMgd1R3GQw+AvrENoN4iP/74I1oR3DCHZoRhMpkuzQvUCfdEQNaJ2DjagWRvoejHOsDn8yHSIES4QiuidOlw+UBQ6REREeHv7/wYmrq6OqceyyaTCU30mjBhAlprCNCcF9lsNtVnWBLMnTEOAUnjQvVWj6enJw56QExwVL99DocD2R+ECQBojoNWq9WpEyjEfT0vLw/eSzSHLiaTSZaUggbqbLsPCpBwC6ofJr5bQNz5qO4wfIDB7j1z5ky0K53KV2iOJBwOBx43CxmjVqvVLVdIHKC6/fsPCOHvw4/FcQvIAL0Pbx9GTrjaimana25u1ul0I7/p7u5Gc7ZNSUnBbZ8ZGhqiOpTPZajQQwfIdiRFaQ0Ivi+IBEX12zebzTjpAQB49NFH0YpGqRmQnXIs3jIQgXUUD0kHxKb8kAKiTVH9Y/v7+12mdXWq0D+oDsMzv7igR3x8PJrdc5QDGZpDoUQiwWLsg2yiYU/IgG/pIJIaZ3zC19cXzRysVCqx51/FgTt37uC4CmKcpDr+GR5f5FrvQVMburq6HFuzCoUC7WdgDOyCON5BEkkQR2trKxUZdx4s+Hw+2pRks9nQ9m1JAUan1VEIDAxEMx/19fWhpUAgBU6zZZNADzAiBRbEFRkSsTASkDAXt8Kw3IVLH5mHFBBXg+Li4gc1GaOBy+VCnDtKS0sp6i3EvQArPUQiEVrUgUOgQosNhOdfHAlIhKTJZKLojfb390OiGh9qQATapqYmivTd0tJS3LleIaFOELWWIFxmUMBkVEYLJtbpdEajcXBwEE17hqRcGIWAgICIiAi00m+++YaKp3P69GnwKwXcV8JlLhh8cJn2AV+HzWYzkuuVXJhMJnh8IlZ6xMXFoVmWkGMonBYJhULIiHdLDDOZTCdPniT36bS3t0NSxz/sEIvFkDxxMpmMeDbrUThz5gyRRSk6Ohpijz59+nR/fz+5HYYnNnCDHgB92/v8+fNoK5S7KV7gwd/nzp0jV0WDnMjz60BOTg6k9ODBgyQmvZfL5Y509/jAZDLhGwBYcsNhR2Vl5fXr10mjR1ZWFpolxKnlh8FgwF+PUyUHkooOALBv3z6yjLDvv//+r2+7YxSys7Mh221arfbDDz8k5UY6ne7vf/878Xbg6bZaW1s/++wzUjqsUChcplNzjx5eXl5uRU5PmTIFhzMZPBrTZrO99957xIf1J5984jJx4K8D8AHX1NT0j3/8gzg3du3aRcpCxOPxZs6cCVf9jx49SvAunZ2db7/9NtY1DXu7kFNysK82LhcQ+D6JwWDYuXMnbilraGjogw8+IP0slXGL/Px8eDhAdXX1/v37cQ/uu3fvFhQUkKgVrFy5Eh7fUlxcTORUg9ra2l27dmHf6XKDHnFxcRijBfz9/bEnohuFZ599Fu50bTKZ9u7d69Lm4PTR7Ny5k9JdlPEGJpPp8lDCxsbGgoICHAbuc+fOvfvuu+TaiDkcjsssKjKZbNeuXe4e/GKz2QoLCw8cOOCWj6N73sLwtc/damhvFJ48E0FhYeE777xTWVmJZSZoa2v74osvDhw4QNHBSOMZU6dOdZluoru7+6OPPvr000+xmLNsNltVVdU777xDui0Rwdy5c10eZ3nv3r3du3cfP34cy4koZrP5+vXrb731Fo4p1b1jSjIyMtDMuGTRAwCQlJSUn5/v0tTd1tZ2+PBhX1/fmTNnxsbGBgUFeXt7I74JNpttYGBAo9G0t7eXlpa6PCqExWJRfWzSA8SqVavkcrnLkVRWVlZWVhYZGSmVSpFgOD6fj7iaWywWvV6vVCpv375dXl4OCdZF4OHhQcQR/cUXX9y0aZNLT+qLFy9evHgROWQ9LCxMLBbzeDxENrNYLFqttqurq6GhobKy0qX4x2AwnEZlukeP4ODg+Ph4uONAQkIC8ejwJ554QqvVYjG9abXaoqKioqIiBoMhEAi4XC6DwRgaGjIYDBhH/JIlS5qamuC+Nw87Nm3atHXrViynqLa0tCByC4vFEggEbDbbZrOZTCaMnvCenp55eXlY5lC4iLVly5a//vWvWEQD5Gxr5NYCgcDT09Nmsw0ODmKU+oKCgtLS0tDmYrdDsSAu7gjIymi/Zs0at9Lg2u32/v5+jUajVqt1Oh1GbsyYMWPBggWkbzmNN3A4nDfffNOtQHOr1arT6dRqdXd3N/YokVdffTUrK4v4UiwWizdt2uTWIWzIioF0GLtG9OqrryYmJqIF9LtNj6lTp0JSy7DZbOLnoDuwbt06SpMyRUREIJlhqQ4SGg8Qi8WbN28mJcM5GvLy8qKjo7HoA1ggkUg2b95Mae6IZ555xs/PD+KV6DY94LubUqmU3ODg1atX4zvW0CUSEhI2b97skJV/C2q6SCTatm0bbqMiHIsXL0aOlyBxMz4sLGzbtm3wTG1EVDLEmRAiwuEZyhDxCbsPInbk5ORs3ryZ3HxHCxYsuJ+H4IwfMBiM9evXr1q1isQZgc/nr1+/3nEwHbnzI5/P37hx4+LFi0ls09/f/4033nAY9CA7LSx8k1BYWNjYLK6I9YAiKWj79u0//vhjUVERFv3SpVlsVDgEmpHEpfkFEnkHSU7jFiDt4I77mzNnzpQpU86fP3/p0iXiE01ubu5Ij1U0xQNHkK0DixYtSk5OPnv2LMYk6BAdLD8/PycnZ6RW4/QxIr3Fef704sWLxzrAkHsCg1OrQGZm5rVr12QyGSRTo1PweLzk5GS0Q5N9fX2drrAuE3hyuVy0TUwc6Z7Q2kG7BZEMXf7+/itWrJg1a1ZpaemNGzfcdWYLCQlJTk6eOXPm2FhrNpvttMOIUZGIoLV27drs7Ozy8vKamhp3MxBIJJLU1NSMjIyxbgROXyLyDQN3Mr+xkwHVKcZGoqWlpaGhoa2traurC83uxGKxxGJxaGhoVFRUamoqpHtms9npc2Cz2XBRYXh4GG0KZ7FYbhleIBYktPmYrFsAAKqrq5ubm9vb21UqFdp65eXlFRQUJJFIYmNjIQYYm82G1gKHwyHCkJHPBJkiFQqFRqNBewV8Pj84OFgikcTHx0M8BtFeIpfL/f8BABNKsNFzVxqEAAAAAElFTkSuQmCC\" /><br/>";
+const char WM_HTTP_HEAD_END[] PROGMEM = "</head><body><div class=\"container\"><div style=\"text-align:center;margin:auto;display:block;\"><img style=\"padding:20px\" width=\"200px\" src=\"" WM_ASSET_LOGO_PNG_DATA_URI "\" /><br/>";
+
+#if USE_PORTAL_ASSETS
+
+// Links to the cached assets, in place of WM_HTTP_SCRIPT, WM_HTTP_SCRIPT_NTP, WM_HTTP_STYLE and WM_HTTP_HEAD_END
+const char WM_HTTP_SCRIPT_ASSET[]     PROGMEM = "<script src=\"/wm.js?v={v}\"></script>";
+const char WM_HTTP_SCRIPT_NTP_ASSET[] PROGMEM = "<script src=\"/tz.js?v={v}\"></script>";
+const char WM_HTTP_STYLE_ASSET[]      PROGMEM = "<link rel=\"stylesheet\" href=\"/wm.css?v={v}\">";
+const char WM_HTTP_HEAD_END_ASSET[]   PROGMEM = "</head><body><div class=\"container\"><div style=\"text-align:center;margin:auto;display:block;\"><img style=\"padding:20px\" width=\"200px\" src=\"/logo.png?v={v}\" /><br/>";
+
+#endif    // USE_PORTAL_ASSETS
 
 const char WM_FLDSET_START[]  PROGMEM = "<fieldset>";
 const char WM_FLDSET_END[]    PROGMEM = "</fieldset>";
@@ -163,6 +452,11 @@ const char WM_FLDSET_BORDER_START[]  PROGMEM = "<fieldset style='border: 2px sol
 
 const char WM_HTTP_PORTAL_OPTIONS[] PROGMEM = "<form action=\"/wifi\" method=\"get\"><button style=\"width:70%;margin-top:4em; \" class=\"btn\">Ayarlar</button></form><br/>";
 const char WM_HTTP_ITEM[] PROGMEM = "<div style='padding-bottom:5px'><a href=\"#p\" onclick=\"c(this)\">{v}</a>&nbsp;<span class=\"q {i}\">{r}%</span></div>";
+// Shown by /wifi while the background scan runs
+const char WM_HTTP_SCANNING[] PROGMEM = "<div class=\"msg\">Scanning WiFi networks...</div><script>setTimeout(function(){location.reload()},3000)</script>";
+const char WM_HTTP_CREDENTIALS_START[] PROGMEM = "<fieldset><legend>Saved networks</legend>";
+const char WM_HTTP_CREDENTIAL[] PROGMEM = "<form method=\"post\" action=\"credential\"><input type=\"hidden\" name=\"s\" value=\"{v}\"><div>{v}&nbsp;<input name=\"pr\" type=\"number\" min=\"0\" max=\"255\" value=\"{r}\" style=\"width:4em\">&nbsp;<button name=\"a\" value=\"set\">Priority</button>&nbsp;<button name=\"a\" value=\"del\">Remove</button></div></form>";
+const char WM_HTTP_MORE_NETWORKS[] PROGMEM = "<div><a href=\"/wifi?offset={o}&amp;limit={l}{f}\">More networks...</a></div>";
 const char JSON_ITEM[] PROGMEM = "{\"SSID\":\"{v}\", \"Encryption\":{i}, \"Quality\":\"{r}\"}";
 
 // KH, update from v1.1.0
@@ -183,6 +477,18 @@ const char WM_HTTP_FORM_END[] PROGMEM = "<button class=\"btn\" style=\"width:70%
 const char WM_HTTP_SAVED[] PROGMEM = "<div class=\"msg\"><b>Bağlantı kaydedildi!</b><br></div>";
 //////
 
+// Credentials rejected before any connection attempt, with a form to connect anyway when that may work
+const char WM_HTTP_SAVE_ERROR[] PROGMEM = "<div class=\"msg\"><b>{v}</b></div>";
+const char WM_HTTP_SAVE_BACK[] PROGMEM = "<form action=\"/wifi\" method=\"get\"><button class=\"btn\">Back</button></form>";
+const char WM_HTTP_FORCE_START[] PROGMEM = "<form method=\"get\" action=\"wifisave\"><input type=\"hidden\" name=\"force\" value=\"1\">";
+const char WM_HTTP_FORM_HIDDEN[] PROGMEM = "<input type=\"hidden\" name=\"{n}\" value=\"{v}\">";
+// Passwords are never sent back in the page, they are typed again
+const char WM_HTTP_FORCE_PASS[] PROGMEM = "<label for=\"{n}\">Password of {v}</label><input id=\"{n}\" name=\"{n}\" type=\"password\" length=64 placeholder=\"password\">";
+const char WM_HTTP_FORCE_END[] PROGMEM = "<button class=\"btn\" type=\"submit\">Connect anyway</button></form>";
+
+// Follows the connection to the saved network through /connectstatus
+const char WM_HTTP_SAVED_STATUS[] PROGMEM = "<div id=\"cs\" class=\"msg\">Connecting...</div><script>function cs(){fetch('/connectstatus').then(function(r){return r.json()}).then(function(j){var e=document.getElementById('cs');if(j.State=='failed')e.textContent='Connection failed : '+j.Failure;else if(j.State=='connected')e.textContent='Connected to '+j.SSID+', IP '+j.IP;else{e.textContent='Connecting... '+Math.round(j.Elapsed/1000)+' s';setTimeout(cs,1000)}}).catch(function(){setTimeout(cs,1000)})}setTimeout(cs,1000)</script>";
+
 const char WM_HTTP_END[] PROGMEM = "</div></body></html>";
 
 //KH, from v1.1.0
@@ -198,9 +504,32 @@ const char WM_HTTP_NO_CACHE[]        PROGMEM = "no-cache";
 const char WM_HTTP_EXPIRES[]         PROGMEM = "Expires";
 const char WM_HTTP_CORS[]            PROGMEM = "Access-Control-Allow-Origin";
 const char WM_HTTP_CORS_ALLOW_ALL[]  PROGMEM = "*";
+const char WM_HTTP_ETAG[]            PROGMEM = "ETag";
+const char WM_HTTP_IF_NONE_MATCH[]   PROGMEM = "If-None-Match";
+const char WM_HTTP_CONTENT_ENCODING[] PROGMEM = "Content-Encoding";
+const char WM_HTTP_GZIP[]            PROGMEM = "gzip";
+// Assets are versioned in their URL, so they can be cached for good
+const char WM_HTTP_CACHE_FOREVER[]   PROGMEM = "public, max-age=31536000, immutable";
+
+#if USE_PORTAL_ETAG
+// Tagged pages may be kept by the browser, but have to be revalidated before use
+const char WM_HTTP_REVALIDATE[]      PROGMEM = "no-cache";
+#else
+const char WM_HTTP_REVALIDATE[]      PROGMEM = "no-cache, no-store, must-revalidate";
+#endif
+
+// FNV-1a offset basis, start value of the page tags
+#define WM_TAG_INIT                  2166136261UL
+
+// Mixed into every ETag, so that the pages cached from another firmware, with other markup, are not reused after an OTA.
+// Define it to a release string in the sketch for ETags surviving identical rebuilds.
+#ifndef WM_TAG_BUILD
+  #define WM_TAG_BUILD                ESP_WIFIMANAGER_VERSION " " __DATE__ " " __TIME__ " " WM_ASSET_WM_CSS_VERSION \
+                                      WM_ASSET_WM_JS_VERSION WM_ASSET_TZ_JS_VERSION WM_ASSET_LOGO_PNG_VERSION
+#endif
 
 #if USE_AVAILABLE_PAGES
-const char WM_HTTP_AVAILABLE_PAGES[] PROGMEM = "<h3>Available Pages</h3><table class=\"table\"><thead><tr><th>Page</th><th>Function</th></tr></thead><tbody><tr><td><a href=\"/\">/</a></td><td>Menu page.</td></tr><tr><td><a href=\"/wifi\">/wifi</a></td><td>Show WiFi scan results and enter WiFi configuration.</td></tr><tr><td><a href=\"/wifisave\">/wifisave</a></td><td>Save WiFi configuration information and configure device. Needs variables supplied.</td></tr><tr><td><a href=\"/close\">/close</a></td><td>Close the configuration server and configuration WiFi network.</td></tr><tr><td><a href=\"/i\">/i</a></td><td>This page.</td></tr><tr><td><a href=\"/r\">/r</a></td><td>Delete WiFi configuration and reboot. ESP device will not reconnect to a network until new WiFi configuration data is entered.</td></tr><tr><td><a href=\"/state\">/state</a></td><td>Current device state in JSON format. Interface for programmatic WiFi configuration.</td></tr><tr><td><a href=\"/scan\">/scan</a></td><td>Run a WiFi scan and return results in JSON format. Interface for programmatic WiFi configuration.</td></tr></table>";
+const char WM_HTTP_AVAILABLE_PAGES[] PROGMEM = "<h3>Available Pages</h3><table class=\"table\"><thead><tr><th>Page</th><th>Function</th></tr></thead><tbody><tr><td><a href=\"/\">/</a></td><td>Menu page.</td></tr><tr><td><a href=\"/wifi\">/wifi</a></td><td>Show WiFi scan results and enter WiFi configuration.</td></tr><tr><td><a href=\"/wifisave\">/wifisave</a></td><td>Save WiFi configuration information and configure device. Needs variables supplied.</td></tr><tr><td><a href=\"/credential\">/credential</a></td><td>Change the priority of a saved network, or remove it. POST only, needs variables supplied.</td></tr><tr><td><a href=\"/close\">/close</a></td><td>Close the configuration server and configuration WiFi network.</td></tr><tr><td><a href=\"/i\">/i</a></td><td>This page.</td></tr><tr><td><a href=\"/r\">/r</a></td><td>Delete WiFi configuration and reboot. ESP device will not reconnect to a network until new WiFi configuration data is entered.</td></tr><tr><td><a href=\"/state\">/state</a></td><td>Current device state in JSON format. Interface for programmatic WiFi configuration.</td></tr><tr><td><a href=\"/scan\">/scan</a></td><td>Run a WiFi scan and return results in JSON format. Interface for programmatic WiFi configuration.</td></tr><tr><td><a href=\"/connectstatus\">/connectstatus</a></td><td>Progress and result of the connection to the saved network in JSON format.</td></tr></table>";
 #else
 const char WM_HTTP_AVAILABLE_PAGES[] PROGMEM = "";
 #endif
@@ -208,6 +537,302 @@ const char WM_HTTP_AVAILABLE_PAGES[] PROGMEM = "";
 //KH
 #define WIFI_MANAGER_MAX_PARAMS 20
 
+/////////////////////////////////////////////////////////////////////////////
+// Page templates ({v}, {i}, {r}, {p}, {n}, {l}, {c}, ...) are rendered in one pass, straight from PROGMEM.
+// Each slot carries its own escaping so SSIDs and parameter values can't break the HTML or JSON around them.
+typedef enum
+{
+  WM_ESCAPE_NONE = 0,
+  WM_ESCAPE_HTML,
+  WM_ESCAPE_JSON
+} WM_Escape;
+
+typedef struct
+{
+  const char *_name;          // Slot name between the braces, "v" for {v}
+  const char *_value;
+  WM_Escape   _escape;
+} WM_TemplateSlot;
+
+// Longest slot name accepted between the braces
+#define WM_TEMPLATE_MAX_SLOT_NAME     4
+
+// One scanned BSSID, read once from the WiFi driver so that sorting, duplicate removal and filtering
+// never call WiFi.RSSI() / WiFi.SSID() again. The SSID is the one of the scan record of the driver, not copied.
+typedef struct
+{
+  const char *_ssid;                  // Not NUL terminated when 32 long
+  uint32_t  _ssidHash;
+  uint8_t   _ssidLen;
+  int16_t   _index;                   // Index in the WiFi scan results
+  int8_t    _rssi;
+  uint8_t   _quality;
+  uint8_t   _channel;
+  uint8_t   _encryption;
+} WM_ScanEntry;
+
+typedef enum
+{
+  WM_SCAN_IDLE,                       // No fresh results. Those restored from RTC memory may be there.
+  WM_SCAN_RUNNING,
+  WM_SCAN_DONE
+} WM_ScanState;
+
+#if USE_WIFI_EVENTS
+typedef enum
+{
+  WM_EVENT_STA_CONNECTED,             // Associated with the AP
+  WM_EVENT_STA_GOT_IP,
+  WM_EVENT_STA_DISCONNECTED           // Link lost, or connection attempt failed
+} WM_WiFiEventType;
+
+typedef struct
+{
+  unsigned long     _time;            // millis() when the core reported it
+  WM_WiFiEventType  _type;
+  uint8_t           _reason;          // Of a disconnection, WIFI_REASON_* of the SDK ( 802.11 reason codes and 200+ )
+  uint8_t           _channel;         // Of a connection
+} WM_WiFiEvent;
+#endif
+
+// Lock-free queue between a single producer and a single consumer, as the WiFi task and process().
+// Each index is written by one side only, so loads and stores are enough.
+template<typename T, uint8_t SIZE>
+class WM_EventQueue
+{
+  static_assert( (SIZE & (SIZE - 1)) == 0, "WM_EventQueue size must be a power of 2");
+
+  public:
+
+    // Producer
+    bool push(const T& item)
+    {
+      uint8_t head = _head.load(std::memory_order_relaxed);
+      uint8_t next = (head + 1) & (SIZE - 1);
+
+      if (next == _tail.load(std::memory_order_acquire))
+      {
+        // Producer only, no read-modify-write needed
+        _dropped.store(_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+      }
+
+      _items[head] = item;
+      _head.store(next, std::memory_order_release);
+
+      return true;
+    }
+
+    // Consumer
+    bool pop(T& item)
+    {
+      uint8_t tail = _tail.load(std::memory_order_relaxed);
+
+      if (tail == _head.load(std::memory_order_acquire))
+        return false;
+
+      item = _items[tail];
+      _tail.store((tail + 1) & (SIZE - 1), std::memory_order_release);
+
+      return true;
+    }
+
+    // Items lost because the queue was full
+    uint32_t dropped() const
+    {
+      return _dropped.load(std::memory_order_relaxed);
+    }
+
+  private:
+
+    T                     _items[SIZE];
+    std::atomic<uint8_t>  _head     { 0 };
+    std::atomic<uint8_t>  _tail     { 0 };
+    std::atomic<uint32_t> _dropped  { 0 };
+};
+
+// Why a connection failed, see connectionFailure()
+typedef enum
+{
+  WM_FAIL_NONE,
+  WM_FAIL_AUTH,                       // Wrong password
+  WM_FAIL_NO_AP,                      // SSID not found
+  WM_FAIL_HANDSHAKE,                  // 4-way handshake timeout, often a wrong password too
+  WM_FAIL_ASSOC_REJECT,
+  WM_FAIL_DHCP_TIMEOUT,               // Associated, but no IP
+  WM_FAIL_TIMEOUT,                    // Nothing reported before the connect timeout
+  WM_FAIL_OTHER
+} WM_ConnectFailure;
+
+// Disconnect reasons of the WiFi drivers, with the same values for ESP8266 ( WIFI_DISCONNECT_REASON_xxx ) and
+// ESP32 ( WIFI_REASON_xxx )
+#define WM_REASON_ASSOC_LEAVE         8
+#define WM_REASON_4WAY_HANDSHAKE_TIMEOUT  15
+#define WM_REASON_ASSOC_TOOMANY       17
+#define WM_REASON_802_1X_AUTH_FAILED  23
+#define WM_REASON_NO_AP_FOUND         201
+#define WM_REASON_AUTH_FAIL           202
+#define WM_REASON_ASSOC_FAIL          203
+#define WM_REASON_HANDSHAKE_TIMEOUT   204
+
+typedef enum
+{
+  WM_CONNECT_IDLE,
+  WM_CONNECT_ASSOCIATING,             // WiFi.begin() done, looking for the AP
+  WM_CONNECT_DHCP,                    // Associated, waiting for the IP
+  WM_CONNECT_CONNECTED,
+  WM_CONNECT_FAILED                   // connectionResult() tells why
+} WM_ConnectState;
+
+typedef enum
+{
+  WM_PORTAL_IDLE,                     // Not started yet
+  WM_PORTAL_SERVING,                  // Waiting for the credentials
+  WM_PORTAL_CONNECTING,               // Trying the new credentials, still serving
+  WM_PORTAL_CLOSING,                  // Done, serving until the browser got the result
+  WM_PORTAL_CONNECTED,                // Closed, connected with the new credentials
+  WM_PORTAL_TIMEOUT,                  // Closed by the config portal timeout
+  WM_PORTAL_CLOSED                    // Closed by /close, closeConfigPortal(), or after a failed connection
+} WM_PortalState;
+
+// One network of the scan results, copied from the WiFi driver so that it survives the next scan, or a reboot
+typedef struct
+{
+  char      _ssid[33];
+  uint8_t   _bssid[6];
+  int8_t    _rssi;
+  uint8_t   _quality;
+  uint8_t   _channel;
+  uint8_t   _encryption;
+  uint8_t   _numBSSIDs;               // BSSIDs seen with this SSID, the strongest one above included
+} WM_ScanResult;
+
+// _auth values of WM_ScanFilter, besides an exact encryption type of the WiFi driver
+#define WM_AUTH_ANY                   -1
+#define WM_AUTH_SECURED               -2
+
+// Selection of scan results, as given by ?offset=&limit=&rssi=&prefix=&auth=&channel=&band= on /scan and /wifi
+typedef struct
+{
+  int           _offset;
+  int           _limit;               // 0 for no limit
+  int           _minRSSI;
+  const char   *_ssidPrefix;          // NULL for any
+  int           _auth;                // WM_AUTH_ANY, WM_AUTH_SECURED or encryption type
+  uint8_t       _channel;             // 0 for any
+  uint8_t       _band;                // 0 for any, 2 for 2.4GHz, 5 for 5GHz
+} WM_ScanFilter;
+
+#define WM_CONNECT_TIME_SAMPLES       6
+// Connection time assumed for a network which never connected yet
+#define WM_CONNECT_TIME_DEFAULT_MS    5000
+
+// What the connections to a known network have learned
+typedef struct
+{
+  uint32_t  _lastAttempt;             // Attempts are numbered across the table, so that the order survives reboots
+  uint32_t  _lastSuccess;             // Number of the last successful attempt, 0 if none
+  uint16_t  _successes;
+  uint16_t  _failures;
+  uint16_t  _connectTimes[WM_CONNECT_TIME_SAMPLES];   // ms of the last successes, 0 if unused
+  uint8_t   _nextTime;                // Next entry of _connectTimes to replace
+  uint8_t   _failStreak;              // Failures since the last success
+  int8_t    _lastRSSI;                // At the last success
+  uint8_t   _reserved;
+} WM_CredentialStats;
+
+// One known network of the credential table. Fixed size, so that a sketch can store the table as it is, the
+// statistics included.
+typedef struct
+{
+  char                _ssid[33];
+  char                _pass[65];
+  uint8_t             _priority;      // Higher first, see connectBest()
+  uint8_t             _reserved;
+  WM_CredentialStats  _stats;
+} WM_Credential;
+
+static_assert(WM_MAX_CREDENTIALS <= 255, "WM_MAX_CREDENTIALS must fit in uint8_t");
+
+#if USE_PORTAL_TASK
+// Change of the Config Portal run by the portal task, see getPortalEvent()
+typedef struct
+{
+  unsigned long   _time;              // millis() when the task saw it
+  WM_PortalState  _state;             // New state of the portal
+} WM_PortalEvent;
+
+// What the Config Portal has saved, copied at once while the portal task is between two requests, see
+// getConfigSnapshot()
+typedef struct
+{
+  WM_Credential     _credentials[WM_MAX_CREDENTIALS];
+  uint8_t           _numCredentials;
+  String            _ssid;            // Last saved by /wifisave
+  String            _pass;
+  WiFi_STA_IPConfig _staIPConfig;
+  String            _values[WIFI_MANAGER_MAX_PARAMS];   // Of the parameters, in the order of getParameters()
+  uint8_t           _numValues;
+} WM_ConfigSnapshot;
+#endif
+
+#if USE_RTC_SCAN_CACHE
+#define WM_RTC_SCAN_MAGIC             0x574D5332UL      // "WMS2"
+
+typedef struct
+{
+  uint32_t      _magic;
+  uint32_t      _count;
+  uint32_t      _checksum;
+  WM_ScanResult _results[WM_RTC_SCAN_RESULTS];
+} WM_RTCScanCache;
+
+#ifdef ESP8266
+static_assert(WM_RTC_SCAN_ADDRESS * 4 + sizeof(WM_RTCScanCache) <= 512, "WM_RTCScanCache does not fit in RTC user memory");
+#endif
+#endif
+
+#if USE_RTC_FAST_CONNECT
+#define WM_RTC_FAST_CONNECT_MAGIC     0x574D4643UL      // "WMFC"
+
+typedef struct
+{
+  uint32_t  _magic;
+  uint32_t  _checksum;                // Of everything below
+  uint32_t  _ssidHash;                // The hints are for this SSID only
+  uint8_t   _bssid[6];
+  uint8_t   _channel;                 // 0 when there is no hint
+  uint8_t   _hasIP;                   // The DHCP lease below is set
+  uint32_t  _ip;
+  uint32_t  _gateway;
+  uint32_t  _netmask;
+  uint32_t  _dns1;
+  uint32_t  _dns2;
+  uint16_t  _hits;                    // Counted since power on
+  uint16_t  _misses;
+} WM_RTCFastConnect;
+
+#ifdef ESP8266
+static_assert(WM_RTC_FAST_CONNECT_ADDRESS * 4 + sizeof(WM_RTCFastConnect) <= 512, "WM_RTCFastConnect does not fit in RTC user memory");
+
+#if USE_RTC_SCAN_CACHE
+static_assert( (WM_RTC_FAST_CONNECT_ADDRESS * 4 >= WM_RTC_SCAN_ADDRESS * 4 + sizeof(WM_RTCScanCache)) ||
+               (WM_RTC_FAST_CONNECT_ADDRESS * 4 + sizeof(WM_RTCFastConnect) <= WM_RTC_SCAN_ADDRESS * 4),
+               "WM_RTCFastConnect overlaps WM_RTCScanCache in RTC user memory");
+#endif
+#endif
+
+// Outcome of the fast connect, see getFastConnectStats()
+typedef struct
+{
+  bool          _tried;               // Hints were used by the last connectWifi()
+  bool          _hit;                 // and it connected with them
+  unsigned long _connectTime;         // ms spent by the last connectWifi()
+  uint16_t      _hits;                // Since power on
+  uint16_t      _misses;
+} WM_FastConnectStats;
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 // New in v1.4.0
 typedef struct
@@ -289,9 +914,70 @@ class ESP_WiFiManager
     bool          autoConnect(char const *apName, char const *apPassword = NULL);
     //////
 
+    // Non-blocking connection, for sketches which must keep running meanwhile. beginConnect() starts it, to the
+    // saved credentials if ssid is empty, then process() must be called from loop() until connectionState() is
+    // WM_CONNECT_CONNECTED or WM_CONNECT_FAILED. autoConnect() and startConfigPortal() use it.
+    // process() also runs the config portal started with nonBlocking, one DNS and one HTTP request per call at most.
+    bool          beginConnect(const String& ssid = "", const String& pass = "");
+    void          process();
+
+    WM_ConnectState connectionState()
+    {
+      return _connectState;
+    }
+
+    // WiFi status at the end of the connection : WL_CONNECTED, or the reason of the failure. getStatus() names it.
+    int           connectionResult()
+    {
+      return _connectResult;
+    }
+
+    // Why the last connection failed, from the disconnect reasons of the WiFi driver. getStatus() names it.
+    WM_ConnectFailure connectionFailure()
+    {
+      return _connectFailure;
+    }
+
     //if you want to start the config portal
     bool          startConfigPortal();
-    bool          startConfigPortal(char const *apName, char const *apPassword = NULL);
+    // With nonBlocking, returns once the portal serves. process() must then be called from loop() until
+    // configPortalActive() is false, portalState() tells how it ended.
+    bool          startConfigPortal(char const *apName, char const *apPassword = NULL, bool nonBlocking = false);
+
+    // Closes the config portal at the next process() call, or at once from the loop of the blocking one
+    void          closeConfigPortal()
+    {
+      stopConfigPortal = true;
+    }
+
+    WM_PortalState portalState()
+    {
+      return _portalState;
+    }
+
+    bool          configPortalActive()
+    {
+      return (_portalState == WM_PORTAL_SERVING) || (_portalState == WM_PORTAL_CONNECTING) ||
+             (_portalState == WM_PORTAL_CLOSING);
+    }
+
+#if USE_PORTAL_TASK
+    // Starts the non-blocking config portal and runs it in the portal task, see USE_PORTAL_TASK. While the task
+    // runs, process() leaves the portal and its connection to it, and the sketch uses getPortalEvent() and
+    // getConfigSnapshot() only, the other calls are not thread-safe.
+    bool          startConfigPortalTask(char const *apName, char const *apPassword = NULL);
+    // Closes the config portal and waits for the task to end, at most WM_PORTAL_TASK_STOP_TIMEOUT_MS on ESP32.
+    // False if it has not ended by then.
+    bool          stopConfigPortalTask();
+
+    bool          getPortalEvent(WM_PortalEvent& event);
+    void          getConfigSnapshot(WM_ConfigSnapshot& snapshot);
+
+    bool          portalTaskRunning()
+    {
+      return _portalTaskRunning.load();
+    }
+#endif
 
     // get the AP name of the config portal, so it can be used in the callback
     String        getConfigPortalSSID();
@@ -344,6 +1030,26 @@ class ESP_WiFiManager
     //called when settings have been changed and connection was successful
     void          setSaveConfigCallback(void(*func)());
 
+    //called when the config portal can serve its first request, with the ms since startConfigPortal()
+    void          setPortalReadyCallback(void(*func)(unsigned long bringUpTime));
+
+    // ms from startConfigPortal() until the config portal could serve, 0 if not started yet
+    unsigned long getPortalBringUpTime()
+    {
+      return _portalBringUpTime;
+    }
+
+#if USE_WIFI_EVENTS
+    //called from process() for each WiFi station event, in the order of the core
+    void          setWiFiEventCallback(void(*func)(const WM_WiFiEvent&));
+
+    // Events lost because process() was not called often enough
+    uint32_t      getWiFiEventsDropped()
+    {
+      return _wifiEvents.dropped();
+    }
+#endif
+
 #if USE_DYNAMIC_PARAMS
     //adds a custom parameter
     bool 				addParameter(ESP_WMParameter *p);
@@ -364,6 +1070,76 @@ class ESP_WiFiManager
     //space for indices array allocated on the heap and should be freed when no longer required
     int           scanWifiNetworks(int **indicesptr);
 
+    // Scan results shared with the Config Portal, strongest first without duplicates and low quality networks.
+    // Rescans ( blocking ) when they are older than the TTL or if refresh. Results belong to ESP_WiFiManager,
+    // and stay valid until the next scan.
+    int           getScanResults(const WM_ScanResult **results, bool refresh = false);
+
+    // Strongest BSSID of ssid in the scan results, with its channel and the number of BSSIDs. NULL if not seen.
+    const WM_ScanResult*  findScanResult(const char* ssid);
+
+    // Age in ms after which the scan results are renewed, default WM_SCAN_CACHE_TTL_MS
+    void          setScanCacheTTL(unsigned long ttl)
+    {
+      _scanCacheTTL = ttl;
+    }
+
+    // Keep only the K strongest networks of the next scans, 0 for all. Default WM_SCAN_TOP_K
+    void          setScanTopK(int topK)
+    {
+      _scanTopK = topK;
+    }
+
+#if USE_RTC_FAST_CONNECT
+    // Whether the last connection used the RTC hints and how long it took, with the hit / miss counts
+    const WM_FastConnectStats& getFastConnectStats()
+    {
+      return _fastConnectStats;
+    }
+#endif
+
+    // Filter with no condition, to be narrowed by the caller
+    static WM_ScanFilter  defaultScanFilter();
+    static bool           scanResultMatches(const WM_ScanResult& result, const WM_ScanFilter& filter);
+
+    // Known networks, kept in priority order then in order of addition. Entered in the Config Portal, or added by
+    // the sketch from its saved config. A known SSID gets the new password and priority. False if the table is full,
+    // or the SSID / password too long.
+    bool          addCredential(const char* ssid, const char* pass, uint8_t priority = 0);
+    // As stored by the sketch, statistics included
+    bool          addCredential(const WM_Credential& credential);
+    bool          removeCredential(const char* ssid);
+    bool          setCredentialPriority(const char* ssid, uint8_t priority);
+    void          clearCredentials();
+
+    uint8_t       getCredentialCount()
+    {
+      return _numCredentials;
+    }
+
+    // NULL past the end. Valid until the table is changed.
+    const WM_Credential*  getCredential(uint8_t index)
+    {
+      return (index < _numCredentials) ? &_credentials[index] : NULL;
+    }
+
+    // Connect to the known network with the highest priority seen by one scan, the strongest one among equal
+    // priorities. The scan results cache is used if fresh. beginConnectBest() is the non-blocking variant, followed
+    // by process(). Networks which keep failing come after the others. WL_NO_SSID_AVAIL if no known network is in range.
+    int           connectBest();
+    bool          beginConnectBest();
+
+    // Try the known networks one after the other, the most likely to connect quickly first, until one connects.
+    // Priority comes first, then the success rate and median connection time of the previous attempts. Networks
+    // which keep failing are tried last. No scan needed, hidden networks included.
+    int           connectKnown();
+
+    // Median ms of the last successful connections, 0 if none
+    static uint16_t       medianConnectTime(const WM_CredentialStats& stats);
+
+    //called when the credential table or its statistics change, after each connection, so the sketch can store it
+    void          setCredentialsCallback(void(*func)());
+
     // return SSID of router in STA mode got from config portal. NULL if no user's input //KH
     String				getSSID() 
     {
@@ -377,38 +1153,32 @@ class ESP_WiFiManager
     }
     
     // New from v1.1.0
-    // return SSID of router in STA mode got from config portal. NULL if no user's input //KH
+    // return the second known network, see getSSID(index)
     String				getSSID1() 
     {
-      return _ssid1;
+      return getSSID(1);
     }
 
-    // return password of router in STA mode got from config portal. NULL if no user's input //KH
     String				getPW1() 
     {
-      return _pass1;
+      return getPW(1);
     }
     
-    #define MAX_WIFI_CREDENTIALS        2
+    #define MAX_WIFI_CREDENTIALS        WM_MAX_CREDENTIALS
     
+    // SSID and password of the known network at index, in priority order. "" past the end.
     String				getSSID(uint8_t index) 
     {
-      if (index == 0)
-        return _ssid;
-      else if (index == 1)
-        return _ssid1;
-      else     
-        return String("");
+      const WM_Credential* credential = getCredential(index);
+
+      return credential ? String(credential->_ssid) : String("");
     }
     
     String				getPW(uint8_t index) 
     {
-      if (index == 0)
-        return _pass;
-      else if (index == 1)
-        return _pass1;
-      else     
-        return String("");
+      const WM_Credential* credential = getCredential(index);
+
+      return credential ? String(credential->_pass) : String("");
     }
     //////
     
@@ -433,6 +1203,7 @@ class ESP_WiFiManager
     int           getParametersCount();
 
     const char*   getStatus(int status);
+    const char*   getStatus(WM_ConnectFailure failure);
 
 #ifdef ESP32
     String getStoredWiFiSSID();
@@ -472,15 +1243,14 @@ class ESP_WiFiManager
     }
 
   private:
-    std::unique_ptr<DNSServer>        dnsServer;
-
-    //KH, for ESP32
-#ifdef ESP8266
-    std::unique_ptr<ESP8266WebServer> server;
-#else		//ESP32
-    std::unique_ptr<WebServer>        server;
+#ifdef WM_HOST_BUILD
+    // The host benchmarks of extras/linux time the page handlers and helpers below
+    friend class WM_HostBench;
 #endif
 
+    std::unique_ptr<WM_DNSServer>     dnsServer;
+    std::unique_ptr<WM_WebServer>     server;
+
 #define RFC952_HOSTNAME_MAXLEN      24
     char RFC952_hostname[RFC952_HOSTNAME_MAXLEN + 1];
 
@@ -496,10 +1266,17 @@ class ESP_WiFiManager
     String        _ssid   = "";
     String        _pass   = "";
     
-    // New from v1.1.0
-    String        _ssid1  = "";
-    String        _pass1  = "";
-    //////
+    // Known networks, in priority order
+    WM_Credential _credentials[WM_MAX_CREDENTIALS];
+    uint8_t       _numCredentials         = 0;
+
+    int           findCredential(const char* ssid);
+    bool          insertCredential(const WM_Credential& credential);
+    uint8_t       rankCredentials(uint8_t* order);
+    uint32_t      lastCredentialAttempt();
+    bool          credentialFailing(const WM_Credential& credential, uint32_t attempt);
+    uint32_t      credentialScore(const WM_Credential& credential);
+    void          updateCredentialStats(bool success);
     
     // From v1.0.6 with timezone info
     String        _timezoneName         = "";
@@ -508,9 +1285,73 @@ class ESP_WiFiManager
 
     unsigned long _connectTimeout       = 0;
     unsigned long _configPortalStart    = 0;
+    unsigned long _portalStartCall      = 0;
+    unsigned long _portalBringUpTime    = 0;
+
+    // Config portal, run by startConfigPortal() or by process()
+    WM_PortalState _portalState         = WM_PORTAL_IDLE;
+    bool          _portalNonBlocking    = false;
+    bool          _portalSaved          = false;
+    bool          _portalConnectPending = false;
+    unsigned long _portalConnectAt      = 0;
+    unsigned long _portalCloseAt        = 0;
+
+    bool          processConfigPortal();
+    void          endConfigPortal(WM_PortalState state);
+
+    // Bounded wait for the WiFi driver, instead of a fixed delay. False if not ready within timeout ms.
+    template<typename Ready>
+    bool          waitUntil(Ready ready, unsigned long timeout)
+    {
+      unsigned long start = millis();
+
+      while (!ready())
+      {
+        if (millis() - start >= timeout)
+          return false;
+
+        delay(1);
+      }
+
+      return true;
+    }
 
-    int           numberOfNetworks;
-    int           *networkIndices;
+    bool          softAPReady();
+
+    // Scan results cache
+    WM_ScanResult *_scanResults           = NULL;
+    int           _numScanResults         = 0;
+    unsigned long _scanCacheTTL           = WM_SCAN_CACHE_TTL_MS;
+    int           _scanTopK               = WM_SCAN_TOP_K;
+    WM_ScanState  _scanState              = WM_SCAN_IDLE;
+    unsigned long _scanStart              = 0;
+    unsigned long _scanDone               = 0;
+    // Set once the results of the last scan have been sent, a refresh then needs a new scan
+    bool          _scanServed             = false;
+    // Networks in range may be missing from the results : too weak, beyond the top K, or not kept in RTC memory
+    bool          _scanPartial            = false;
+
+    int           processScanResults(int n, int **indicesptr, uint8_t *numBSSIDs = NULL, int *numWeak = NULL);
+    const char*   scanSSID(int index, uint8_t& length);
+    void          storeScanResults(int n);
+    void          scanNow();
+    bool          scanResultsFresh();
+    bool          scanRefreshRequested();
+    void          parseScanFilter(WM_ScanFilter& filter, String& ssidPrefix, int defaultLimit);
+    void          appendFilterArgs(String& query);
+#if USE_PORTAL_ETAG
+    uint32_t      scanFilterTag(uint32_t tag, const WM_ScanFilter& filter);
+#endif
+
+#if USE_ASYNC_WIFI_SCAN
+    void          startScan();
+    void          processScan();
+#endif
+
+#if USE_RTC_SCAN_CACHE
+    void          saveScanResultsToRTC();
+    void          loadScanResultsFromRTC();
+#endif
     
     // KH, new from v1.0.10 to enable dynamic/random channel
     // default to channel 1
@@ -547,30 +1388,140 @@ class ESP_WiFiManager
     void          setWifiStaticIP();
     
     // New v1.1.0
-    int           reconnectWifi();
+    int           reconnectWifi()
+    {
+      return connectKnown();
+    }
     //////
     
     // New v1.0.11
     int           connectWifi(String ssid = "", String pass = "");
+    int           finishConnect();
+
+    WM_ConnectState _connectState         = WM_CONNECT_IDLE;
+    int           _connectResult          = WL_IDLE_STATUS;
+    unsigned long _connectBegin           = 0;
+    unsigned long _connectStart           = 0;    // Of the current attempt
+    unsigned long _connectEnd             = 0;
+    // When /connectstatus told the result of the connection, 0 if not yet
+    unsigned long _connectResultServed    = 0;
+    // Directed to a BSSID, retried once without if that fails
+    bool          _connectHinted          = false;
+    String        _connectSSID            = "";
+    String        _connectPass            = "";
+    WM_ConnectFailure _connectFailure     = WM_FAIL_NONE;
+    // A failure which retrying cannot fix was reported, process() ends the connection
+    bool          _connectAbort           = false;
+
+    static WM_ConnectFailure  failureOfReason(uint8_t reason);
+    static WM_ConnectFailure  failureOfStatus(int status);
+
+    void          processConnect();
+    void          endConnect(WM_ConnectState state, int result);
+    // To a BSSID and channel, not kept in the configuration saved by the WiFi driver
+    void          beginHinted(const String& ssid, const String& pass, int32_t channel, const uint8_t* bssid);
+    void          storeCredentials(const String& ssid, const String& pass);
     //////
     
     uint8_t       waitForConnectResult();
 
+#if USE_RTC_FAST_CONNECT
+    WM_FastConnectStats _fastConnectStats   = { false, false, 0, 0, 0 };
+
+    void          readFastConnect(WM_RTCFastConnect& cache);
+    void          writeFastConnect(WM_RTCFastConnect& cache);
+    bool          beginFastConnect(const String& ssid, const String& pass);
+    void          missFastConnect();
+    void          saveFastConnect(bool lease);
+
+#if USE_RTC_FAST_CONNECT_IP
+    // The DHCP lease of the fast connect hints is set as static IP
+    bool          _fastConnectIP            = false;
+
+    bool          fastConnectAP(const WM_RTCFastConnect& cache);
+    void          restoreDHCP();
+#endif
+#endif
+
     void          handleRoot();
     void          handleWifi();
     void          handleWifiSave();
+    const char*   checkCredentials(const String& ssid, const String& pass, bool& canForce);
+    void          sendSaveError(const char* error, bool canForce);
+    void          handleCredential();
     void          handleServerClose();
     void          handleInfo();
     void          handleState();
+    void          handleConnectStatus();
+    static const char*  connectStateName(WM_ConnectState state);
     void          handleScan();
     void          handleReset();
     void          handleNotFound();
+#if USE_PORTAL_ASSETS
+    void          handleAsset(const WM_PortalAsset* asset);
+#endif
     bool          captivePortal();
-    
-    void          reportStatus(String &page);
+
+    void          reportStatus();
+
+    // Page output. Streamed to the client in chunks, or collected and sent at once if !USE_CHUNKED_PORTAL_PAGES
+    void          beginPage(int code, const char* contentType);
+    void          pageHead(const char* title);
+    void          pageContent(const char* content, size_t len);
+    void          pageContent(const char* content);
+    void          pageContent(const String& content);
+    void          pageContent(const __FlashStringHelper* content);
+    void          pageContent_P(PGM_P content, size_t len);
+    void          pageContent_P(PGM_P content);
+    void          pageEscaped(const char* value, WM_Escape escape);
+    void          pageTemplate_P(PGM_P pageTemplate, const WM_TemplateSlot* slots, uint8_t numSlots);
+    void          pageStaticIPField(const char* id, const char* label, IPAddress ip);
+    void          endPage();
+
+    // JSON replies, written through the page output above. Keys are NULL for array elements.
+    void          jsonOpen(const char* key, char bracket);
+    void          jsonClose(char bracket);
+    void          jsonKey(const char* key);
+    void          jsonString(const char* key, const char* value);
+    void          jsonString(const char* key, const String& value);
+    void          jsonBool(const char* key, bool value);
+    void          jsonNumber(const char* key, long value);
+
+    // One bit per nesting level, set once the level has a member, to place the commas
+    uint32_t      _jsonHasMember          = 0;
+    uint8_t       _jsonDepth              = 0;
+
+    // FNV-1a, for page tags and SSID hashes of the scan snapshot
+    uint32_t      tagOf(uint32_t tag, const void* data, size_t len);
+    uint32_t      tagOf(uint32_t tag, const char* value);
+    uint32_t      tagOf(uint32_t tag, const String& value);
+    uint32_t      tagOf(uint32_t tag, IPAddress ip);
+
+#if USE_PORTAL_ETAG
+    // Page tags, over the inputs a page is rendered from
+    uint32_t      configTag();
+    uint32_t      connectionTag(uint32_t tag);
+    bool          notModified(uint32_t tag);
+
+    // Tag of the networks shown from the last scan
+    void          updateScanTag();
+
+    uint32_t      _scanTag                = WM_TAG_INIT;
+#endif
+
+#if USE_CHUNKED_PORTAL_PAGES
+    void          flushPageChunk();
+
+    char          _pageChunk[WM_PAGE_CHUNK_SIZE];
+    size_t        _pageChunkLen           = 0;
+#else
+    String        _page;
+    int           _pageCode               = 200;
+    const char*   _pageContentType        = "text/html";
+#endif
 
     // DNS server
-    const byte    DNS_PORT = 53;
+    const uint16_t DNS_PORT = WM_DNS_PORT;
 
     //helpers
     int           getRSSIasQuality(int RSSI);
@@ -584,6 +1535,47 @@ class ESP_WiFiManager
 
     void(*_apcallback)  (ESP_WiFiManager*)  = NULL;
     void(*_savecallback)()              = NULL;
+    void(*_portalreadycallback)(unsigned long)  = NULL;
+    void(*_credentialscallback)()       = NULL;
+
+#if USE_WIFI_EVENTS
+    void(*_wifiEventCallback)(const WM_WiFiEvent&)  = NULL;
+
+    WM_EventQueue<WM_WiFiEvent, WM_WIFI_EVENT_QUEUE_SIZE> _wifiEvents;
+    bool          _wifiEventsStarted      = false;
+
+#ifdef ESP8266
+    WiFiEventHandler  _staConnectedHandler;
+    WiFiEventHandler  _staGotIPHandler;
+    WiFiEventHandler  _staDisconnectedHandler;
+#else		//ESP32
+    wifi_event_id_t   _wifiEventId        = 0;
+    // Set by the AP start event, in the WiFi task
+    std::atomic<bool> _apStarted          { false };
+#endif
+
+    void          startWiFiEvents();
+    void          queueWiFiEvent(WM_WiFiEventType type, uint8_t reason, uint8_t channel);
+    void          processWiFiEvents();
+    void          handleWiFiEvent(const WM_WiFiEvent& event);
+#endif
+
+#if USE_PORTAL_TASK
+    // Held by the task for each slice of the portal, and by the calls of the sketch which read what it changes
+    std::mutex        _portalMutex;
+    std::atomic<bool> _portalTaskRunning  { false };
+
+    WM_EventQueue<WM_PortalEvent, WM_PORTAL_EVENT_QUEUE_SIZE> _portalEvents;
+
+#if WM_PORTAL_TASK_FREERTOS
+    TaskHandle_t      _portalTask         = NULL;
+#else
+    std::thread       _portalThread;
+#endif
+
+    static void   portalTaskEntry(void* manager);
+    void          runPortalTask();
+#endif
 
 #if USE_DYNAMIC_PARAMS
     int                    _max_params;
@@ -425,6 +425,18 @@ void ESP_WiFiManager::setupConfigPortal()
   server->on("/r", std::bind(&ESP_WiFiManager::handleReset, this));
   server->on("/state", std::bind(&ESP_WiFiManager::handleState, this));
   server->on("/scan", std::bind(&ESP_WiFiManager::handleScan, this));
+  
+#if USE_PORTAL_ASSETS
+  for (size_t i = 0; i < WM_NUM_PORTAL_ASSETS; i++)
+  {
+    server->on(WM_PORTAL_ASSETS[i]._uri, std::bind(&ESP_WiFiManager::handleAsset, this, &WM_PORTAL_ASSETS[i]));
+  }
+  
+  // If-None-Match is needed to answer revalidations with 304
+  static const char* headerKeys[] = { "If-None-Match" };
+  server->collectHeaders(headerKeys, 1);
+#endif
+  
   server->onNotFound(std::bind(&ESP_WiFiManager::handleNotFound, this));
   server->begin(); // Web server start
   
@@ -1837,6 +1849,34 @@ void ESP_WiFiManager::handleNotFound()
 
 //////////////////////////////////////////
 
+#if USE_PORTAL_ASSETS
+
+// Serve one pre-gzipped asset straight from flash
+void ESP_WiFiManager::handleAsset(const WM_PortalAsset* asset)
+{
+  LOGDEBUG1(F("Handle asset"), asset->_uri);
+  
+  server->sendHeader(FPSTR(WM_HTTP_ETAG), asset->_etag);
+  
+  if (server->header(FPSTR(WM_HTTP_IF_NONE_MATCH)).indexOf(asset->_etag) >= 0)
+  {
+    // Browser copy is still valid
+    server->send(304, FPSTR(WM_HTTP_HEAD_CT2), "");
+    return;
+  }
+  
+  server->sendHeader(FPSTR(WM_HTTP_CACHE_CONTROL), FPSTR(WM_HTTP_CACHE_FOREVER));
+  
+  if (asset->_gzipped)
+    server->sendHeader(FPSTR(WM_HTTP_CONTENT_ENCODING), FPSTR(WM_HTTP_GZIP));
+  
+  server->send_P(200, asset->_contentType, (PGM_P) asset->_data, asset->_length);
+}
+
+#endif
+
+//////////////////////////////////////////
+
 /**
    HTTPD redirector
    Redirect to captive portal if we got a request for another domain.
@@ -0,0 +1,1159 @@
+/****************************************************************************************************************************
+  ESP_WiFiManager_Assets.h
+  For ESP8266 / ESP32 boards
+
+  ESP_WiFiManager is a library for the ESP8266/Arduino platform
+  (https://github.com/esp8266/Arduino) to enable easy
+  configuration and reconfiguration of WiFi credentials using a Captive Portal
+  inspired by:
+  http://www.esp8266.com/viewtopic.php?f=29&t=2520
+  https://github.com/chriscook8/esp-arduino-apboot
+  https://github.com/esp8266/Arduino/blob/master/libraries/DNSServer/examples/CaptivePortalAdvanced/
+
+  Modified from Tzapu https://github.com/tzapu/WiFiManager
+  and from Ken Taylor https://github.com/kentaylor
+
+  Built by Khoi Hoang https://github.com/khoih-prog/ESP_WiFiManager
+  Licensed under MIT license
+  Version: 1.4.3
+
+  Version Modified By   Date      Comments
+  ------- -----------  ---------- -----------
+  1.0.0   K Hoang      07/10/2019 Initial coding
+  1.0.1   K Hoang      13/12/2019 Fix bug. Add features. Add support for ESP32
+  1.0.2   K Hoang      19/12/2019 Fix bug thatkeeps ConfigPortal in endless loop if Portal/Router SSID or Password is NULL.
+  1.0.3   K Hoang      05/01/2020 Option not displaying AvailablePages in Info page. Enhance README.md. Modify examples
+  1.0.4   K Hoang      07/01/2020 Add RFC952 setHostname feature.
+  1.0.5   K Hoang      15/01/2020 Add configurable DNS feature. Thanks to @Amorphous of https://community.blynk.cc
+  1.0.6   K Hoang      03/02/2020 Add support for ArduinoJson version 6.0.0+ ( tested with v6.14.1 )
+  1.0.7   K Hoang      13/04/2020 Reduce start time, fix SPIFFS bug in examples, update README.md
+  1.0.8   K Hoang      10/06/2020 Fix STAstaticIP issue. Restructure code. Add LittleFS support for ESP8266 core 2.7.1+
+  1.0.9   K Hoang      29/07/2020 Fix ESP32 STAstaticIP bug. Permit changing from DHCP <-> static IP using Config Portal.
+                                  Add, enhance examples (fix MDNS for ESP32)
+  1.0.10  K Hoang      08/08/2020 Add more features to Config Portal. Use random WiFi AP channel to avoid conflict.
+  1.0.11  K Hoang      17/08/2020 Add CORS feature. Fix bug in softAP, autoConnect, resetSettings.
+  1.1.0   K Hoang      28/08/2020 Add MultiWiFi feature to autoconnect to best WiFi at runtime
+  1.1.1   K Hoang      30/08/2020 Add setCORSHeader function to allow flexible CORS. Fix typo and minor improvement.
+  1.1.2   K Hoang      17/08/2020 Fix bug. Add example.
+  1.2.0   K Hoang      09/10/2020 Restore cpp code besides Impl.h code to use if linker error. Fix bug.
+  1.3.0   K Hoang      04/12/2020 Add LittleFS support to ESP32 using LITTLEFS Library
+  1.4.1   K Hoang      22/12/2020 Fix staticIP not saved. Add functions. Add complex examples. Sync with ESPAsync_WiFiManager
+  1.4.2   K Hoang      14/01/2021 Fix examples' bug not using saved WiFi Credentials after losing all WiFi connections.
+  1.4.3   K Hoang      23/01/2021 Fix examples' bug not saving Static IP in certain cases.
+ *****************************************************************************************************************************/
+
+#pragma once
+
+// Generated by extras/portal_assets.py from extras/portal, do not edit.
+// Static Config Portal assets, served by ESP_WiFiManager when USE_PORTAL_ASSETS is true.
+// Text assets are minified and stored gzipped. The version is the start of the SHA-256 of the served content and
+// is used both as strong ETag and as cache-busting query in the links of the portal pages.
+// Flash used by the assets : 12722 bytes ( 17092 bytes uncompressed )
+
+// /wm.css, 822 bytes gzipped from 1439
+#define WM_ASSET_WM_CSS_ENABLED      true
+#define WM_ASSET_WM_CSS_VERSION      "737be54839b489bd"
+#define WM_ASSET_WM_CSS_ETAG         "\"737be54839b489bd\""
+#define WM_ASSET_WM_CSS_LENGTH       822
+#define WM_ASSET_WM_CSS_GZIPPED      true
+
+// /wm.js, 113 bytes gzipped from 215
+#define WM_ASSET_WM_JS_ENABLED      true
+#define WM_ASSET_WM_JS_VERSION      "ed7566c8f6abe423"
+#define WM_ASSET_WM_JS_ETAG         "\"ed7566c8f6abe423\""
+#define WM_ASSET_WM_JS_LENGTH       113
+#define WM_ASSET_WM_JS_GZIPPED      true
+
+// /tz.js, 1893 bytes gzipped from 5544
+#define WM_ASSET_TZ_JS_ENABLED      ( USE_ESP_WIFIMANAGER_NTP && !USE_CLOUDFLARE_NTP )
+#define WM_ASSET_TZ_JS_VERSION      "a9312c6e31bcda79"
+#define WM_ASSET_TZ_JS_ETAG         "\"a9312c6e31bcda79\""
+#define WM_ASSET_TZ_JS_LENGTH       1893
+#define WM_ASSET_TZ_JS_GZIPPED      true
+
+// /logo.png, 9894 bytes
+#define WM_ASSET_LOGO_PNG_ENABLED      true
+#define WM_ASSET_LOGO_PNG_VERSION      "15d0cfab59945543"
+#define WM_ASSET_LOGO_PNG_ETAG         "\"15d0cfab59945543\""
+#define WM_ASSET_LOGO_PNG_LENGTH       9894
+#define WM_ASSET_LOGO_PNG_GZIPPED      false
+
+// The same content, uncompressed, for the inline WM_HTTP_STYLE / WM_HTTP_SCRIPT* / WM_HTTP_HEAD_END
+// of ESP_WiFiManager.h when USE_PORTAL_ASSETS is false
+
+#define WM_ASSET_WM_CSS_INLINE \
+  "div{padding:2px;font-size:1em}body,textarea,input,select{background:0;border-radius:0;font:14px sans" \
+  "-serif;margin:0}textarea,input,select{outline:0;font-size:12px;padding:8px;width:90%}input{border-ra" \
+  "dius:0.5em}.btn a{text-decoration:none}.container{margin:auto;width:100%}@media (min-width:1200px){." \
+  "container{margin:auto;width:30%}}@media (min-width:768px) and (max-width:1200px){.container{margin:a" \
+  "uto;width:50%;padding:20px}}.btn{font-size:1em}h1{font-size:2em}.btn{background:#6A9C31;border-radiu" \
+  "s:4px;border:0;color:#fff;cursor:pointer;display:inline-block;margin:2px 0;padding:10px 14px 11px;wi" \
+  "dth:100%}.btn:hover{background:#810D70}.btn:active,.btn:focus{background:#08b}label>*{display:inline" \
+  "}form>*{display:block;margin-bottom:10px}textarea:focus,input:focus,select:focus{border-color:#5ab}." \
+  "msg{background:#def;border-left:5px solid #59d;padding:1.5em}.q{float:right;width:64px;text-align:ri" \
+  "ght}.l{background:url('data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAACAAAAAgCAMAAABEpIrGAAAALVBMVEX" \
+  "///8EBwfBwsLw8PAzNjaCg4NTVVUjJiZDRUUUFxdiZGSho6OSk5Pg4eFydHTCjaf3AAAAZElEQVQ4je2NSw7AIAhEBamKn97/uMX" \
+  "EGBvozkWb9C2Zx4xzWykBhFAeYp9gkLyZE0zIMno9n4g19hmdY39scwqVkOXaxph0ZCXQcqxSpgQpONa59wkRDOL93eAXvimwlbP" \
+  "bwwVAegLS1HGfZAAAAABJRU5ErkJggg==') no-repeat left center;background-size:1em}input[type='checkbox']" \
+  "{float:left;width:20px}.table td{padding:.5em;text-align:left}.table tbody>:nth-child(2n-1){backgrou" \
+  "nd:#ddd}fieldset{border:0px;margin:0px}"
+
+#define WM_ASSET_WM_JS_INLINE \
+  "function c(l){document.getElementById('s').value=l.innerText||l.textContent;document.getElementById(" \
+  "'p').focus();document.getElementById('s1').value=l.innerText||l.textContent;document.getElementById(" \
+  "'p1').focus();}"
+
+#define WM_ASSET_TZ_JS_INLINE \
+  "/* jsTimezoneDetect 1.0.4, MIT license, https://bitbucket.org/pellepim/jstimezonedetect */\n(function" \
+  "(e){var t=function(){\"use strict\";var e=\"s\",n=function(e){var t=-e.getTimezoneOffset();return t!==nu" \
+  "ll?t:0},r=function(e,t,n){var r=new Date;return e!==undefined&&r.setFullYear(e),r.setDate(n),r.setMo" \
+  "nth(t),r},i=function(e){return n(r(e,0,2))},s=function(e){return n(r(e,5,2))},o=function(e){var t=e." \
+  "getMonth()>7?s(e.getFullYear()):i(e.getFullYear()),r=n(e);return t-r!==0},u=function(){var t=i(),n=s" \
+  "(),r=i()-s();return r<0?t+\",1\":r>0?n+\",1,\"+e:t+\",0\"},a=function(){var e=u();return new t.TimeZone(t." \
+  "olson.timezones[e])},f=function(e){var t=new Date(2010,6,15,1,0,0,0),n={\"America/Denver\":new Date(20" \
+  "11,2,13,3,0,0,0),\"America/Mazatlan\":new Date(2011,3,3,3,0,0,0),\"America/Chicago\":new Date(2011,2,13," \
+  "3,0,0,0),\"America/Mexico_City\":new Date(2011,3,3,3,0,0,0),\"America/Asuncion\":new Date(2012,9,7,3,0,0" \
+  ",0),\"America/Santiago\":new Date(2012,9,3,3,0,0,0),\"America/Campo_Grande\":new Date(2012,9,21,5,0,0,0)" \
+  ",\"America/Montevideo\":new Date(2011,9,2,3,0,0,0),\"America/Sao_Paulo\":new Date(2011,9,16,5,0,0,0),\"Am" \
+  "erica/Los_Angeles\":new Date(2011,2,13,8,0,0,0),\"America/Santa_Isabel\":new Date(2011,3,5,8,0,0,0),\"Am" \
+  "erica/Havana\":new Date(2012,2,10,2,0,0,0),\"America/New_York\":new Date(2012,2,10,7,0,0,0),\"Asia/Beiru" \
+  "t\":new Date(2011,2,27,1,0,0,0),\"Europe/Helsinki\":new Date(2011,2,27,4,0,0,0),\"Europe/Istanbul\":new D" \
+  "ate(2011,2,28,5,0,0,0),\"Asia/Damascus\":new Date(2011,3,1,2,0,0,0),\"Asia/Jerusalem\":new Date(2011,3,1" \
+  ",6,0,0,0),\"Asia/Gaza\":new Date(2009,2,28,0,30,0,0),\"Africa/Cairo\":new Date(2009,3,25,0,30,0,0),\"Paci" \
+  "fic/Auckland\":new Date(2011,8,26,7,0,0,0),\"Pacific/Fiji\":new Date(2010,11,29,23,0,0,0),\"America/Hali" \
+  "fax\":new Date(2011,2,13,6,0,0,0),\"America/Goose_Bay\":new Date(2011,2,13,2,1,0,0),\"America/Miquelon\":" \
+  "new Date(2011,2,13,5,0,0,0),\"America/Godthab\":new Date(2011,2,27,1,0,0,0),\"Europe/Moscow\":t,\"Asia/Ye" \
+  "katerinburg\":t,\"Asia/Omsk\":t,\"Asia/Krasnoyarsk\":t,\"Asia/Irkutsk\":t,\"Asia/Yakutsk\":t,\"Asia/Vladivosto" \
+  "k\":t,\"Asia/Kamchatka\":t,\"Avrupa/Türkiye\":t,\"Australia/Perth\":new Date(2008,10,1,1,0,0,0)};return n[e" \
+  "]};return{determine:a,date_is_dst:o,dst_start_for:f}}();t.TimeZone=function(e){\"use strict\";var n={\"" \
+  "America/Denver\":[\"America/Denver\",\"America/Mazatlan\"],\"America/Chicago\":[\"America/Chicago\",\"America/" \
+  "Mexico_City\"],\"America/Santiago\":[\"America/Santiago\",\"America/Asuncion\",\"America/Campo_Grande\"],\"Ame" \
+  "rica/Montevideo\":[\"America/Montevideo\",\"America/Sao_Paulo\"],\"Asia/Beirut\":[\"Asia/Beirut\",\"Europe/Hel" \
+  "sinki\",\"Europe/Istanbul\",\"Asia/Damascus\",\"Asia/Jerusalem\",\"Asia/Gaza\"],\"Pacific/Auckland\":[\"Pacific/" \
+  "Auckland\",\"Pacific/Fiji\"],\"America/Los_Angeles\":[\"America/Los_Angeles\",\"America/Santa_Isabel\"],\"Amer" \
+  "ica/New_York\":[\"America/Havana\",\"America/New_York\"],\"America/Halifax\":[\"America/Goose_Bay\",\"America/" \
+  "Halifax\"],\"America/Godthab\":[\"America/Miquelon\",\"America/Godthab\"],\"Asia/Dubai\":[\"Europe/Moscow\"],\"A" \
+  "sia/Dhaka\":[\"Asia/Yekaterinburg\"],\"Asia/Jakarta\":[\"Asia/Omsk\"],\"Asia/Shanghai\":[\"Asia/Krasnoyarsk\",\"" \
+  "Australia/Perth\"],\"Asia/Tokyo\":[\"Asia/Irkutsk\"],\"Australia/Brisbane\":[\"Asia/Yakutsk\"],\"Pacific/Noume" \
+  "a\":[\"Asia/Vladivostok\"],\"Pacific/Tarawa\":[\"Asia/Kamchatka\"],\"Africa/Johannesburg\":[\"Asia/Gaza\",\"Afri" \
+  "ca/Cairo\"],\"Asia/Baghdad\":[\"Europe/Minsk\"]},r=e,i=function(){var e=n[r],i=e.length,s=0,o=e[0];for(;s" \
+  "<i;s+=1){o=e[s];if(t.date_is_dst(t.dst_start_for(o))){r=o;return}}},s=function(){return typeof n[r]!" \
+  "=\"undefined\"};return s()&&i(),{name:function(){return r}}},t.olson={},t.olson.timezones={\"-720,0\":\"E" \
+  "tc/GMT+12\",\"-660,0\":\"Pacific/Pago_Pago\",\"-600,1\":\"America/Adak\",\"-600,0\":\"Pacific/Honolulu\",\"-570,0\"" \
+  ":\"Pacific/Marquesas\",\"-540,0\":\"Pacific/Gambier\",\"-540,1\":\"America/Anchorage\",\"-480,1\":\"America/Los_A" \
+  "ngeles\",\"-480,0\":\"Pacific/Pitcairn\",\"-420,0\":\"America/Phoenix\",\"-420,1\":\"America/Denver\",\"-360,0\":\"A" \
+  "merica/Guatemala\",\"-360,1\":\"America/Chicago\",\"-360,1,s\":\"Pacific/Easter\",\"-300,0\":\"America/Bogota\",\"" \
+  "-300,1\":\"America/New_York\",\"-270,0\":\"America/Caracas\",\"-240,1\":\"America/Halifax\",\"-240,0\":\"America/S" \
+  "anto_Domingo\",\"-240,1,s\":\"America/Santiago\",\"-210,1\":\"America/St_Johns\",\"-180,1\":\"America/Godthab\",\"" \
+  "-180,0\":\"America/Argentina/Buenos_Aires\",\"-180,1,s\":\"America/Montevideo\",\"-120,0\":\"Etc/GMT+2\",\"-120," \
+  "1\":\"Etc/GMT+2\",\"-60,1\":\"Atlantic/Azores\",\"-60,0\":\"Atlantic/Cape_Verde\",\"0,0\":\"Etc/UTC\",\"0,1\":\"Europe" \
+  "/London\",\"60,1\":\"Europe/Berlin\",\"60,0\":\"Africa/Lagos\",\"60,1,s\":\"Africa/Windhoek\",\"120,1\":\"Asia/Beiru" \
+  "t\",\"120,0\":\"Africa/Johannesburg\",\"180,0\":\"Asia/Baghdad\",\"180,1\":\"Europe/Moscow\",\"210,1\":\"Asia/Tehran" \
+  "\",\"240,0\":\"Asia/Dubai\",\"240,1\":\"Asia/Baku\",\"270,0\":\"Asia/Kabul\",\"300,1\":\"Asia/Yekaterinburg\",\"300,0\"" \
+  ":\"Asia/Karachi\",\"330,0\":\"Asia/Kolkata\",\"345,0\":\"Asia/Kathmandu\",\"360,0\":\"Asia/Dhaka\",\"360,1\":\"Asia/O" \
+  "msk\",\"390,0\":\"Asia/Rangoon\",\"420,1\":\"Asia/Krasnoyarsk\",\"420,0\":\"Asia/Jakarta\",\"480,0\":\"Asia/Shanghai" \
+  "\",\"480,1\":\"Asia/Irkutsk\",\"525,0\":\"Australia/Eucla\",\"525,1,s\":\"Australia/Eucla\",\"540,1\":\"Asia/Yakutsk" \
+  "\",\"540,0\":\"Asia/Tokyo\",\"570,0\":\"Australia/Darwin\",\"570,1,s\":\"Australia/Adelaide\",\"600,0\":\"Australia/" \
+  "Brisbane\",\"600,1\":\"Asia/Vladivostok\",\"600,1,s\":\"Australia/Sydney\",\"630,1,s\":\"Australia/Lord_Howe\",\"6" \
+  "60,1\":\"Asia/Kamchatka\",\"660,0\":\"Pacific/Noumea\",\"690,0\":\"Pacific/Norfolk\",\"720,1,s\":\"Pacific/Aucklan" \
+  "d\",\"720,0\":\"Pacific/Tarawa\",\"765,1,s\":\"Pacific/Chatham\",\"780,0\":\"Pacific/Tongatapu\",\"780,1,s\":\"Pacif" \
+  "ic/Apia\",\"840,0\":\"Pacific/Kiritimati\"},typeof exports!=\"undefined\"?exports.jstz=t:e.jstz=t})(this);\n" \
+  "var timezone=jstz.determine();console.log('Your timezone is:' + timezone.name());document.getElement" \
+  "ById('timezone').innerHTML=timezone.name();"
+
+#define WM_ASSET_LOGO_PNG_DATA_URI \
+  "data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAQoAAABcCAIAAAAZCWzAAAAACXBIWXMAAAsTAAALEwEAmpwYAAAKT2" \
+  "lDQ1BQaG90b3Nob3AgSUNDIHByb2ZpbGUAAHjanVNnVFPpFj333vRCS4iAlEtvUhUIIFJCi4AUkSYqIQkQSoghodkVUcERRUUEG8" \
+  "igiAOOjoCMFVEsDIoK2AfkIaKOg6OIisr74Xuja9a89+bN/rXXPues852zzwfACAyWSDNRNYAMqUIeEeCDx8TG4eQuQIEKJHAAEA" \
+  "izZCFz/SMBAPh+PDwrIsAHvgABeNMLCADATZvAMByH/w/qQplcAYCEAcB0kThLCIAUAEB6jkKmAEBGAYCdmCZTAKAEAGDLY2LjAF" \
+  "AtAGAnf+bTAICd+Jl7AQBblCEVAaCRACATZYhEAGg7AKzPVopFAFgwABRmS8Q5ANgtADBJV2ZIALC3AMDOEAuyAAgMADBRiIUpAA" \
+  "R7AGDIIyN4AISZABRG8lc88SuuEOcqAAB4mbI8uSQ5RYFbCC1xB1dXLh4ozkkXKxQ2YQJhmkAuwnmZGTKBNA/g88wAAKCRFRHgg/" \
+  "P9eM4Ors7ONo62Dl8t6r8G/yJiYuP+5c+rcEAAAOF0ftH+LC+zGoA7BoBt/qIl7gRoXgugdfeLZrIPQLUAoOnaV/Nw+H48PEWhkL" \
+  "nZ2eXk5NhKxEJbYcpXff5nwl/AV/1s+X48/Pf14L7iJIEyXYFHBPjgwsz0TKUcz5IJhGLc5o9H/LcL//wd0yLESWK5WCoU41EScY" \
+  "5EmozzMqUiiUKSKcUl0v9k4t8s+wM+3zUAsGo+AXuRLahdYwP2SycQWHTA4vcAAPK7b8HUKAgDgGiD4c93/+8//UegJQCAZkmScQ" \
+  "AAXkQkLlTKsz/HCAAARKCBKrBBG/TBGCzABhzBBdzBC/xgNoRCJMTCQhBCCmSAHHJgKayCQiiGzbAdKmAv1EAdNMBRaIaTcA4uwl" \
+  "W4Dj1wD/phCJ7BKLyBCQRByAgTYSHaiAFiilgjjggXmYX4IcFIBBKLJCDJiBRRIkuRNUgxUopUIFVIHfI9cgI5h1xGupE7yAAygv" \
+  "yGvEcxlIGyUT3UDLVDuag3GoRGogvQZHQxmo8WoJvQcrQaPYw2oefQq2gP2o8+Q8cwwOgYBzPEbDAuxsNCsTgsCZNjy7EirAyrxh" \
+  "qwVqwDu4n1Y8+xdwQSgUXACTYEd0IgYR5BSFhMWE7YSKggHCQ0EdoJNwkDhFHCJyKTqEu0JroR+cQYYjIxh1hILCPWEo8TLxB7iE" \
+  "PENyQSiUMyJ7mQAkmxpFTSEtJG0m5SI+ksqZs0SBojk8naZGuyBzmULCAryIXkneTD5DPkG+Qh8lsKnWJAcaT4U+IoUspqShnlEO" \
+  "U05QZlmDJBVaOaUt2ooVQRNY9aQq2htlKvUYeoEzR1mjnNgxZJS6WtopXTGmgXaPdpr+h0uhHdlR5Ol9BX0svpR+iX6AP0dwwNhh" \
+  "WDx4hnKBmbGAcYZxl3GK+YTKYZ04sZx1QwNzHrmOeZD5lvVVgqtip8FZHKCpVKlSaVGyovVKmqpqreqgtV81XLVI+pXlN9rkZVM1" \
+  "PjqQnUlqtVqp1Q61MbU2epO6iHqmeob1Q/pH5Z/YkGWcNMw09DpFGgsV/jvMYgC2MZs3gsIWsNq4Z1gTXEJrHN2Xx2KruY/R27iz" \
+  "2qqaE5QzNKM1ezUvOUZj8H45hx+Jx0TgnnKKeX836K3hTvKeIpG6Y0TLkxZVxrqpaXllirSKtRq0frvTau7aedpr1Fu1n7gQ5Bx0" \
+  "onXCdHZ4/OBZ3nU9lT3acKpxZNPTr1ri6qa6UbobtEd79up+6Ynr5egJ5Mb6feeb3n+hx9L/1U/W36p/VHDFgGswwkBtsMzhg8xT" \
+  "VxbzwdL8fb8VFDXcNAQ6VhlWGX4YSRudE8o9VGjUYPjGnGXOMk423GbcajJgYmISZLTepN7ppSTbmmKaY7TDtMx83MzaLN1pk1mz" \
+  "0x1zLnm+eb15vft2BaeFostqi2uGVJsuRaplnutrxuhVo5WaVYVVpds0atna0l1rutu6cRp7lOk06rntZnw7Dxtsm2qbcZsOXYBt" \
+  "uutm22fWFnYhdnt8Wuw+6TvZN9un2N/T0HDYfZDqsdWh1+c7RyFDpWOt6azpzuP33F9JbpL2dYzxDP2DPjthPLKcRpnVOb00dnF2" \
+  "e5c4PziIuJS4LLLpc+Lpsbxt3IveRKdPVxXeF60vWdm7Obwu2o26/uNu5p7ofcn8w0nymeWTNz0MPIQ+BR5dE/C5+VMGvfrH5PQ0" \
+  "+BZ7XnIy9jL5FXrdewt6V3qvdh7xc+9j5yn+M+4zw33jLeWV/MN8C3yLfLT8Nvnl+F30N/I/9k/3r/0QCngCUBZwOJgUGBWwL7+H" \
+  "p8Ib+OPzrbZfay2e1BjKC5QRVBj4KtguXBrSFoyOyQrSH355jOkc5pDoVQfujW0Adh5mGLw34MJ4WHhVeGP45wiFga0TGXNXfR3E" \
+  "Nz30T6RJZE3ptnMU85ry1KNSo+qi5qPNo3ujS6P8YuZlnM1VidWElsSxw5LiquNm5svt/87fOH4p3iC+N7F5gvyF1weaHOwvSFpx" \
+  "apLhIsOpZATIhOOJTwQRAqqBaMJfITdyWOCnnCHcJnIi/RNtGI2ENcKh5O8kgqTXqS7JG8NXkkxTOlLOW5hCepkLxMDUzdmzqeFp" \
+  "p2IG0yPTq9MYOSkZBxQqohTZO2Z+pn5mZ2y6xlhbL+xW6Lty8elQfJa7OQrAVZLQq2QqboVFoo1yoHsmdlV2a/zYnKOZarnivN7c" \
+  "yzytuQN5zvn//tEsIS4ZK2pYZLVy0dWOa9rGo5sjxxedsK4xUFK4ZWBqw8uIq2Km3VT6vtV5eufr0mek1rgV7ByoLBtQFr6wtVCu" \
+  "WFfevc1+1dT1gvWd+1YfqGnRs+FYmKrhTbF5cVf9go3HjlG4dvyr+Z3JS0qavEuWTPZtJm6ebeLZ5bDpaql+aXDm4N2dq0Dd9WtO" \
+  "319kXbL5fNKNu7g7ZDuaO/PLi8ZafJzs07P1SkVPRU+lQ27tLdtWHX+G7R7ht7vPY07NXbW7z3/T7JvttVAVVN1WbVZftJ+7P3P6" \
+  "6Jqun4lvttXa1ObXHtxwPSA/0HIw6217nU1R3SPVRSj9Yr60cOxx++/p3vdy0NNg1VjZzG4iNwRHnk6fcJ3/ceDTradox7rOEH0x" \
+  "92HWcdL2pCmvKaRptTmvtbYlu6T8w+0dbq3nr8R9sfD5w0PFl5SvNUyWna6YLTk2fyz4ydlZ19fi753GDborZ752PO32oPb++6EH" \
+  "Th0kX/i+c7vDvOXPK4dPKy2+UTV7hXmq86X23qdOo8/pPTT8e7nLuarrlca7nuer21e2b36RueN87d9L158Rb/1tWeOT3dvfN6b/" \
+  "fF9/XfFt1+cif9zsu72Xcn7q28T7xf9EDtQdlD3YfVP1v+3Njv3H9qwHeg89HcR/cGhYPP/pH1jw9DBY+Zj8uGDYbrnjg+OTniP3" \
+  "L96fynQ89kzyaeF/6i/suuFxYvfvjV69fO0ZjRoZfyl5O/bXyl/erA6xmv28bCxh6+yXgzMV70VvvtwXfcdx3vo98PT+R8IH8o/2" \
+  "j5sfVT0Kf7kxmTk/8EA5jz/GMzLdsAAAAgY0hSTQAAeiUAAICDAAD5/wAAgOkAAHUwAADqYAAAOpgAABdvkl/FRgAAG9FJREFUeN" \
+  "rsXXtYU1e23wkhCXlAgPCQh0EeAiIIgkTwAW0RFLW1to6OtdZb63RG207v1Lb66VhF+9D5vDptraPt197WdvRqpdo6pb4qVlEe4S" \
+  "EIKBgQDJAHkBBCSEhI7h9nmjKQs3NyHort+f2hJHuffXbO2b+911p7rbUZdrsd/DZgthp6jW1tuspuQ6verDYO6UxWg9k6aP/3I2" \
+  "CyPXgcloDHFnlzggIFkRLf5ADBJLaHF6DxWwXjV08Pha6qva9KoatRGZpMFgMAwG4H9l/+ZQAw8iMYWYHr6R0sjJkoSpzkNz3SP5" \
+  "UeLjQ9fiXoNytvay7cUp3VDMjRRr9LetgBsAMA7MAOQAA/Ijl0/pSgrAD+RHrc0PR4WNFrbK3uOFav/JcN2MDPQ5w4PRxfTg1+ZG" \
+  "7kynDRFHr00PR4yFaMa3c/atJccIxmKuiBfBMTkJ47eR1NEpoeDwXs19sO1nQcHbYPjxrHFNEDKUoJyV2c8GcBW0SPJJoe4xTt2u" \
+  "sldz/oHbwLGccU0cNuB16e3vPjXsyULKEHE02PcYfy9kOVis9djmNPJk/kFS7kBAs5ATy2H8/Tj+vpzfbgeTDZwG63A/ugRW+09O" \
+  "lNmj6TUjeo7BlQ9Jk0WOjxs0KS9XTSRiHHjx5SND3GBQaGNOeatqj6b6JN8wwGa4IwIcQnOdJvlj8/ku3Bc9qOzW41WQdsdqt1eM" \
+  "hiM5uthkFLv96kURtauvrvdA/cGzD3DtttcHrYAfBiCZ9PfzfKP4UeVTQ9HjDu6a5fbH7LZB2xjzGCHhF+s6L8syW+Uj5bPPIqVf" \
+  "+tDn1dz0Bbr/Fen0llGOoxWYxOhSsWkyPgiJkMT6NFbxzqc6nSOL58IuHl7KgV9MCi6fHA0KT512X523YAbCNVBQA8mV7xQY/HBu" \
+  "QFCuIclbWD7QpdzT1ddWd/vdaoIF33GP2lHWRFLX9y6iv02KLp8QBQrzxxrW0fMhYd9GAwPBOCl6SGruax/ZFqZquhpfdKs6ZY3n" \
+  "OFUtV8LD3sAKSG5a5OfYseXg87WA9Xd290HaloPzjqS4lv5pzI14ScCcjHPlPHTeXpuq5TJqsBPCDuyxTnLMNDa9PfpkcYvXrcJ9" \
+  "xUHi1r/2DkVO3B5D0StTXSPxupoDd1lrYfvq0+dz8Nu05XD+Tj9LCcNWk76EFGrx6UQ95ztrz9g5HfTBRlzonchCjfZqu+tP1wfd" \
+  "cpG7CNnz5XKi6IuEFLpq6nxxlNDwrRPXDrJ/l/TMMpoWvSwv+A/N2o+ras/fCApXcc9vxC81diQejsiCfooUbTgxJYhgeKbm0Y+c" \
+  "2siI1TgpYCAAaG1Fdb/6el56fxLCAerd4zURQ3URRLjzZa9yAf527/uUNf4RD3cyfvDRdlAADudJ8rlr9rtZndUhLup+7h+Mhisv" \
+  "c9foHJ8KAH3MMF5jjvX6PqeKe+wvFxfux+hBs1nUd+vLPdajM/FE/ZMjz0Yclr9GijhSsyYbL0lt/bj/xtB+CxmPdCfdKRjw4z7g" \
+  "MEh8UL5Ef48cOEbD8Oi4fQQG/q6TZ2qQzt/ab/0IUa1RXl7WfTJ+bRY46mBzkolm9x/J0heU3iO9fxMco/56byRJe+7v73SswPj/" \
+  "ZPm+SXHBOQzvP0dlrHarM0qstua2Q3u65pBjqQL/9X9nZ8kFTIEdHDjtY9iEJlqDl7az0ivscEPD4rYtOoCmpD/Td169xVEnDrHk" \
+  "zAig+amz5xSZSbQec1ncUXmo/Je+qAHaSEPvKHmbvoYUfTgygK65YazEo7ACJu5BNTv3Rap+TuvrquE1TTg8fymR35zLSQPG+OGP" \
+  "fPaVCVfV37Qae+9U+Zu6dNmE2PPJoe+NGuu3xZvtluB3bAWJp4QsgJQWfRC6r+Boro4eXpMzty1YywJzgsPim/60Tt+1UdxW9mHx" \
+  "J5BdCDj6YHTpy+uVxvvme3g8yILdHihZCaNrvl/2qe1Q62k06PhKBHF8Zv5LF9yP1pzd01XBY/XBRDDz6aHnjQ0Vdy6c7rdgD8eQ" \
+  "n58R+7rD9ss3xz808qQwNZ9PDnReRM/lNsAC0C0fQYf/S4JN/YobtmB+DppO+8PP0xXnW1df+NzuME6eHrFZ4V+V+JE2jzKw0Axq" \
+  "Fh12ozdfaVAgBiA57Czg0AwOxJr0b6ZZUrPrunleG4b5S/dFrIoilBj7p1lU6nUyqVTovEYrFYLKZHGE0PMnGn+1s7sDGZnBkT/9" \
+  "vda0N8Upb4pNzVXm/WXLyrLRsY6nF5SaAgKtJfOjlgbphPIo7eVldXHzt2zGlRTk7OsmXL6BFG04NMyHu+BQAkBK1i4HV4ifDNiP" \
+  "DNGLYNyXt+Uhuaeo3t/UPqwSG9xWYGgOHJ9OJ6+vhwJwTwo8NE08J8koj01tPTE62Iw+HQw4umB5kwW/t0gy1MBitpwhqCTXkw2Z" \
+  "MDciYH5Di+sdmtADDI9QtkMBg4imjQ9MADzUAtACA+cAWDAudWJoNFv28a7o2ZcdWb1p7vAQBxgcvpF0ODpsdo3NNd9uFGuGWwok" \
+  "HjN0GPgSEVACAldAP9VmjQ9BgNtaEKABDqM4t+KzRoeozRyw01frw4+pXQoOnhBMO2oUj/fPqV0KDp4QR8dvAEbyn9SmjQ9BgNq2" \
+  "1QyJ0o4ITSr4QGTY/RGLL289nBjHGfOYXGbwrjZSOZxeJ6MyT0+6BB08MJ2ExvHCvH4OCgUqlUq9W9vb0Gg8FoNP5MNpZAIPDz8w" \
+  "sMDAwJCREKhePniQ8ODioUiq6uLq1WazAYrFYrAIDBYAgEAqFQKBaLg4ODJ0x4MGmKtFqtUqnUaDR9fX0Gg2FoaAj53svLC+kb8j" \
+  "whjpj3Gd3d3Uqlsru7G+kw8jABADwez9vbWywWBwUFhYSEMJk4pRJWaWnp8PCw0zJ/f/+4OHIsrVVVVYODg06LvHhe01Omu9WaXq" \
+  "+vq6urrKyUy+Umkwle2dPTMyIiQiqVJiYmikQip3UqKyudtpOQkIB2CQ40NjZevXq1vr4e7VE4EBAQkJqampaWFh4efh8GmUKhqK" \
+  "2trays7OjocBkeJxQK4+Li0tPTExISPDw8nHKsoaHBmYDASktLc3qJu2htba2urr5x4wZasM1IiESihISEGTNmxMfHO62gVCrlcv" \
+  "nY3kqlUlZ1dXVNTQ1a0wcPHsTNPAd6enoOHTqEVpqbm4udHgqFoqio6MaNGxaLBeMlFoulubm5ubmZxWIlJycvXLgwJGR0YofDhw" \
+  "87vXbDhg2k0KOxsbGwsLC9vR1jfY1G88MPP/zwww9xcXGPP/54VFQURcSorKy8cOFCS0sL9kv6+/srKioqKipEIlFGRkZ+fj6bzR" \
+  "5ZQS6Xf/HFF06vTUpK8vLyItLhkpKSS5cu3bt3D/slOp2upKSkpKQkMDBw7ty5OTk5o5ypq6urT506NfZCqVTKWr58OYQejY2NCQ" \
+  "kJBN8BpH0Wi/Xkk09i/JGFhYVlZWW4u2G1WmUymUwmy8jIWLZsGZ/PH7lO9vT0OF15cN/OsSZ/9dVXP/30E75Gbt26devWrczMzO" \
+  "eee45cYjQ0NJw5c2bsrOnWsCsqKiopKZk3b15ubu4vcvJ/ssUBDodDxMm/vLy8qKios7MTdwtqtfrrr78uLi5esGDB7Nm/JBJwyl" \
+  "gkXIfl5+cXHh6ORseSkhLi9Lhy5QpaUUpKCpbV6cqVKydOnDCbycmoe/369Zs3b65cuXL69H+vWmivjcjrDAwMBADs27fv1q1bBD" \
+  "t87dq1tra2devWkaKTWK3Wr7/++tKlS6Q8TL1ef/Lkyfr6+pUrVwYFBUFq4n6YAwMDR48eraioIEtdOXLkSENDw+9//3uIUor0lg" \
+  "kAWLhwIWTx1ev1RHrT0tLS1dWFVvrYY4+5bOHzzz//8ssvyeKGQ0I4dOjQd999h3y02cg/NMdoNH711VfEuYGgo6OjoKCgra2NYD" \
+  "sajWbHjh1kcWPkKrd9+/ampiZAdhxYS0vLtm3byOLGyIFdUFCgUqkAABB1i4lM4SMljbENEewHWlF4ePikSZMg19rt9t27d1+7do" \
+  "0iyfvMmTPff/89RB4ggpMnT+KWqZzCZrPt2bNHo9HgbqGpqWn79u1qtZqKh2mz2fbu3avT6SZOnEhWmzKZbPfu3QaDgYoO6/X6go" \
+  "ICAEBYWBiMHgCA1FTUvLEEiQuhR0ZGBvxx79y50y2tEQdOnz5dWlpKRUoRKlYkq9W6d+9e3OaBvXv3OkyfFOFvf/tbbW0ti0XChk" \
+  "FZWdnHH39MaW+tVuv+/fsVCgXaisdyCDloU51cLler1YgkjWNl1Gq1aLJdeno65No9e/Z0dHRgvFFkZGRQUJCvr6+XlxeTyTSZTH" \
+  "q9XqVStbW1ubSifvbZZ5DFkwogxngfHx8ejwcAMJlMSEIgLHqnVqs9cuTIs88+69Ydu7q69u/fj7Eyn8+XSCSBgYHe3t5cLnd4eN" \
+  "hoNPb29qpUqrt377qU7L/88kvi9Kivr//0008xVvb19Q0PDxeLxUKhkMPhWK3WgYGBnp4epVKpUChczhq3b99GNR0h/wUHB0+ePB" \
+  "mRHcfi8uXL+HLSnD9/Hq1IKpVCFKNPPvmktbXVZfthYWEzZsxIS0tDm/6NRmNVVVVVVVV9fT1c+bsPrGAwGBkZGVKpFG03SS6Xl5" \
+  "aWXrlyBb75cPXq1fnz5wcEYM3Sa7FY9uzZg6XmtGnTpk+fnpKSgpZmRaVSVVRUyGQyiD6JzMpEHlRPT8/777+PpWZaWlpqampycj" \
+  "Kagaetra2qqqqiosKpZdLlOv8LyzMzM9HoUV1djYMeNputrg71/I05c+agFV2+fNmlRCcUCpcuXZqZmQmvxuPxZs+ePXv2bLlcfu" \
+  "zYMew7D6QjJiZm9erV8EU4KioqKipq3rx5hw8fhpv2T506tW7dOoy3PnjwoMOfAHLrp59+OjIy0uW6t2jRokWLFhUXF586dcrlyo" \
+  "wPBw4ccFknKSlp2bJlLoUaiUQikUiWLFlSVFT07bffupsT9BfOOaycTtmMw2bS2NiItnknFAqjo6PR5vt//vOf8JYTExN37drlkh" \
+  "ujXv+WLVsWLVr0QLiRlZW1ceNGjAJqYGDg1q1b4UYLmUwGmQ5HLTXwlRMA8NRTT73xxhsuuTES2dnZO3funDp1KunP6tSpUy6F6u" \
+  "eee27Dhg3YBX4Gg5Gfn79jxw53vRB+oQeHw4HM6OfOnSNRspo/fz5aEdoGtgO5ubkvvfQSl8vF8egXL1784osv3mduzJkzZ+XKle" \
+  "5e9frrr8N/IxaLotFoPH78OLzOSy+9NHJTDzuEQuHLL7/8yCOPkPisent7i4qKIBW4XO6bb77p1sw4cunbunVrWloaHnogIw+tXk" \
+  "1NDZprFprVrLGxEa105J7lSCgUCshVAIC8vLynnnqKyAuYPn36K6+8ct+4ERYWtmrVKhwXenh4rF27FlIBy45KYWEhfL/otddeS0" \
+  "xMJPIDV6xYMXfuXLIe1+eff+6SG26tcmOxbt26adOm4aFHYGAg2san1Wq9efMm9k7cuHEDrSg+Ph5tXkTLV+vQ5pcuXUr8HSQkJK" \
+  "xevfr+0GPNmjW4r01KSoJsk7vUoywWy9WrVyEV1q5dO3nyZOK/8ZlnniHIMcfSAef8K6+8MtZfDgfWr18fGhrqNj0AAPPmzUOreu" \
+  "HCBew9KCkpQSvKz3ceUK5Wq5ubm9Gu8vHxef7558katbNmzXJrkcWH6Ohogi63M2bMQCvq7++HWy3Pnz8P0USzsrLghnW38Mc//l" \
+  "EgEBBs5OzZs5DS3/3udyS6Zv7lL3/BYn1mjhV70Pzwmpqa+vr6sNy7s7MTzSzr6+uLNmPBhekNG0jOf7V69Wp8Cgx2LFiwgGALkO" \
+  "1aRBaFlEL27LlcLg51CAIWi/XCCy8QacFqtUI6HBISgsX/CDsEAgEWYyxzrI6fnJyMVruqqgrLvWUyGURAQiuCeOPGxMRIJCTHEn" \
+  "I4HIzOwrhHDHHRJTg4GLKjD7GrqlQqtA1ZAAC53HDIzHBrGxy3b9+G7D+QKDg4kJ2d7e3t7R49ANRNsLy8nCA90BxJlEolZKdpxY" \
+  "oVFNmUSInOcYrQ0FBSXLkg6ocjms8txZ3H40EmKSJYvhx/cmSIXB0aGkpRWJjL+dEJPSZNmoTWm5aWFsTJEf470erExsYGBwc7LY" \
+  "LskQcHB0OcxojAw8MDYssmCHxuOGMBiceCTLcQuYsibiAjx8cH50mlEOc66jqcnp4Onx+ZaJor2gWXL1+G3xJiLYHYyCFLR1JSEq" \
+  "AM1D163ANl7GSPVgRxHYdMN5CXSxz4NgqNRiPa6sFkMkk0IYwVgGNiYtymh1QqRWOVS/WjtrYWrSuQgd7d3Q2Zk6h7nWFhYRQlFi" \
+  "DrdCgc3TMYDGg+KTwej9L4dYjiCoFGo0FbCUNCQnx9fanrcGxsrNv04PF4aBuTWq0WEoHZ3NyM5t6TlZUFWcggNjGypBSnYLPZ8B" \
+  "g33CAeo+9yiUADRCmnOgcKvmAPSMgd1R3GQw+AvrENoN4iP/74I1oR3DCHZoRhMpkuzQvUCfdEQNaJ2DjagWRvoejHOsDn8yHSIE" \
+  "S4QiuidOlw+UBQ6REREeHv7/wYmrq6OqceyyaTCU30mjBhAlprCNCcF9lsNtVnWBLMnTEOAUnjQvVWj6enJw56QExwVL99DocD2R" \
+  "+ECQBojoNWq9WpEyjEfT0vLw/eSzSHLiaTSZaUggbqbLsPCpBwC6ofJr5bQNz5qO4wfIDB7j1z5ky0K53KV2iOJBwOBx43CxmjVq" \
+  "vVLVdIHKC6/fsPCOHvw4/FcQvIAL0Pbx9GTrjaimana25u1ul0I7/p7u5Gc7ZNSUnBbZ8ZGhqiOpTPZajQQwfIdiRFaQ0Ivi+IBE" \
+  "X12zebzTjpAQB49NFH0YpGqRmQnXIs3jIQgXUUD0kHxKb8kAKiTVH9Y/v7+12mdXWq0D+oDsMzv7igR3x8PJrdc5QDGZpDoUQiwW" \
+  "Lsg2yiYU/IgG/pIJIaZ3zC19cXzRysVCqx51/FgTt37uC4CmKcpDr+GR5f5FrvQVMburq6HFuzCoUC7WdgDOyCON5BEkkQR2trKx" \
+  "UZdx4s+Hw+2pRks9nQ9m1JAUan1VEIDAxEMx/19fWhpUAgBU6zZZNADzAiBRbEFRkSsTASkDAXt8Kw3IVLH5mHFBBXg+Li4gc1Ga" \
+  "OBy+VCnDtKS0sp6i3EvQArPUQiEVrUgUOgQosNhOdfHAlIhKTJZKLojfb390OiGh9qQATapqYmivTd0tJS3LleIaFOELWWIFxmUM" \
+  "BkVEYLJtbpdEajcXBwEE17hqRcGIWAgICIiAi00m+++YaKp3P69GnwKwXcV8JlLhh8cJn2AV+HzWYzkuuVXJhMJnh8IlZ6xMXFoV" \
+  "mWkGMonBYJhULIiHdLDDOZTCdPniT36bS3t0NSxz/sEIvFkDxxMpmMeDbrUThz5gyRRSk6Ohpijz59+nR/fz+5HYYnNnCDHgB92/" \
+  "v8+fNoK5S7KV7gwd/nzp0jV0WDnMjz60BOTg6k9ODBgyQmvZfL5Y509/jAZDLhGwBYcsNhR2Vl5fXr10mjR1ZWFpolxKnlh8FgwF" \
+  "+PUyUHkooOALBv3z6yjLDvv//+r2+7YxSys7Mh221arfbDDz8k5UY6ne7vf/878Xbg6bZaW1s/++wzUjqsUChcplNzjx5eXl5uRU" \
+  "5PmTIFhzMZPBrTZrO99957xIf1J5984jJx4K8D8AHX1NT0j3/8gzg3du3aRcpCxOPxZs6cCVf9jx49SvAunZ2db7/9NtY1DXu7kF" \
+  "NysK82LhcQ+D6JwWDYuXMnbilraGjogw8+IP0slXGL/Px8eDhAdXX1/v37cQ/uu3fvFhQUkKgVrFy5Eh7fUlxcTORUg9ra2l27dm" \
+  "Hf6XKDHnFxcRijBfz9/bEnohuFZ599Fu50bTKZ9u7d69Lm4PTR7Ny5k9JdlPEGJpPp8lDCxsbGgoICHAbuc+fOvfvuu+TaiDkcjs" \
+  "ssKjKZbNeuXe4e/GKz2QoLCw8cOOCWj6N73sLwtc/damhvFJ48E0FhYeE777xTWVmJZSZoa2v74osvDhw4QNHBSOMZU6dOdZluor" \
+  "u7+6OPPvr000+xmLNsNltVVdU777xDui0Rwdy5c10eZ3nv3r3du3cfP34cy4koZrP5+vXrb731Fo4p1b1jSjIyMtDMuGTRAwCQlJ" \
+  "SUn5/v0tTd1tZ2+PBhX1/fmTNnxsbGBgUFeXt7I74JNpttYGBAo9G0t7eXlpa6PCqExWJRfWzSA8SqVavkcrnLkVRWVlZWVhYZGS" \
+  "mVSpFgOD6fj7iaWywWvV6vVCpv375dXl4OCdZF4OHhQcQR/cUXX9y0aZNLT+qLFy9evHgROWQ9LCxMLBbzeDxENrNYLFqttqurq6" \
+  "GhobKy0qX4x2AwnEZlukeP4ODg+Ph4uONAQkIC8ejwJ554QqvVYjG9abXaoqKioqIiBoMhEAi4XC6DwRgaGjIYDBhH/JIlS5qamu" \
+  "C+Nw87Nm3atHXrViynqLa0tCByC4vFEggEbDbbZrOZTCaMnvCenp55eXlY5lC4iLVly5a//vWvWEQD5Gxr5NYCgcDT09Nmsw0ODm" \
+  "KU+oKCgtLS0tDmYrdDsSAu7gjIymi/Zs0at9Lg2u32/v5+jUajVqt1Oh1GbsyYMWPBggWkbzmNN3A4nDfffNOtQHOr1arT6dRqdX" \
+  "d3N/YokVdffTUrK4v4UiwWizdt2uTWIWzIioF0GLtG9OqrryYmJqIF9LtNj6lTp0JSy7DZbOLnoDuwbt06SpMyRUREIJlhqQ4SGg" \
+  "8Qi8WbN28mJcM5GvLy8qKjo7HoA1ggkUg2b95Mae6IZ555xs/PD+KV6DY94LubUqmU3ODg1atX4zvW0CUSEhI2b97skJV/C2q6SC" \
+  "Tatm0bbqMiHIsXL0aOlyBxMz4sLGzbtm3wTG1EVDLEmRAiwuEZyhDxCbsPInbk5ORs3ryZ3HxHCxYsuJ+H4IwfMBiM9evXr1q1is" \
+  "QZgc/nr1+/3nEwHbnzI5/P37hx4+LFi0ls09/f/4033nAY9CA7LSx8k1BYWNjYLK6I9YAiKWj79u0//vhjUVERFv3SpVlsVDgEmp" \
+  "HEpfkFEnkHSU7jFiDt4I77mzNnzpQpU86fP3/p0iXiE01ubu5Ij1U0xQNHkK0DixYtSk5OPnv2LMYk6BAdLD8/PycnZ6RW4/QxIr" \
+  "3Fef704sWLxzrAkHsCg1OrQGZm5rVr12QyGSRTo1PweLzk5GS0Q5N9fX2drrAuE3hyuVy0TUwc6Z7Q2kG7BZEMXf7+/itWrJg1a1" \
+  "ZpaemNGzfcdWYLCQlJTk6eOXPm2FhrNpvttMOIUZGIoLV27drs7Ozy8vKamhp3MxBIJJLU1NSMjIyxbgROXyLyDQN3Mr+xkwHVKc" \
+  "ZGoqWlpaGhoa2traurC83uxGKxxGJxaGhoVFRUamoqpHtms9npc2Cz2XBRYXh4GG0KZ7FYbhleIBYktPmYrFsAAKqrq5ubm9vb21" \
+  "UqFdp65eXlFRQUJJFIYmNjIQYYm82G1gKHwyHCkJHPBJkiFQqFRqNBewV8Pj84OFgikcTHx0M8BtFeIpfL/f8BABNKsNFzVxqEAA" \
+  "AAAElFTkSuQmCC"
+
+#if USE_PORTAL_ASSETS
+
+#if WM_ASSET_WM_CSS_ENABLED
+const char WM_ASSET_WM_CSS_TYPE[] PROGMEM = "text/css";
+
+const uint8_t WM_ASSET_WM_CSS_DATA[WM_ASSET_WM_CSS_LENGTH] PROGMEM =
+{
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x54, 0xef, 0x6f, 0xa2, 0x4a,
+  0x14, 0xfd, 0x57, 0x48, 0x9a, 0x4d, 0xdb, 0x17, 0x51, 0xf0, 0x57, 0x05, 0xd3, 0xcd, 0x43, 0x4b,
+  0xdd, 0x76, 0xad, 0xb6, 0x75, 0x75, 0x5d, 0x5f, 0xde, 0x87, 0x81, 0x19, 0x86, 0x29, 0x30, 0x43,
+  0x61, 0x14, 0x94, 0xf0, 0xbf, 0xef, 0x80, 0x68, 0x75, 0xb3, 0xd9, 0x64, 0xfd, 0xe2, 0xe5, 0x32,
+  0xf7, 0xde, 0x73, 0xcf, 0x39, 0x0c, 0x24, 0x9b, 0x2c, 0x04, 0x10, 0x12, 0x8a, 0xf5, 0x66, 0x98,
+  0xf6, 0x1d, 0x46, 0xb9, 0x1c, 0x93, 0x1d, 0xd2, 0x55, 0x14, 0xe4, 0x16, 0x83, 0xdb, 0x1a, 0x47,
+  0x29, 0x07, 0x11, 0x02, 0x35, 0x42, 0xc3, 0x35, 0xaf, 0xc5, 0xc8, 0x47, 0x36, 0xcf, 0x2c, 0x60,
+  0x7b, 0x38, 0x62, 0x6b, 0x0a, 0x75, 0xa5, 0x6f, 0xb1, 0x08, 0xa2, 0x48, 0x8e, 0x00, 0x24, 0xeb,
+  0x58, 0x3c, 0x17, 0x5d, 0x74, 0xb5, 0x1d, 0xa6, 0x52, 0x0c, 0x68, 0x2c, 0xc7, 0x28, 0x22, 0x4e,
+  0x3f, 0x00, 0x11, 0x26, 0x54, 0x57, 0xf2, 0xdf, 0x37, 0x64, 0x6b, 0xee, 0x13, 0x8a, 0xaa, 0xea,
+  0x0a, 0x43, 0x01, 0xe9, 0x00, 0xaf, 0x27, 0xe2, 0x84, 0x40, 0xee, 0xea, 0x9a, 0xf2, 0x29, 0x2f,
+  0x6b, 0xb3, 0x5f, 0x06, 0xd7, 0x3b, 0x02, 0x74, 0xdd, 0xe2, 0x54, 0x02, 0x59, 0x31, 0x45, 0x86,
+  0xc8, 0x66, 0x11, 0xe0, 0x84, 0x51, 0x9d, 0x32, 0x8a, 0xf2, 0xba, 0x2d, 0x7a, 0x03, 0x31, 0x26,
+  0xca, 0x2a, 0x38, 0x60, 0xcd, 0x59, 0xd5, 0x56, 0x55, 0x44, 0xdf, 0x7f, 0x03, 0x04, 0x09, 0x90,
+  0xae, 0x02, 0x42, 0xe5, 0x2a, 0xdd, 0x54, 0x94, 0x30, 0xbd, 0xce, 0xfe, 0x58, 0xdb, 0x12, 0xa5,
+  0xbf, 0xa9, 0xbd, 0xe9, 0x0a, 0xd4, 0xd7, 0x12, 0xa0, 0x50, 0x64, 0x41, 0xfa, 0x37, 0x1d, 0x3b,
+  0xca, 0xa7, 0xe3, 0xea, 0x4d, 0x71, 0x3c, 0x2f, 0x17, 0xcb, 0xce, 0x05, 0x72, 0xd5, 0x93, 0x44,
+  0xb3, 0x5a, 0xfe, 0x54, 0x9b, 0x8b, 0xae, 0xa1, 0x0d, 0x5b, 0xea, 0x2f, 0x0a, 0x09, 0x65, 0xaa,
+  0x8c, 0xa0, 0xdb, 0x66, 0x3e, 0x8b, 0xf4, 0x0b, 0xc7, 0x71, 0xfa, 0xf6, 0x3a, 0x8a, 0x45, 0x1c,
+  0x32, 0x42, 0x39, 0x8a, 0xfa, 0x90, 0xc4, 0xa1, 0x0f, 0xb6, 0x3a, 0xa1, 0x85, 0x32, 0xb2, 0xe5,
+  0x33, 0xdb, 0x3b, 0xc8, 0x28, 0x94, 0x91, 0x94, 0x23, 0x40, 0x55, 0x00, 0x94, 0x4a, 0xc1, 0x55,
+  0xf5, 0x28, 0x53, 0xc9, 0x67, 0x01, 0x48, 0x77, 0xd9, 0x46, 0xec, 0x78, 0x0a, 0xab, 0xa7, 0x2a,
+  0x77, 0x37, 0xca, 0xfe, 0x2d, 0xb0, 0x39, 0xd9, 0xa0, 0x5a, 0x19, 0x3b, 0xcc, 0x5e, 0xc7, 0x67,
+  0x27, 0x95, 0x9e, 0x95, 0xfb, 0xc0, 0x42, 0xfe, 0xe7, 0x7f, 0xb2, 0x73, 0x40, 0xb9, 0xc3, 0xa2,
+  0xe0, 0x24, 0x7b, 0x8a, 0x4f, 0xb6, 0x18, 0xe7, 0x2c, 0x28, 0x81, 0x1d, 0x0d, 0xb7, 0xef, 0xbe,
+  0xb7, 0x5d, 0x15, 0xef, 0xcd, 0x77, 0x18, 0xbb, 0x27, 0xa9, 0x22, 0xa4, 0x03, 0xac, 0xbc, 0x1e,
+  0xc4, 0xf8, 0x0c, 0x0d, 0x44, 0xce, 0x81, 0x4b, 0x1f, 0x39, 0x5c, 0xef, 0x14, 0x1e, 0x67, 0x3e,
+  0x81, 0xd2, 0x45, 0x47, 0x83, 0x1f, 0x7c, 0xec, 0x9d, 0xf8, 0x9e, 0x39, 0x3e, 0x03, 0x5c, 0x8f,
+  0x08, 0x76, 0x79, 0xc5, 0x4a, 0xb7, 0x20, 0xbf, 0x34, 0x27, 0xf0, 0x09, 0xa6, 0xfb, 0x77, 0x79,
+  0xdd, 0x3f, 0x1d, 0xb3, 0x8e, 0xfc, 0xab, 0x4b, 0x08, 0x38, 0xd0, 0x49, 0x00, 0x30, 0x6a, 0x84,
+  0x14, 0xf7, 0x2d, 0x10, 0xa3, 0x6e, 0xbb, 0x46, 0x16, 0x83, 0xe9, 0x6b, 0xa2, 0x7c, 0x1d, 0x61,
+  0x66, 0x88, 0xdf, 0x64, 0x36, 0x77, 0xcd, 0x39, 0x16, 0xd1, 0xb0, 0x78, 0x34, 0xf0, 0xd0, 0x78,
+  0x12, 0x7f, 0x03, 0x33, 0x7c, 0x88, 0x46, 0x45, 0x62, 0xbc, 0x18, 0x3c, 0x2d, 0xcc, 0x65, 0xa3,
+  0xd1, 0xe8, 0x99, 0x83, 0xc4, 0x19, 0x24, 0xf1, 0x38, 0xe9, 0x3d, 0x1b, 0xbb, 0xc9, 0x1b, 0x18,
+  0xe2, 0xf6, 0xe4, 0xdb, 0x62, 0x31, 0x7f, 0x7b, 0x24, 0xab, 0xbb, 0xd7, 0xf9, 0x7c, 0x7e, 0x9f,
+  0x42, 0xb2, 0x1a, 0xcd, 0x5c, 0xd6, 0x9d, 0xce, 0xbc, 0xce, 0x33, 0x6e, 0xa3, 0xfb, 0x2d, 0xfc,
+  0xf2, 0x6d, 0xf8, 0x06, 0x9c, 0x56, 0xd1, 0x6b, 0x65, 0xfa, 0xe6, 0xcb, 0xe2, 0xa5, 0xfd, 0x86,
+  0x9a, 0x93, 0x59, 0x72, 0x63, 0x3c, 0x18, 0xae, 0x39, 0x00, 0xc1, 0x57, 0xaa, 0xdd, 0x34, 0xd6,
+  0x4f, 0x4b, 0x73, 0x34, 0xd8, 0xb0, 0x9d, 0xf7, 0xdd, 0xd2, 0x86, 0xcd, 0x55, 0xda, 0x4e, 0x77,
+  0xdf, 0xb7, 0xde, 0xc0, 0xbd, 0x37, 0xd0, 0x8f, 0x50, 0xc3, 0xde, 0x78, 0xbb, 0x32, 0x95, 0xdd,
+  0xc3, 0x13, 0x65, 0x1a, 0x6d, 0x63, 0x55, 0x73, 0x03, 0xf8, 0xa3, 0xa5, 0xc5, 0x76, 0xf2, 0xbe,
+  0xf0, 0xa6, 0x4b, 0x90, 0x86, 0xae, 0xb2, 0x1a, 0x2e, 0x5f, 0xec, 0xf7, 0x74, 0x16, 0xe2, 0x97,
+  0x70, 0x3a, 0x01, 0x1d, 0x2d, 0xf1, 0x5e, 0xef, 0xa6, 0x63, 0xad, 0x85, 0x8c, 0xe5, 0x86, 0x04,
+  0x89, 0x6f, 0x3d, 0x5b, 0x49, 0xb2, 0x30, 0x10, 0x1e, 0xcf, 0xd4, 0x2f, 0x23, 0x67, 0x55, 0xae,
+  0x3c, 0x78, 0x7c, 0x9d, 0x77, 0xcc, 0xc8, 0x7b, 0xc4, 0x18, 0xdf, 0xde, 0x5e, 0x5e, 0x4b, 0x94,
+  0xc9, 0x11, 0x0a, 0x11, 0xe0, 0x52, 0x21, 0x91, 0x64, 0xa3, 0xd2, 0xcc, 0x1f, 0xf4, 0x7e, 0x7c,
+  0x3e, 0xa5, 0x13, 0xfe, 0xe3, 0xdb, 0x10, 0xdd, 0x5e, 0xda, 0x2e, 0xb2, 0x3d, 0x8b, 0xa5, 0x97,
+  0xff, 0x57, 0xa2, 0x15, 0xc5, 0x95, 0x66, 0xe5, 0xf7, 0x57, 0xe7, 0xc0, 0xf2, 0x91, 0xc4, 0xe1,
+  0xf1, 0xc2, 0x2c, 0x44, 0x3e, 0x95, 0xb2, 0xa8, 0x38, 0x1e, 0x2b, 0xee, 0xce, 0xcf, 0x3a, 0xe5,
+  0xae, 0x6c, 0xbb, 0xc4, 0x87, 0x57, 0x4d, 0x2a, 0xab, 0xd7, 0xe7, 0x5e, 0x82, 0x30, 0x77, 0x08,
+  0xf2, 0x61, 0x8c, 0x0e, 0x37, 0x99, 0x2e, 0x06, 0x1d, 0x2f, 0x4a, 0x31, 0xf3, 0x27, 0x3e, 0xeb,
+  0x7f, 0x89, 0x9f, 0x05, 0x00, 0x00
+};
+#endif
+
+#if WM_ASSET_WM_JS_ENABLED
+const char WM_ASSET_WM_JS_TYPE[] PROGMEM = "application/javascript";
+
+const uint8_t WM_ASSET_WM_JS_DATA[WM_ASSET_WM_JS_LENGTH] PROGMEM =
+{
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x4b, 0x2b, 0xcd, 0x4b, 0x2e, 0xc9,
+  0xcc, 0xcf, 0x53, 0x48, 0xd6, 0xc8, 0xd1, 0xac, 0x4e, 0xc9, 0x4f, 0x2e, 0xcd, 0x4d, 0xcd, 0x2b,
+  0xd1, 0x4b, 0x4f, 0x2d, 0x71, 0xcd, 0x49, 0x05, 0x31, 0x9d, 0x2a, 0x3d, 0x53, 0x34, 0xd4, 0x8b,
+  0xd5, 0x35, 0xf5, 0xca, 0x12, 0x73, 0x4a, 0x53, 0x6d, 0x73, 0xf4, 0x32, 0xf3, 0xf2, 0x52, 0x8b,
+  0x42, 0x52, 0x2b, 0x4a, 0x6a, 0x6a, 0x72, 0xf4, 0x4a, 0x80, 0xb4, 0x73, 0x7e, 0x5e, 0x09, 0x50,
+  0xa5, 0x35, 0x4e, 0xdd, 0x05, 0x40, 0xdd, 0x69, 0x40, 0xc9, 0x62, 0x0d, 0x4d, 0xdc, 0x8a, 0x8a,
+  0x0d, 0x29, 0xb3, 0xc3, 0x10, 0xc9, 0x92, 0x5a, 0x00, 0x20, 0x94, 0xce, 0x45, 0xd7, 0x00, 0x00,
+  0x00
+};
+#endif
+
+#if WM_ASSET_TZ_JS_ENABLED
+const char WM_ASSET_TZ_JS_TYPE[] PROGMEM = "application/javascript";
+
+const uint8_t WM_ASSET_TZ_JS_DATA[WM_ASSET_TZ_JS_LENGTH] PROGMEM =
+{
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8d, 0x58, 0xdb, 0x6e, 0xe3, 0x38,
+  0x12, 0x7d, 0x9f, 0xaf, 0xf0, 0xe8, 0xa1, 0xdb, 0x9a, 0xc8, 0xf7, 0xd8, 0x4e, 0xdb, 0xe3, 0x09,
+  0x72, 0x9b, 0x24, 0xdd, 0xc9, 0x4c, 0xb0, 0xed, 0x9d, 0x45, 0xd6, 0x30, 0x0c, 0x46, 0xa2, 0x2d,
+  0xb6, 0x65, 0xd2, 0x4b, 0x52, 0x49, 0xa7, 0x03, 0xff, 0xd9, 0xbe, 0xcd, 0x8f, 0x4d, 0x51, 0x12,
+  0x25, 0x4a, 0x62, 0x03, 0x0d, 0x03, 0x86, 0x54, 0x37, 0x16, 0x8b, 0xc5, 0x73, 0xca, 0xee, 0xfc,
+  0xd2, 0xf8, 0x22, 0xe6, 0x64, 0x87, 0xbf, 0x31, 0x8a, 0x2f, 0xb1, 0xc4, 0xbe, 0x6c, 0xf4, 0xda,
+  0xdd, 0xf6, 0xb1, 0xd7, 0xb8, 0xbf, 0x9d, 0x37, 0x22, 0xe2, 0x63, 0x2a, 0xb0, 0xd7, 0x08, 0xa5,
+  0xdc, 0x8b, 0x49, 0xa7, 0xf3, 0x44, 0xe4, 0x53, 0xec, 0x6f, 0xb1, 0x6c, 0x33, 0xbe, 0xe9, 0xec,
+  0x71, 0x14, 0xe1, 0x3d, 0xd9, 0x75, 0xbe, 0x08, 0x99, 0xc5, 0x08, 0xd2, 0x18, 0xbf, 0x74, 0x7e,
+  0x6a, 0xae, 0x63, 0xea, 0x4b, 0xc2, 0x68, 0x13, 0xbb, 0x6f, 0xcf, 0x88, 0x37, 0xe4, 0x2c, 0x97,
+  0xb8, 0x6f, 0x4e, 0x2c, 0x70, 0x43, 0x48, 0x4e, 0x7c, 0xe9, 0x4c, 0x95, 0x16, 0xcf, 0x1c, 0xe1,
+  0x78, 0x74, 0x56, 0xf7, 0x6a, 0xe1, 0xf6, 0x06, 0x4b, 0x9d, 0xe4, 0x9f, 0xeb, 0xb5, 0xc0, 0xb2,
+  0xe9, 0x4e, 0x39, 0x96, 0x31, 0xa7, 0x0d, 0xf9, 0xf3, 0x6c, 0x46, 0xe3, 0x28, 0x3a, 0x95, 0x93,
+  0xee, 0xc1, 0xe3, 0x86, 0xbf, 0x27, 0x3d, 0x9a, 0xc6, 0xe0, 0x33, 0x8a, 0x5f, 0x1a, 0x97, 0x48,
+  0x62, 0xed, 0x85, 0xc1, 0x2b, 0xa6, 0x01, 0x5e, 0x13, 0x48, 0xf9, 0xdd, 0x3b, 0xde, 0x86, 0x98,
+  0xbf, 0x43, 0x94, 0x47, 0x8c, 0x38, 0xac, 0xec, 0x25, 0x02, 0xe5, 0xd0, 0xa4, 0xd9, 0xcb, 0x3d,
+  0xa3, 0x32, 0x6c, 0x4a, 0x78, 0x3b, 0x78, 0xa4, 0x94, 0x65, 0x16, 0x92, 0x36, 0xc1, 0xd3, 0xeb,
+  0x7a, 0x7d, 0xd7, 0x3d, 0x78, 0xe2, 0xfb, 0x16, 0xc3, 0xd4, 0x82, 0x59, 0x76, 0x9a, 0x6c, 0x34,
+  0x5d, 0xc8, 0xfd, 0x6d, 0x7c, 0x2a, 0x9a, 0x89, 0x20, 0xcf, 0xcb, 0x75, 0x27, 0xa4, 0x26, 0x82,
+  0x2d, 0xab, 0x08, 0x79, 0x39, 0x5a, 0x1c, 0xb6, 0x06, 0x95, 0x88, 0xcd, 0x6a, 0xa7, 0xe1, 0x49,
+  0xd3, 0x85, 0x02, 0x8b, 0xa6, 0xf2, 0x81, 0xe7, 0x96, 0x28, 0xaa, 0xc8, 0x7f, 0xed, 0x9e, 0xca,
+  0x23, 0xc7, 0xeb, 0x39, 0x13, 0xfe, 0x5b, 0xf7, 0x94, 0xaa, 0x47, 0xcf, 0x39, 0xc2, 0x13, 0x25,
+  0xec, 0x3a, 0x07, 0x0f, 0x55, 0xc3, 0xe1, 0x59, 0x5c, 0xb8, 0xab, 0xf2, 0xca, 0xb6, 0x3a, 0xa2,
+  0xff, 0xc2, 0x11, 0x35, 0xa1, 0x3b, 0x22, 0xc1, 0x68, 0x5b, 0x37, 0x85, 0x58, 0xe0, 0x25, 0x6c,
+  0x79, 0x6d, 0xd9, 0xb2, 0x3e, 0x98, 0x66, 0xbf, 0xdb, 0xeb, 0x7a, 0x23, 0xaf, 0x37, 0x84, 0x85,
+  0xbb, 0xea, 0xa3, 0x72, 0x7d, 0x73, 0xce, 0x76, 0x18, 0x7a, 0x04, 0x75, 0x2e, 0x31, 0x7d, 0xc6,
+  0xdc, 0x99, 0x98, 0xf6, 0x3d, 0xaf, 0xef, 0xf5, 0x06, 0xde, 0x40, 0xdb, 0xe7, 0xc6, 0xf7, 0xe8,
+  0x1b, 0x92, 0x11, 0xa2, 0x55, 0xf3, 0x81, 0x67, 0xb3, 0xbe, 0x08, 0xe1, 0x7b, 0xc3, 0x7e, 0x34,
+  0x36, 0xfe, 0x4a, 0x7c, 0xb6, 0xba, 0x20, 0xf2, 0xf5, 0xc7, 0xc2, 0x9f, 0x09, 0xd8, 0x34, 0xec,
+  0xb9, 0x6c, 0xdd, 0xf7, 0x3e, 0x78, 0x63, 0x8b, 0xf5, 0x67, 0x44, 0x25, 0xa9, 0x65, 0xa3, 0xac,
+  0xad, 0xa9, 0xa3, 0xdd, 0x9e, 0xad, 0xae, 0x39, 0x82, 0x56, 0xae, 0x7b, 0xf4, 0x7b, 0xd0, 0x6c,
+  0xb5, 0xfc, 0xa1, 0xbd, 0xf0, 0x33, 0x09, 0x70, 0x6d, 0xc3, 0xe0, 0x60, 0x4d, 0x88, 0xad, 0x1e,
+  0x50, 0x1c, 0x59, 0xcc, 0x7b, 0x23, 0x4b, 0xfc, 0x3b, 0x26, 0x56, 0x67, 0x74, 0x83, 0x23, 0x2c,
+  0xac, 0x15, 0x3d, 0xb1, 0x6e, 0x19, 0xad, 0x6e, 0x05, 0x7a, 0xc2, 0x51, 0xbd, 0xa4, 0x43, 0x8b,
+  0xc7, 0x0d, 0x7a, 0x46, 0x14, 0x55, 0x37, 0x0c, 0xe1, 0xe1, 0xf6, 0xd5, 0x8c, 0xff, 0xc0, 0x2f,
+  0xab, 0x47, 0xc6, 0xb7, 0x56, 0xf3, 0x71, 0x61, 0x2e, 0x08, 0xea, 0x9c, 0x63, 0xc2, 0x63, 0x59,
+  0xcf, 0xbb, 0x3f, 0x2e, 0xba, 0xd2, 0xb9, 0x8a, 0x39, 0xdb, 0xe3, 0xce, 0x0d, 0x8e, 0x04, 0xa1,
+  0x5b, 0x62, 0xb5, 0x3e, 0xae, 0x5a, 0xdf, 0x0a, 0x89, 0xe8, 0x53, 0x1c, 0x59, 0xac, 0x4f, 0xcc,
+  0x2a, 0xaa, 0x2c, 0x2e, 0xd1, 0x0e, 0x09, 0x3f, 0x16, 0xf5, 0x62, 0xf4, 0xcc, 0xfd, 0x29, 0xd3,
+  0x8f, 0x98, 0xc7, 0x02, 0x45, 0x78, 0x67, 0xb3, 0x1d, 0x95, 0x6d, 0xaf, 0xe1, 0x56, 0x94, 0xcc,
+  0xba, 0x1f, 0xd2, 0xe5, 0xbb, 0xde, 0x20, 0x37, 0x5c, 0x67, 0x7d, 0x45, 0x38, 0xab, 0xda, 0x0e,
+  0xbc, 0xfe, 0xd0, 0xb4, 0x7d, 0x40, 0x3e, 0x59, 0x13, 0xbf, 0x73, 0x06, 0x84, 0x00, 0x97, 0x2d,
+  0xa8, 0xa6, 0x70, 0xe2, 0xf5, 0x47, 0x46, 0x81, 0xb5, 0xf9, 0xef, 0xe4, 0x4b, 0xa5, 0x66, 0x5d,
+  0x4f, 0x15, 0x02, 0x92, 0x19, 0x58, 0x4e, 0x3a, 0x22, 0x6b, 0xf4, 0xd5, 0xda, 0x49, 0xa3, 0x9a,
+  0xf5, 0x35, 0x63, 0x02, 0xaf, 0xce, 0xd1, 0xab, 0xd5, 0xbe, 0x9f, 0x9e, 0xa1, 0x79, 0x17, 0xc8,
+  0xff, 0x62, 0x1c, 0x31, 0x6a, 0x35, 0x1f, 0x5a, 0xc2, 0x07, 0x32, 0x44, 0x4f, 0x3f, 0xd6, 0x1e,
+  0xf7, 0x4c, 0xf8, 0xec, 0xc5, 0x99, 0xc8, 0xac, 0xfa, 0x8f, 0x78, 0x0b, 0x1e, 0x9c, 0x40, 0x13,
+  0xf0, 0x4d, 0x21, 0xfe, 0x73, 0x27, 0xb6, 0xc5, 0xdb, 0x27, 0x8e, 0x04, 0x65, 0xaf, 0x88, 0x9b,
+  0xc2, 0x5b, 0xbe, 0x8d, 0xa5, 0x29, 0x78, 0x44, 0x15, 0xc1, 0x5f, 0x11, 0x0a, 0xc8, 0x33, 0x13,
+  0x92, 0x99, 0xb1, 0xd0, 0xce, 0x0f, 0x91, 0xdc, 0xa2, 0x54, 0xf4, 0xcc, 0xe3, 0x3d, 0xea, 0xcc,
+  0xff, 0xfe, 0x3f, 0xdf, 0x92, 0x57, 0x9c, 0xca, 0x62, 0x20, 0x60, 0x28, 0x30, 0xea, 0x3c, 0x60,
+  0x2e, 0xc3, 0xf2, 0x79, 0x9f, 0xa8, 0xeb, 0xd1, 0xcb, 0xf7, 0x75, 0xc8, 0xa1, 0x1e, 0xb0, 0x5c,
+  0xbf, 0xbc, 0x29, 0xb6, 0xe7, 0x3b, 0xe0, 0xd0, 0x09, 0xf2, 0x02, 0x70, 0x5c, 0x11, 0xb1, 0x0a,
+  0x84, 0x9c, 0x30, 0x0f, 0xbe, 0x57, 0xd0, 0xf2, 0x5c, 0xae, 0xd6, 0x8c, 0x4f, 0xd6, 0x87, 0x03,
+  0x90, 0x45, 0xc1, 0x10, 0x25, 0x22, 0xa8, 0x8d, 0x02, 0x36, 0xdc, 0x5f, 0x54, 0x25, 0x16, 0xb4,
+  0x5f, 0x5a, 0x30, 0x7d, 0x51, 0x13, 0xd9, 0xa1, 0x7c, 0x69, 0x83, 0xe0, 0x45, 0x5d, 0x66, 0xc1,
+  0xf5, 0xef, 0xc0, 0xf1, 0xd2, 0x8e, 0xb9, 0x0b, 0x9b, 0xd4, 0x06, 0xb7, 0xcb, 0x0a, 0x26, 0x2d,
+  0x4a, 0xaf, 0x75, 0x18, 0xaa, 0x43, 0x4d, 0x15, 0x4e, 0x6a, 0x98, 0x61, 0x02, 0xc3, 0xd2, 0x76,
+  0xa1, 0x17, 0x75, 0x59, 0xe5, 0x22, 0x2f, 0xbf, 0x83, 0xfc, 0x0b, 0xab, 0xf8, 0x3b, 0xa0, 0xbf,
+  0xb4, 0xa1, 0xf5, 0xa2, 0x0a, 0xf7, 0x16, 0xa3, 0xa5, 0x05, 0x29, 0x16, 0x16, 0x38, 0xa8, 0x9b,
+  0x2d, 0x2d, 0xd7, 0x7a, 0x51, 0x07, 0x86, 0xba, 0x95, 0x3e, 0x96, 0xcb, 0xf8, 0x09, 0x11, 0xe5,
+  0x53, 0xbe, 0xef, 0xb9, 0x3a, 0x44, 0xea, 0xe6, 0x2d, 0x6c, 0x97, 0x5f, 0xdb, 0x7c, 0x04, 0x13,
+  0x2e, 0x0b, 0xab, 0x04, 0x0b, 0xb4, 0xf2, 0x73, 0x88, 0xe8, 0x26, 0x4c, 0x97, 0xa8, 0x61, 0x43,
+  0xfd, 0xee, 0x6a, 0xb7, 0x39, 0xdb, 0xbe, 0xb2, 0xdc, 0x47, 0x43, 0xc7, 0xd2, 0x74, 0x38, 0xe7,
+  0x44, 0x3c, 0x21, 0x8a, 0x8b, 0xec, 0x50, 0x6e, 0xa5, 0xcf, 0xf6, 0x0f, 0x16, 0xef, 0x70, 0x91,
+  0x99, 0x09, 0x30, 0x86, 0xd5, 0x1c, 0x71, 0xf4, 0x52, 0x58, 0x15, 0x88, 0xb3, 0xcc, 0x99, 0xe4,
+  0x23, 0x83, 0x7d, 0xc0, 0x04, 0x98, 0xa2, 0xde, 0xc2, 0x68, 0xb8, 0x0a, 0xd9, 0xe4, 0xed, 0x8e,
+  0x36, 0x61, 0x80, 0x02, 0xb3, 0xb2, 0x84, 0xaa, 0xe4, 0xd4, 0x70, 0x8f, 0xcd, 0xd1, 0x5b, 0xcf,
+  0xa1, 0x74, 0xc1, 0x97, 0x20, 0xc7, 0xed, 0x08, 0xd3, 0x8d, 0x0c, 0x61, 0xf6, 0xee, 0xc2, 0x74,
+  0x8d, 0x17, 0xdd, 0xe5, 0x14, 0xb0, 0xa7, 0x39, 0x15, 0xbf, 0x92, 0xa9, 0x38, 0x9a, 0xf5, 0xdc,
+  0x37, 0x25, 0x15, 0xcb, 0x29, 0x59, 0xc3, 0x84, 0x6a, 0xc0, 0x95, 0x7a, 0x33, 0xe1, 0xaa, 0xc9,
+  0x5c, 0x17, 0x86, 0xf6, 0x19, 0xcb, 0x60, 0xee, 0x70, 0x28, 0x0d, 0xf4, 0xf9, 0x3c, 0x2f, 0x5f,
+  0xf7, 0x98, 0xad, 0x1b, 0x6a, 0xfd, 0x9f, 0x67, 0x4e, 0xfe, 0x73, 0xc2, 0xc9, 0xb1, 0x12, 0x06,
+  0xec, 0x77, 0xef, 0xd4, 0xd4, 0xfd, 0x46, 0xd1, 0x0e, 0x4f, 0xea, 0x11, 0xb8, 0x0a, 0x9d, 0x4d,
+  0xcb, 0xb3, 0xb7, 0xfc, 0xb1, 0x18, 0x9c, 0x01, 0x09, 0x5b, 0xe3, 0x3e, 0x00, 0xb0, 0x33, 0x71,
+  0xae, 0xa4, 0xdf, 0xb9, 0xbe, 0x9f, 0x1f, 0xf5, 0xfa, 0x50, 0xbb, 0xd6, 0x68, 0x94, 0x4a, 0xf5,
+  0x59, 0x3c, 0x00, 0x3a, 0xad, 0x1e, 0x52, 0x88, 0x6a, 0x8d, 0xba, 0x5d, 0x35, 0xca, 0x17, 0x58,
+  0x15, 0xa0, 0xad, 0x96, 0x9b, 0x4e, 0x37, 0x8c, 0xb2, 0x28, 0x8e, 0x62, 0xa5, 0x1b, 0x8e, 0xcb,
+  0xba, 0x7b, 0xc4, 0xe1, 0x12, 0x08, 0x24, 0x12, 0xe5, 0x71, 0x59, 0x79, 0x8d, 0x76, 0x4f, 0x24,
+  0x41, 0xe1, 0x44, 0x55, 0x5a, 0x8b, 0xfa, 0x21, 0xe3, 0x68, 0x83, 0x95, 0xf2, 0xf8, 0xa4, 0xac,
+  0x2c, 0x83, 0x41, 0xa2, 0x2e, 0x6d, 0x82, 0x48, 0x1f, 0xba, 0x81, 0x26, 0xba, 0x6c, 0xdb, 0xda,
+  0xf5, 0x21, 0x64, 0x98, 0x92, 0xaf, 0x5a, 0x65, 0x46, 0xcd, 0x29, 0xa1, 0x35, 0x18, 0x95, 0x9d,
+  0xae, 0x63, 0x38, 0xe6, 0x1d, 0x8a, 0x90, 0x56, 0x9a, 0x6e, 0x05, 0x23, 0xa4, 0x2a, 0x4f, 0x18,
+  0xa9, 0x5c, 0x21, 0x21, 0xb3, 0x98, 0xdd, 0x72, 0xcc, 0x73, 0xb6, 0x61, 0x12, 0x69, 0x8d, 0x19,
+  0x30, 0xc7, 0x25, 0xd0, 0xf5, 0xc7, 0x65, 0xaf, 0x0b, 0xb8, 0x2b, 0x7e, 0x5a, 0xcc, 0x7e, 0xa5,
+  0x62, 0x1a, 0x93, 0x32, 0x95, 0xe9, 0xa5, 0x60, 0x92, 0xad, 0x2e, 0x19, 0x70, 0x6c, 0x9a, 0x68,
+  0xe2, 0x9b, 0x24, 0x6a, 0xa1, 0xa6, 0x56, 0xbf, 0x57, 0x8e, 0xfc, 0x59, 0xae, 0xe0, 0x02, 0xd2,
+  0x64, 0xd5, 0x5e, 0xe5, 0x28, 0x34, 0xa0, 0x65, 0x2a, 0x73, 0xd5, 0x33, 0xbe, 0xc1, 0x10, 0x94,
+  0xc2, 0x5e, 0x63, 0x4c, 0xd5, 0x91, 0x11, 0x8e, 0x8b, 0x20, 0xa5, 0xe5, 0x4b, 0x2c, 0xd6, 0xea,
+  0x55, 0x7a, 0xb5, 0xaf, 0x85, 0xbd, 0xaa, 0x50, 0x9f, 0x85, 0x62, 0x6e, 0xa9, 0x08, 0xe6, 0x1b,
+  0xcb, 0xd6, 0xd0, 0x47, 0xa8, 0x35, 0x17, 0x68, 0x8f, 0x57, 0x7f, 0x61, 0x1e, 0xa8, 0x8e, 0x2a,
+  0xc2, 0xff, 0x7b, 0x7e, 0x91, 0xbc, 0x27, 0x91, 0x53, 0xa4, 0xb8, 0x63, 0x34, 0x48, 0x40, 0x7b,
+  0x54, 0x12, 0x9f, 0x63, 0x1e, 0x91, 0x4c, 0x9c, 0x44, 0x4e, 0x71, 0xe7, 0x0e, 0x8a, 0x26, 0x32,
+  0xe3, 0x74, 0x4b, 0xa9, 0xfc, 0x3f, 0x84, 0x06, 0xd0, 0x6b, 0xea, 0x14, 0x75, 0xe6, 0x65, 0xe6,
+  0xd5, 0x9b, 0xb4, 0x41, 0x1c, 0x68, 0x75, 0x31, 0x4d, 0x34, 0x4b, 0xc5, 0x46, 0x4e, 0x19, 0x5d,
+  0x78, 0x4e, 0x7e, 0x64, 0x09, 0x7a, 0xe3, 0x10, 0x86, 0x07, 0x25, 0x3d, 0x36, 0x82, 0xa4, 0x54,
+  0x93, 0x0a, 0x8b, 0x6c, 0x00, 0xb4, 0x95, 0x6c, 0x6c, 0x18, 0x7e, 0x42, 0x29, 0xed, 0xe7, 0x7d,
+  0x59, 0xe7, 0x9e, 0x54, 0x69, 0x78, 0x40, 0x57, 0x86, 0x2a, 0xf8, 0x60, 0x60, 0x8a, 0x59, 0x04,
+  0x4e, 0xaa, 0xc7, 0x07, 0xc7, 0x43, 0xd3, 0x5a, 0x86, 0x3b, 0x18, 0x02, 0xd4, 0xc2, 0xf9, 0x4d,
+  0x2b, 0xd8, 0x2e, 0x15, 0xe6, 0x0b, 0x27, 0x74, 0x06, 0xb2, 0x0f, 0x86, 0xe1, 0xbf, 0x80, 0xd4,
+  0x58, 0x72, 0x44, 0xc7, 0x66, 0x69, 0xcb, 0xdc, 0x96, 0xdf, 0x7c, 0x93, 0x24, 0x41, 0x6c, 0x16,
+  0x36, 0xa7, 0xc7, 0x54, 0x9e, 0x47, 0xd2, 0x8c, 0xe7, 0x39, 0xc3, 0x7e, 0x96, 0x79, 0x4e, 0x7c,
+  0x57, 0xb1, 0x9f, 0x00, 0x81, 0xd2, 0x64, 0x27, 0x5e, 0xd7, 0x99, 0x35, 0xd6, 0xc4, 0x98, 0x8a,
+  0xf3, 0xb5, 0x53, 0x8e, 0x05, 0xa1, 0xae, 0x7d, 0x1e, 0xe5, 0x12, 0xf1, 0x97, 0xa4, 0xd3, 0x94,
+  0xaa, 0xba, 0xc4, 0x59, 0x80, 0x23, 0x44, 0x92, 0x2e, 0xd6, 0x38, 0x6c, 0x21, 0xe5, 0x54, 0x99,
+  0xa7, 0x60, 0x32, 0x6f, 0xa6, 0xaa, 0x84, 0xfd, 0xfc, 0x1a, 0x50, 0xac, 0x46, 0x9c, 0xd1, 0xa0,
+  0xae, 0xbc, 0x63, 0x3c, 0x58, 0xdd, 0xb0, 0x97, 0x24, 0xae, 0x79, 0x38, 0x05, 0x57, 0xa7, 0x0a,
+  0x13, 0x85, 0x33, 0xf2, 0x07, 0xc5, 0x87, 0xaa, 0x82, 0xaf, 0xa1, 0x33, 0x40, 0xa3, 0x38, 0xa9,
+  0x8c, 0x97, 0xc6, 0x80, 0xa8, 0x09, 0xab, 0x32, 0x26, 0x80, 0x62, 0x34, 0xac, 0x78, 0x5d, 0x40,
+  0x0e, 0x21, 0x52, 0x93, 0xe8, 0xb8, 0x42, 0x05, 0x73, 0x46, 0x37, 0xd0, 0x82, 0xfb, 0x38, 0xd3,
+  0x55, 0x56, 0xdb, 0x13, 0x15, 0xf0, 0xa4, 0x42, 0x4b, 0x9f, 0x08, 0x27, 0xc0, 0x9d, 0x48, 0x12,
+  0x07, 0xc8, 0x34, 0xa5, 0x67, 0xfc, 0x75, 0xcf, 0xb8, 0x14, 0x25, 0x86, 0x3e, 0xcd, 0x84, 0xed,
+  0x2f, 0x42, 0x7e, 0x9b, 0xc9, 0x09, 0xce, 0x1e, 0x0e, 0x6e, 0x53, 0x86, 0x44, 0xb8, 0xd3, 0x9f,
+  0x92, 0x7f, 0xa7, 0x32, 0x16, 0x9e, 0x29, 0x65, 0x3b, 0xff, 0xad, 0x03, 0xbf, 0x64, 0x7c, 0x46,
+  0x05, 0x8b, 0x60, 0xe2, 0x60, 0x9b, 0xe6, 0xfb, 0x47, 0x16, 0x17, 0xb6, 0x0d, 0x22, 0x26, 0xef,
+  0x1b, 0x47, 0xf9, 0x7b, 0x5b, 0x31, 0x7f, 0xd3, 0x75, 0xa7, 0x01, 0xf3, 0xa1, 0xaa, 0x54, 0xaa,
+  0xbf, 0xef, 0xae, 0x60, 0xf8, 0x86, 0xc7, 0xf3, 0xd7, 0xdb, 0xa0, 0xf9, 0x5e, 0x5b, 0xbe, 0x77,
+  0xdb, 0x04, 0x60, 0x84, 0xdf, 0xcc, 0xef, 0xef, 0x66, 0x15, 0xf7, 0xe9, 0x3f, 0x28, 0x6b, 0xad,
+  0x61, 0xa8, 0x15, 0x00, 0x00
+};
+#endif
+
+#if WM_ASSET_LOGO_PNG_ENABLED
+const char WM_ASSET_LOGO_PNG_TYPE[] PROGMEM = "image/png";
+
+const uint8_t WM_ASSET_LOGO_PNG_DATA[WM_ASSET_LOGO_PNG_LENGTH] PROGMEM =
+{
+  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x5c, 0x08, 0x02, 0x00, 0x00, 0x00, 0x19, 0x09, 0x6c,
+  0xc0, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b,
+  0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x0a, 0x4f, 0x69, 0x43, 0x43, 0x50, 0x50, 0x68,
+  0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 0x66,
+  0x69, 0x6c, 0x65, 0x00, 0x00, 0x78, 0xda, 0x9d, 0x53, 0x67, 0x54, 0x53, 0xe9, 0x16, 0x3d, 0xf7,
+  0xde, 0xf4, 0x42, 0x4b, 0x88, 0x80, 0x94, 0x4b, 0x6f, 0x52, 0x15, 0x08, 0x20, 0x52, 0x42, 0x8b,
+  0x80, 0x14, 0x91, 0x26, 0x2a, 0x21, 0x09, 0x10, 0x4a, 0x88, 0x21, 0xa1, 0xd9, 0x15, 0x51, 0xc1,
+  0x11, 0x45, 0x45, 0x04, 0x1b, 0xc8, 0xa0, 0x88, 0x03, 0x8e, 0x8e, 0x80, 0x8c, 0x15, 0x51, 0x2c,
+  0x0c, 0x8a, 0x0a, 0xd8, 0x07, 0xe4, 0x21, 0xa2, 0x8e, 0x83, 0xa3, 0x88, 0x8a, 0xca, 0xfb, 0xe1,
+  0x7b, 0xa3, 0x6b, 0xd6, 0xbc, 0xf7, 0xe6, 0xcd, 0xfe, 0xb5, 0xd7, 0x3e, 0xe7, 0xac, 0xf3, 0x9d,
+  0xb3, 0xcf, 0x07, 0xc0, 0x08, 0x0c, 0x96, 0x48, 0x33, 0x51, 0x35, 0x80, 0x0c, 0xa9, 0x42, 0x1e,
+  0x11, 0xe0, 0x83, 0xc7, 0xc4, 0xc6, 0xe1, 0xe4, 0x2e, 0x40, 0x81, 0x0a, 0x24, 0x70, 0x00, 0x10,
+  0x08, 0xb3, 0x64, 0x21, 0x73, 0xfd, 0x23, 0x01, 0x00, 0xf8, 0x7e, 0x3c, 0x3c, 0x2b, 0x22, 0xc0,
+  0x07, 0xbe, 0x00, 0x01, 0x78, 0xd3, 0x0b, 0x08, 0x00, 0xc0, 0x4d, 0x9b, 0xc0, 0x30, 0x1c, 0x87,
+  0xff, 0x0f, 0xea, 0x42, 0x99, 0x5c, 0x01, 0x80, 0x84, 0x01, 0xc0, 0x74, 0x91, 0x38, 0x4b, 0x08,
+  0x80, 0x14, 0x00, 0x40, 0x7a, 0x8e, 0x42, 0xa6, 0x00, 0x40, 0x46, 0x01, 0x80, 0x9d, 0x98, 0x26,
+  0x53, 0x00, 0xa0, 0x04, 0x00, 0x60, 0xcb, 0x63, 0x62, 0xe3, 0x00, 0x50, 0x2d, 0x00, 0x60, 0x27,
+  0x7f, 0xe6, 0xd3, 0x00, 0x80, 0x9d, 0xf8, 0x99, 0x7b, 0x01, 0x00, 0x5b, 0x94, 0x21, 0x15, 0x01,
+  0xa0, 0x91, 0x00, 0x20, 0x13, 0x65, 0x88, 0x44, 0x00, 0x68, 0x3b, 0x00, 0xac, 0xcf, 0x56, 0x8a,
+  0x45, 0x00, 0x58, 0x30, 0x00, 0x14, 0x66, 0x4b, 0xc4, 0x39, 0x00, 0xd8, 0x2d, 0x00, 0x30, 0x49,
+  0x57, 0x66, 0x48, 0x00, 0xb0, 0xb7, 0x00, 0xc0, 0xce, 0x10, 0x0b, 0xb2, 0x00, 0x08, 0x0c, 0x00,
+  0x30, 0x51, 0x88, 0x85, 0x29, 0x00, 0x04, 0x7b, 0x00, 0x60, 0xc8, 0x23, 0x23, 0x78, 0x00, 0x84,
+  0x99, 0x00, 0x14, 0x46, 0xf2, 0x57, 0x3c, 0xf1, 0x2b, 0xae, 0x10, 0xe7, 0x2a, 0x00, 0x00, 0x78,
+  0x99, 0xb2, 0x3c, 0xb9, 0x24, 0x39, 0x45, 0x81, 0x5b, 0x08, 0x2d, 0x71, 0x07, 0x57, 0x57, 0x2e,
+  0x1e, 0x28, 0xce, 0x49, 0x17, 0x2b, 0x14, 0x36, 0x61, 0x02, 0x61, 0x9a, 0x40, 0x2e, 0xc2, 0x79,
+  0x99, 0x19, 0x32, 0x81, 0x34, 0x0f, 0xe0, 0xf3, 0xcc, 0x00, 0x00, 0xa0, 0x91, 0x15, 0x11, 0xe0,
+  0x83, 0xf3, 0xfd, 0x78, 0xce, 0x0e, 0xae, 0xce, 0xce, 0x36, 0x8e, 0xb6, 0x0e, 0x5f, 0x2d, 0xea,
+  0xbf, 0x06, 0xff, 0x22, 0x62, 0x62, 0xe3, 0xfe, 0xe5, 0xcf, 0xab, 0x70, 0x40, 0x00, 0x00, 0xe1,
+  0x74, 0x7e, 0xd1, 0xfe, 0x2c, 0x2f, 0xb3, 0x1a, 0x80, 0x3b, 0x06, 0x80, 0x6d, 0xfe, 0xa2, 0x25,
+  0xee, 0x04, 0x68, 0x5e, 0x0b, 0xa0, 0x75, 0xf7, 0x8b, 0x66, 0xb2, 0x0f, 0x40, 0xb5, 0x00, 0xa0,
+  0xe9, 0xda, 0x57, 0xf3, 0x70, 0xf8, 0x7e, 0x3c, 0x3c, 0x45, 0xa1, 0x90, 0xb9, 0xd9, 0xd9, 0xe5,
+  0xe4, 0xe4, 0xd8, 0x4a, 0xc4, 0x42, 0x5b, 0x61, 0xca, 0x57, 0x7d, 0xfe, 0x67, 0xc2, 0x5f, 0xc0,
+  0x57, 0xfd, 0x6c, 0xf9, 0x7e, 0x3c, 0xfc, 0xf7, 0xf5, 0xe0, 0xbe, 0xe2, 0x24, 0x81, 0x32, 0x5d,
+  0x81, 0x47, 0x04, 0xf8, 0xe0, 0xc2, 0xcc, 0xf4, 0x4c, 0xa5, 0x1c, 0xcf, 0x92, 0x09, 0x84, 0x62,
+  0xdc, 0xe6, 0x8f, 0x47, 0xfc, 0xb7, 0x0b, 0xff, 0xfc, 0x1d, 0xd3, 0x22, 0xc4, 0x49, 0x62, 0xb9,
+  0x58, 0x2a, 0x14, 0xe3, 0x51, 0x12, 0x71, 0x8e, 0x44, 0x9a, 0x8c, 0xf3, 0x32, 0xa5, 0x22, 0x89,
+  0x42, 0x92, 0x29, 0xc5, 0x25, 0xd2, 0xff, 0x64, 0xe2, 0xdf, 0x2c, 0xfb, 0x03, 0x3e, 0xdf, 0x35,
+  0x00, 0xb0, 0x6a, 0x3e, 0x01, 0x7b, 0x91, 0x2d, 0xa8, 0x5d, 0x63, 0x03, 0xf6, 0x4b, 0x27, 0x10,
+  0x58, 0x74, 0xc0, 0xe2, 0xf7, 0x00, 0x00, 0xf2, 0xbb, 0x6f, 0xc1, 0xd4, 0x28, 0x08, 0x03, 0x80,
+  0x68, 0x83, 0xe1, 0xcf, 0x77, 0xff, 0xef, 0x3f, 0xfd, 0x47, 0xa0, 0x25, 0x00, 0x80, 0x66, 0x49,
+  0x92, 0x71, 0x00, 0x00, 0x5e, 0x44, 0x24, 0x2e, 0x54, 0xca, 0xb3, 0x3f, 0xc7, 0x08, 0x00, 0x00,
+  0x44, 0xa0, 0x81, 0x2a, 0xb0, 0x41, 0x1b, 0xf4, 0xc1, 0x18, 0x2c, 0xc0, 0x06, 0x1c, 0xc1, 0x05,
+  0xdc, 0xc1, 0x0b, 0xfc, 0x60, 0x36, 0x84, 0x42, 0x24, 0xc4, 0xc2, 0x42, 0x10, 0x42, 0x0a, 0x64,
+  0x80, 0x1c, 0x72, 0x60, 0x29, 0xac, 0x82, 0x42, 0x28, 0x86, 0xcd, 0xb0, 0x1d, 0x2a, 0x60, 0x2f,
+  0xd4, 0x40, 0x1d, 0x34, 0xc0, 0x51, 0x68, 0x86, 0x93, 0x70, 0x0e, 0x2e, 0xc2, 0x55, 0xb8, 0x0e,
+  0x3d, 0x70, 0x0f, 0xfa, 0x61, 0x08, 0x9e, 0xc1, 0x28, 0xbc, 0x81, 0x09, 0x04, 0x41, 0xc8, 0x08,
+  0x13, 0x61, 0x21, 0xda, 0x88, 0x01, 0x62, 0x8a, 0x58, 0x23, 0x8e, 0x08, 0x17, 0x99, 0x85, 0xf8,
+  0x21, 0xc1, 0x48, 0x04, 0x12, 0x8b, 0x24, 0x20, 0xc9, 0x88, 0x14, 0x51, 0x22, 0x4b, 0x91, 0x35,
+  0x48, 0x31, 0x52, 0x8a, 0x54, 0x20, 0x55, 0x48, 0x1d, 0xf2, 0x3d, 0x72, 0x02, 0x39, 0x87, 0x5c,
+  0x46, 0xba, 0x91, 0x3b, 0xc8, 0x00, 0x32, 0x82, 0xfc, 0x86, 0xbc, 0x47, 0x31, 0x94, 0x81, 0xb2,
+  0x51, 0x3d, 0xd4, 0x0c, 0xb5, 0x43, 0xb9, 0xa8, 0x37, 0x1a, 0x84, 0x46, 0xa2, 0x0b, 0xd0, 0x64,
+  0x74, 0x31, 0x9a, 0x8f, 0x16, 0xa0, 0x9b, 0xd0, 0x72, 0xb4, 0x1a, 0x3d, 0x8c, 0x36, 0xa1, 0xe7,
+  0xd0, 0xab, 0x68, 0x0f, 0xda, 0x8f, 0x3e, 0x43, 0xc7, 0x30, 0xc0, 0xe8, 0x18, 0x07, 0x33, 0xc4,
+  0x6c, 0x30, 0x2e, 0xc6, 0xc3, 0x42, 0xb1, 0x38, 0x2c, 0x09, 0x93, 0x63, 0xcb, 0xb1, 0x22, 0xac,
+  0x0c, 0xab, 0xc6, 0x1a, 0xb0, 0x56, 0xac, 0x03, 0xbb, 0x89, 0xf5, 0x63, 0xcf, 0xb1, 0x77, 0x04,
+  0x12, 0x81, 0x45, 0xc0, 0x09, 0x36, 0x04, 0x77, 0x42, 0x20, 0x61, 0x1e, 0x41, 0x48, 0x58, 0x4c,
+  0x58, 0x4e, 0xd8, 0x48, 0xa8, 0x20, 0x1c, 0x24, 0x34, 0x11, 0xda, 0x09, 0x37, 0x09, 0x03, 0x84,
+  0x51, 0xc2, 0x27, 0x22, 0x93, 0xa8, 0x4b, 0xb4, 0x26, 0xba, 0x11, 0xf9, 0xc4, 0x18, 0x62, 0x32,
+  0x31, 0x87, 0x58, 0x48, 0x2c, 0x23, 0xd6, 0x12, 0x8f, 0x13, 0x2f, 0x10, 0x7b, 0x88, 0x43, 0xc4,
+  0x37, 0x24, 0x12, 0x89, 0x43, 0x32, 0x27, 0xb9, 0x90, 0x02, 0x49, 0xb1, 0xa4, 0x54, 0xd2, 0x12,
+  0xd2, 0x46, 0xd2, 0x6e, 0x52, 0x23, 0xe9, 0x2c, 0xa9, 0x9b, 0x34, 0x48, 0x1a, 0x23, 0x93, 0xc9,
+  0xda, 0x64, 0x6b, 0xb2, 0x07, 0x39, 0x94, 0x2c, 0x20, 0x2b, 0xc8, 0x85, 0xe4, 0x9d, 0xe4, 0xc3,
+  0xe4, 0x33, 0xe4, 0x1b, 0xe4, 0x21, 0xf2, 0x5b, 0x0a, 0x9d, 0x62, 0x40, 0x71, 0xa4, 0xf8, 0x53,
+  0xe2, 0x28, 0x52, 0xca, 0x6a, 0x4a, 0x19, 0xe5, 0x10, 0xe5, 0x34, 0xe5, 0x06, 0x65, 0x98, 0x32,
+  0x41, 0x55, 0xa3, 0x9a, 0x52, 0xdd, 0xa8, 0xa1, 0x54, 0x11, 0x35, 0x8f, 0x5a, 0x42, 0xad, 0xa1,
+  0xb6, 0x52, 0xaf, 0x51, 0x87, 0xa8, 0x13, 0x34, 0x75, 0x9a, 0x39, 0xcd, 0x83, 0x16, 0x49, 0x4b,
+  0xa5, 0xad, 0xa2, 0x95, 0xd3, 0x1a, 0x68, 0x17, 0x68, 0xf7, 0x69, 0xaf, 0xe8, 0x74, 0xba, 0x11,
+  0xdd, 0x95, 0x1e, 0x4e, 0x97, 0xd0, 0x57, 0xd2, 0xcb, 0xe9, 0x47, 0xe8, 0x97, 0xe8, 0x03, 0xf4,
+  0x77, 0x0c, 0x0d, 0x86, 0x15, 0x83, 0xc7, 0x88, 0x67, 0x28, 0x19, 0x9b, 0x18, 0x07, 0x18, 0x67,
+  0x19, 0x77, 0x18, 0xaf, 0x98, 0x4c, 0xa6, 0x19, 0xd3, 0x8b, 0x19, 0xc7, 0x54, 0x30, 0x37, 0x31,
+  0xeb, 0x98, 0xe7, 0x99, 0x0f, 0x99, 0x6f, 0x55, 0x58, 0x2a, 0xb6, 0x2a, 0x7c, 0x15, 0x91, 0xca,
+  0x0a, 0x95, 0x4a, 0x95, 0x26, 0x95, 0x1b, 0x2a, 0x2f, 0x54, 0xa9, 0xaa, 0xa6, 0xaa, 0xde, 0xaa,
+  0x0b, 0x55, 0xf3, 0x55, 0xcb, 0x54, 0x8f, 0xa9, 0x5e, 0x53, 0x7d, 0xae, 0x46, 0x55, 0x33, 0x53,
+  0xe3, 0xa9, 0x09, 0xd4, 0x96, 0xab, 0x55, 0xaa, 0x9d, 0x50, 0xeb, 0x53, 0x1b, 0x53, 0x67, 0xa9,
+  0x3b, 0xa8, 0x87, 0xaa, 0x67, 0xa8, 0x6f, 0x54, 0x3f, 0xa4, 0x7e, 0x59, 0xfd, 0x89, 0x06, 0x59,
+  0xc3, 0x4c, 0xc3, 0x4f, 0x43, 0xa4, 0x51, 0xa0, 0xb1, 0x5f, 0xe3, 0xbc, 0xc6, 0x20, 0x0b, 0x63,
+  0x19, 0xb3, 0x78, 0x2c, 0x21, 0x6b, 0x0d, 0xab, 0x86, 0x75, 0x81, 0x35, 0xc4, 0x26, 0xb1, 0xcd,
+  0xd9, 0x7c, 0x76, 0x2a, 0xbb, 0x98, 0xfd, 0x1d, 0xbb, 0x8b, 0x3d, 0xaa, 0xa9, 0xa1, 0x39, 0x43,
+  0x33, 0x4a, 0x33, 0x57, 0xb3, 0x52, 0xf3, 0x94, 0x66, 0x3f, 0x07, 0xe3, 0x98, 0x71, 0xf8, 0x9c,
+  0x74, 0x4e, 0x09, 0xe7, 0x28, 0xa7, 0x97, 0xf3, 0x7e, 0x8a, 0xde, 0x14, 0xef, 0x29, 0xe2, 0x29,
+  0x1b, 0xa6, 0x34, 0x4c, 0xb9, 0x31, 0x65, 0x5c, 0x6b, 0xaa, 0x96, 0x97, 0x96, 0x58, 0xab, 0x48,
+  0xab, 0x51, 0xab, 0x47, 0xeb, 0xbd, 0x36, 0xae, 0xed, 0xa7, 0x9d, 0xa6, 0xbd, 0x45, 0xbb, 0x59,
+  0xfb, 0x81, 0x0e, 0x41, 0xc7, 0x4a, 0x27, 0x5c, 0x27, 0x47, 0x67, 0x8f, 0xce, 0x05, 0x9d, 0xe7,
+  0x53, 0xd9, 0x53, 0xdd, 0xa7, 0x0a, 0xa7, 0x16, 0x4d, 0x3d, 0x3a, 0xf5, 0xae, 0x2e, 0xaa, 0x6b,
+  0xa5, 0x1b, 0xa1, 0xbb, 0x44, 0x77, 0xbf, 0x6e, 0xa7, 0xee, 0x98, 0x9e, 0xbe, 0x5e, 0x80, 0x9e,
+  0x4c, 0x6f, 0xa7, 0xde, 0x79, 0xbd, 0xe7, 0xfa, 0x1c, 0x7d, 0x2f, 0xfd, 0x54, 0xfd, 0x6d, 0xfa,
+  0xa7, 0xf5, 0x47, 0x0c, 0x58, 0x06, 0xb3, 0x0c, 0x24, 0x06, 0xdb, 0x0c, 0xce, 0x18, 0x3c, 0xc5,
+  0x35, 0x71, 0x6f, 0x3c, 0x1d, 0x2f, 0xc7, 0xdb, 0xf1, 0x51, 0x43, 0x5d, 0xc3, 0x40, 0x43, 0xa5,
+  0x61, 0x95, 0x61, 0x97, 0xe1, 0x84, 0x91, 0xb9, 0xd1, 0x3c, 0xa3, 0xd5, 0x46, 0x8d, 0x46, 0x0f,
+  0x8c, 0x69, 0xc6, 0x5c, 0xe3, 0x24, 0xe3, 0x6d, 0xc6, 0x6d, 0xc6, 0xa3, 0x26, 0x06, 0x26, 0x21,
+  0x26, 0x4b, 0x4d, 0xea, 0x4d, 0xee, 0x9a, 0x52, 0x4d, 0xb9, 0xa6, 0x29, 0xa6, 0x3b, 0x4c, 0x3b,
+  0x4c, 0xc7, 0xcd, 0xcc, 0xcd, 0xa2, 0xcd, 0xd6, 0x99, 0x35, 0x9b, 0x3d, 0x31, 0xd7, 0x32, 0xe7,
+  0x9b, 0xe7, 0x9b, 0xd7, 0x9b, 0xdf, 0xb7, 0x60, 0x5a, 0x78, 0x5a, 0x2c, 0xb6, 0xa8, 0xb6, 0xb8,
+  0x65, 0x49, 0xb2, 0xe4, 0x5a, 0xa6, 0x59, 0xee, 0xb6, 0xbc, 0x6e, 0x85, 0x5a, 0x39, 0x59, 0xa5,
+  0x58, 0x55, 0x5a, 0x5d, 0xb3, 0x46, 0xad, 0x9d, 0xad, 0x25, 0xd6, 0xbb, 0xad, 0xbb, 0xa7, 0x11,
+  0xa7, 0xb9, 0x4e, 0x93, 0x4e, 0xab, 0x9e, 0xd6, 0x67, 0xc3, 0xb0, 0xf1, 0xb6, 0xc9, 0xb6, 0xa9,
+  0xb7, 0x19, 0xb0, 0xe5, 0xd8, 0x06, 0xdb, 0xae, 0xb6, 0x6d, 0xb6, 0x7d, 0x61, 0x67, 0x62, 0x17,
+  0x67, 0xb7, 0xc5, 0xae, 0xc3, 0xee, 0x93, 0xbd, 0x93, 0x7d, 0xba, 0x7d, 0x8d, 0xfd, 0x3d, 0x07,
+  0x0d, 0x87, 0xd9, 0x0e, 0xab, 0x1d, 0x5a, 0x1d, 0x7e, 0x73, 0xb4, 0x72, 0x14, 0x3a, 0x56, 0x3a,
+  0xde, 0x9a, 0xce, 0x9c, 0xee, 0x3f, 0x7d, 0xc5, 0xf4, 0x96, 0xe9, 0x2f, 0x67, 0x58, 0xcf, 0x10,
+  0xcf, 0xd8, 0x33, 0xe3, 0xb6, 0x13, 0xcb, 0x29, 0xc4, 0x69, 0x9d, 0x53, 0x9b, 0xd3, 0x47, 0x67,
+  0x17, 0x67, 0xb9, 0x73, 0x83, 0xf3, 0x88, 0x8b, 0x89, 0x4b, 0x82, 0xcb, 0x2e, 0x97, 0x3e, 0x2e,
+  0x9b, 0x1b, 0xc6, 0xdd, 0xc8, 0xbd, 0xe4, 0x4a, 0x74, 0xf5, 0x71, 0x5d, 0xe1, 0x7a, 0xd2, 0xf5,
+  0x9d, 0x9b, 0xb3, 0x9b, 0xc2, 0xed, 0xa8, 0xdb, 0xaf, 0xee, 0x36, 0xee, 0x69, 0xee, 0x87, 0xdc,
+  0x9f, 0xcc, 0x34, 0x9f, 0x29, 0x9e, 0x59, 0x33, 0x73, 0xd0, 0xc3, 0xc8, 0x43, 0xe0, 0x51, 0xe5,
+  0xd1, 0x3f, 0x0b, 0x9f, 0x95, 0x30, 0x6b, 0xdf, 0xac, 0x7e, 0x4f, 0x43, 0x4f, 0x81, 0x67, 0xb5,
+  0xe7, 0x23, 0x2f, 0x63, 0x2f, 0x91, 0x57, 0xad, 0xd7, 0xb0, 0xb7, 0xa5, 0x77, 0xaa, 0xf7, 0x61,
+  0xef, 0x17, 0x3e, 0xf6, 0x3e, 0x72, 0x9f, 0xe3, 0x3e, 0xe3, 0x3c, 0x37, 0xde, 0x32, 0xde, 0x59,
+  0x5f, 0xcc, 0x37, 0xc0, 0xb7, 0xc8, 0xb7, 0xcb, 0x4f, 0xc3, 0x6f, 0x9e, 0x5f, 0x85, 0xdf, 0x43,
+  0x7f, 0x23, 0xff, 0x64, 0xff, 0x7a, 0xff, 0xd1, 0x00, 0xa7, 0x80, 0x25, 0x01, 0x67, 0x03, 0x89,
+  0x81, 0x41, 0x81, 0x5b, 0x02, 0xfb, 0xf8, 0x7a, 0x7c, 0x21, 0xbf, 0x8e, 0x3f, 0x3a, 0xdb, 0x65,
+  0xf6, 0xb2, 0xd9, 0xed, 0x41, 0x8c, 0xa0, 0xb9, 0x41, 0x15, 0x41, 0x8f, 0x82, 0xad, 0x82, 0xe5,
+  0xc1, 0xad, 0x21, 0x68, 0xc8, 0xec, 0x90, 0xad, 0x21, 0xf7, 0xe7, 0x98, 0xce, 0x91, 0xce, 0x69,
+  0x0e, 0x85, 0x50, 0x7e, 0xe8, 0xd6, 0xd0, 0x07, 0x61, 0xe6, 0x61, 0x8b, 0xc3, 0x7e, 0x0c, 0x27,
+  0x85, 0x87, 0x85, 0x57, 0x86, 0x3f, 0x8e, 0x70, 0x88, 0x58, 0x1a, 0xd1, 0x31, 0x97, 0x35, 0x77,
+  0xd1, 0xdc, 0x43, 0x73, 0xdf, 0x44, 0xfa, 0x44, 0x96, 0x44, 0xde, 0x9b, 0x67, 0x31, 0x4f, 0x39,
+  0xaf, 0x2d, 0x4a, 0x35, 0x2a, 0x3e, 0xaa, 0x2e, 0x6a, 0x3c, 0xda, 0x37, 0xba, 0x34, 0xba, 0x3f,
+  0xc6, 0x2e, 0x66, 0x59, 0xcc, 0xd5, 0x58, 0x9d, 0x58, 0x49, 0x6c, 0x4b, 0x1c, 0x39, 0x2e, 0x2a,
+  0xae, 0x36, 0x6e, 0x6c, 0xbe, 0xdf, 0xfc, 0xed, 0xf3, 0x87, 0xe2, 0x9d, 0xe2, 0x0b, 0xe3, 0x7b,
+  0x17, 0x98, 0x2f, 0xc8, 0x5d, 0x70, 0x79, 0xa1, 0xce, 0xc2, 0xf4, 0x85, 0xa7, 0x16, 0xa9, 0x2e,
+  0x12, 0x2c, 0x3a, 0x96, 0x40, 0x4c, 0x88, 0x4e, 0x38, 0x94, 0xf0, 0x41, 0x10, 0x2a, 0xa8, 0x16,
+  0x8c, 0x25, 0xf2, 0x13, 0x77, 0x25, 0x8e, 0x0a, 0x79, 0xc2, 0x1d, 0xc2, 0x67, 0x22, 0x2f, 0xd1,
+  0x36, 0xd1, 0x88, 0xd8, 0x43, 0x5c, 0x2a, 0x1e, 0x4e, 0xf2, 0x48, 0x2a, 0x4d, 0x7a, 0x92, 0xec,
+  0x91, 0xbc, 0x35, 0x79, 0x24, 0xc5, 0x33, 0xa5, 0x2c, 0xe5, 0xb9, 0x84, 0x27, 0xa9, 0x90, 0xbc,
+  0x4c, 0x0d, 0x4c, 0xdd, 0x9b, 0x3a, 0x9e, 0x16, 0x9a, 0x76, 0x20, 0x6d, 0x32, 0x3d, 0x3a, 0xbd,
+  0x31, 0x83, 0x92, 0x91, 0x90, 0x71, 0x42, 0xaa, 0x21, 0x4d, 0x93, 0xb6, 0x67, 0xea, 0x67, 0xe6,
+  0x66, 0x76, 0xcb, 0xac, 0x65, 0x85, 0xb2, 0xfe, 0xc5, 0x6e, 0x8b, 0xb7, 0x2f, 0x1e, 0x95, 0x07,
+  0xc9, 0x6b, 0xb3, 0x90, 0xac, 0x05, 0x59, 0x2d, 0x0a, 0xb6, 0x42, 0xa6, 0xe8, 0x54, 0x5a, 0x28,
+  0xd7, 0x2a, 0x07, 0xb2, 0x67, 0x65, 0x57, 0x66, 0xbf, 0xcd, 0x89, 0xca, 0x39, 0x96, 0xab, 0x9e,
+  0x2b, 0xcd, 0xed, 0xcc, 0xb3, 0xca, 0xdb, 0x90, 0x37, 0x9c, 0xef, 0x9f, 0xff, 0xed, 0x12, 0xc2,
+  0x12, 0xe1, 0x92, 0xb6, 0xa5, 0x86, 0x4b, 0x57, 0x2d, 0x1d, 0x58, 0xe6, 0xbd, 0xac, 0x6a, 0x39,
+  0xb2, 0x3c, 0x71, 0x79, 0xdb, 0x0a, 0xe3, 0x15, 0x05, 0x2b, 0x86, 0x56, 0x06, 0xac, 0x3c, 0xb8,
+  0x8a, 0xb6, 0x2a, 0x6d, 0xd5, 0x4f, 0xab, 0xed, 0x57, 0x97, 0xae, 0x7e, 0xbd, 0x26, 0x7a, 0x4d,
+  0x6b, 0x81, 0x5e, 0xc1, 0xca, 0x82, 0xc1, 0xb5, 0x01, 0x6b, 0xeb, 0x0b, 0x55, 0x0a, 0xe5, 0x85,
+  0x7d, 0xeb, 0xdc, 0xd7, 0xed, 0x5d, 0x4f, 0x58, 0x2f, 0x59, 0xdf, 0xb5, 0x61, 0xfa, 0x86, 0x9d,
+  0x1b, 0x3e, 0x15, 0x89, 0x8a, 0xae, 0x14, 0xdb, 0x17, 0x97, 0x15, 0x7f, 0xd8, 0x28, 0xdc, 0x78,
+  0xe5, 0x1b, 0x87, 0x6f, 0xca, 0xbf, 0x99, 0xdc, 0x94, 0xb4, 0xa9, 0xab, 0xc4, 0xb9, 0x64, 0xcf,
+  0x66, 0xd2, 0x66, 0xe9, 0xe6, 0xde, 0x2d, 0x9e, 0x5b, 0x0e, 0x96, 0xaa, 0x97, 0xe6, 0x97, 0x0e,
+  0x6e, 0x0d, 0xd9, 0xda, 0xb4, 0x0d, 0xdf, 0x56, 0xb4, 0xed, 0xf5, 0xf6, 0x45, 0xdb, 0x2f, 0x97,
+  0xcd, 0x28, 0xdb, 0xbb, 0x83, 0xb6, 0x43, 0xb9, 0xa3, 0xbf, 0x3c, 0xb8, 0xbc, 0x65, 0xa7, 0xc9,
+  0xce, 0xcd, 0x3b, 0x3f, 0x54, 0xa4, 0x54, 0xf4, 0x54, 0xfa, 0x54, 0x36, 0xee, 0xd2, 0xdd, 0xb5,
+  0x61, 0xd7, 0xf8, 0x6e, 0xd1, 0xee, 0x1b, 0x7b, 0xbc, 0xf6, 0x34, 0xec, 0xd5, 0xdb, 0x5b, 0xbc,
+  0xf7, 0xfd, 0x3e, 0xc9, 0xbe, 0xdb, 0x55, 0x01, 0x55, 0x4d, 0xd5, 0x66, 0xd5, 0x65, 0xfb, 0x49,
+  0xfb, 0xb3, 0xf7, 0x3f, 0xae, 0x89, 0xaa, 0xe9, 0xf8, 0x96, 0xfb, 0x6d, 0x5d, 0xad, 0x4e, 0x6d,
+  0x71, 0xed, 0xc7, 0x03, 0xd2, 0x03, 0xfd, 0x07, 0x23, 0x0e, 0xb6, 0xd7, 0xb9, 0xd4, 0xd5, 0x1d,
+  0xd2, 0x3d, 0x54, 0x52, 0x8f, 0xd6, 0x2b, 0xeb, 0x47, 0x0e, 0xc7, 0x1f, 0xbe, 0xfe, 0x9d, 0xef,
+  0x77, 0x2d, 0x0d, 0x36, 0x0d, 0x55, 0x8d, 0x9c, 0xc6, 0xe2, 0x23, 0x70, 0x44, 0x79, 0xe4, 0xe9,
+  0xf7, 0x09, 0xdf, 0xf7, 0x1e, 0x0d, 0x3a, 0xda, 0x76, 0x8c, 0x7b, 0xac, 0xe1, 0x07, 0xd3, 0x1f,
+  0x76, 0x1d, 0x67, 0x1d, 0x2f, 0x6a, 0x42, 0x9a, 0xf2, 0x9a, 0x46, 0x9b, 0x53, 0x9a, 0xfb, 0x5b,
+  0x62, 0x5b, 0xba, 0x4f, 0xcc, 0x3e, 0xd1, 0xd6, 0xea, 0xde, 0x7a, 0xfc, 0x47, 0xdb, 0x1f, 0x0f,
+  0x9c, 0x34, 0x3c, 0x59, 0x79, 0x4a, 0xf3, 0x54, 0xc9, 0x69, 0xda, 0xe9, 0x82, 0xd3, 0x93, 0x67,
+  0xf2, 0xcf, 0x8c, 0x9d, 0x95, 0x9d, 0x7d, 0x7e, 0x2e, 0xf9, 0xdc, 0x60, 0xdb, 0xa2, 0xb6, 0x7b,
+  0xe7, 0x63, 0xce, 0xdf, 0x6a, 0x0f, 0x6f, 0xef, 0xba, 0x10, 0x74, 0xe1, 0xd2, 0x45, 0xff, 0x8b,
+  0xe7, 0x3b, 0xbc, 0x3b, 0xce, 0x5c, 0xf2, 0xb8, 0x74, 0xf2, 0xb2, 0xdb, 0xe5, 0x13, 0x57, 0xb8,
+  0x57, 0x9a, 0xaf, 0x3a, 0x5f, 0x6d, 0xea, 0x74, 0xea, 0x3c, 0xfe, 0x93, 0xd3, 0x4f, 0xc7, 0xbb,
+  0x9c, 0xbb, 0x9a, 0xae, 0xb9, 0x5c, 0x6b, 0xb9, 0xee, 0x7a, 0xbd, 0xb5, 0x7b, 0x66, 0xf7, 0xe9,
+  0x1b, 0x9e, 0x37, 0xce, 0xdd, 0xf4, 0xbd, 0x79, 0xf1, 0x16, 0xff, 0xd6, 0xd5, 0x9e, 0x39, 0x3d,
+  0xdd, 0xbd, 0xf3, 0x7a, 0x6f, 0xf7, 0xc5, 0xf7, 0xf5, 0xdf, 0x16, 0xdd, 0x7e, 0x72, 0x27, 0xfd,
+  0xce, 0xcb, 0xbb, 0xd9, 0x77, 0x27, 0xee, 0xad, 0xbc, 0x4f, 0xbc, 0x5f, 0xf4, 0x40, 0xed, 0x41,
+  0xd9, 0x43, 0xdd, 0x87, 0xd5, 0x3f, 0x5b, 0xfe, 0xdc, 0xd8, 0xef, 0xdc, 0x7f, 0x6a, 0xc0, 0x77,
+  0xa0, 0xf3, 0xd1, 0xdc, 0x47, 0xf7, 0x06, 0x85, 0x83, 0xcf, 0xfe, 0x91, 0xf5, 0x8f, 0x0f, 0x43,
+  0x05, 0x8f, 0x99, 0x8f, 0xcb, 0x86, 0x0d, 0x86, 0xeb, 0x9e, 0x38, 0x3e, 0x39, 0x39, 0xe2, 0x3f,
+  0x72, 0xfd, 0xe9, 0xfc, 0xa7, 0x43, 0xcf, 0x64, 0xcf, 0x26, 0x9e, 0x17, 0xfe, 0xa2, 0xfe, 0xcb,
+  0xae, 0x17, 0x16, 0x2f, 0x7e, 0xf8, 0xd5, 0xeb, 0xd7, 0xce, 0xd1, 0x98, 0xd1, 0xa1, 0x97, 0xf2,
+  0x97, 0x93, 0xbf, 0x6d, 0x7c, 0xa5, 0xfd, 0xea, 0xc0, 0xeb, 0x19, 0xaf, 0xdb, 0xc6, 0xc2, 0xc6,
+  0x1e, 0xbe, 0xc9, 0x78, 0x33, 0x31, 0x5e, 0xf4, 0x56, 0xfb, 0xed, 0xc1, 0x77, 0xdc, 0x77, 0x1d,
+  0xef, 0xa3, 0xdf, 0x0f, 0x4f, 0xe4, 0x7c, 0x20, 0x7f, 0x28, 0xff, 0x68, 0xf9, 0xb1, 0xf5, 0x53,
+  0xd0, 0xa7, 0xfb, 0x93, 0x19, 0x93, 0x93, 0xff, 0x04, 0x03, 0x98, 0xf3, 0xfc, 0x63, 0x33, 0x2d,
+  0xdb, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x80,
+  0x83, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x80, 0xe9, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea,
+  0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17, 0x6f, 0x92, 0x5f, 0xc5, 0x46, 0x00, 0x00, 0x1b,
+  0xd1, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xec, 0x5d, 0x7b, 0x58, 0x53, 0x57, 0xb6, 0xdf, 0x09,
+  0x21, 0x09, 0x79, 0x40, 0x80, 0xf0, 0x90, 0x87, 0x41, 0x1e, 0x02, 0x22, 0x08, 0x82, 0x44, 0xf0,
+  0x01, 0x6d, 0x11, 0x14, 0xb5, 0xb5, 0xb6, 0x8e, 0x8e, 0xb5, 0xd6, 0x5b, 0xeb, 0x74, 0x46, 0xdb,
+  0x4e, 0xef, 0xd4, 0xb6, 0xfa, 0xe9, 0x58, 0x45, 0xfb, 0xd0, 0xf9, 0xbc, 0x3a, 0x6d, 0xad, 0xa3,
+  0xed, 0xd7, 0xde, 0xd6, 0x76, 0xf4, 0x6a, 0xa5, 0xda, 0x3a, 0xa5, 0xbe, 0x2a, 0x56, 0x51, 0x1e,
+  0xe1, 0x21, 0x08, 0x28, 0x18, 0x10, 0x0c, 0x90, 0x07, 0x90, 0x10, 0x42, 0x48, 0x48, 0x48, 0xee,
+  0x1f, 0x67, 0x9a, 0x32, 0x90, 0xb3, 0x73, 0x72, 0x1e, 0x8a, 0xed, 0xf9, 0xfd, 0xa1, 0x24, 0x7b,
+  0x9f, 0x7d, 0x76, 0xce, 0xd9, 0xbf, 0xbd, 0xd7, 0x5a, 0x7b, 0xad, 0xb5, 0x19, 0x76, 0xbb, 0x1d,
+  0xfc, 0x36, 0x60, 0xb6, 0x1a, 0x7a, 0x8d, 0x6d, 0x6d, 0xba, 0xca, 0x6e, 0x43, 0xab, 0xde, 0xac,
+  0x36, 0x0e, 0xe9, 0x4c, 0x56, 0x83, 0xd9, 0x3a, 0x68, 0xff, 0xf7, 0x23, 0x60, 0xb2, 0x3d, 0x78,
+  0x1c, 0x96, 0x80, 0xc7, 0x16, 0x79, 0x73, 0x82, 0x02, 0x05, 0x91, 0x12, 0xdf, 0xe4, 0x00, 0xc1,
+  0x24, 0xb6, 0x87, 0x17, 0xa0, 0xf1, 0x5b, 0x05, 0xe3, 0x57, 0x4f, 0x0f, 0x85, 0xae, 0xaa, 0xbd,
+  0xaf, 0x4a, 0xa1, 0xab, 0x51, 0x19, 0x9a, 0x4c, 0x16, 0x03, 0x00, 0xc0, 0x6e, 0x07, 0xf6, 0x5f,
+  0xfe, 0x65, 0x00, 0x30, 0xf2, 0x23, 0x18, 0x59, 0x81, 0xeb, 0xe9, 0x1d, 0x2c, 0x8c, 0x99, 0x28,
+  0x4a, 0x9c, 0xe4, 0x37, 0x3d, 0xd2, 0x3f, 0x95, 0x1e, 0x2e, 0x34, 0x3d, 0x7e, 0x25, 0xe8, 0x37,
+  0x2b, 0x6f, 0x6b, 0x2e, 0xdc, 0x52, 0x9d, 0xd5, 0x0c, 0xc8, 0xd1, 0x46, 0xbf, 0x4b, 0x7a, 0xd8,
+  0x01, 0xb0, 0x03, 0x00, 0xec, 0xc0, 0x0e, 0x40, 0x00, 0x3f, 0x22, 0x39, 0x74, 0xfe, 0x94, 0xa0,
+  0xac, 0x00, 0xfe, 0x44, 0x7a, 0xdc, 0xd0, 0xf4, 0x78, 0x58, 0xd1, 0x6b, 0x6c, 0xad, 0xee, 0x38,
+  0x56, 0xaf, 0xfc, 0x97, 0x0d, 0xd8, 0xc0, 0xcf, 0x43, 0x9c, 0x38, 0x3d, 0x1c, 0x5f, 0x4e, 0x0d,
+  0x7e, 0x64, 0x6e, 0xe4, 0xca, 0x70, 0xd1, 0x14, 0x7a, 0xf4, 0xd0, 0xf4, 0x78, 0xc8, 0x56, 0x8c,
+  0x6b, 0x77, 0x3f, 0x6a, 0xd2, 0x5c, 0x70, 0x8c, 0x66, 0x2a, 0xe8, 0x81, 0x7c, 0x13, 0x13, 0x90,
+  0x9e, 0x3b, 0x79, 0x1d, 0x4d, 0x12, 0x9a, 0x1e, 0x0f, 0x05, 0xec, 0xd7, 0xdb, 0x0e, 0xd6, 0x74,
+  0x1c, 0x1d, 0xb6, 0x0f, 0x8f, 0x1a, 0xc7, 0x14, 0xd1, 0x03, 0x29, 0x4a, 0x09, 0xc9, 0x5d, 0x9c,
+  0xf0, 0x67, 0x01, 0x5b, 0x44, 0x8f, 0x24, 0x9a, 0x1e, 0xe3, 0x14, 0xed, 0xda, 0xeb, 0x25, 0x77,
+  0x3f, 0xe8, 0x1d, 0xbc, 0x0b, 0x19, 0xc7, 0x14, 0xd1, 0xc3, 0x6e, 0x07, 0x5e, 0x9e, 0xde, 0xf3,
+  0xe3, 0x5e, 0xcc, 0x94, 0x2c, 0xa1, 0x07, 0x13, 0x4d, 0x8f, 0x71, 0x87, 0xf2, 0xf6, 0x43, 0x95,
+  0x8a, 0xcf, 0x5d, 0x8e, 0x63, 0x4f, 0x26, 0x4f, 0xe4, 0x15, 0x2e, 0xe4, 0x04, 0x0b, 0x39, 0x01,
+  0x3c, 0xb6, 0x1f, 0xcf, 0xd3, 0x8f, 0xeb, 0xe9, 0xcd, 0xf6, 0xe0, 0x79, 0x30, 0xd9, 0xc0, 0x6e,
+  0xb7, 0x03, 0xfb, 0xa0, 0x45, 0x6f, 0xb4, 0xf4, 0xe9, 0x4d, 0x9a, 0x3e, 0x93, 0x52, 0x37, 0xa8,
+  0xec, 0x19, 0x50, 0xf4, 0x99, 0x34, 0x58, 0xe8, 0xf1, 0xb3, 0x42, 0x92, 0xf5, 0x74, 0xd2, 0x46,
+  0x21, 0xc7, 0x8f, 0x1e, 0x52, 0x34, 0x3d, 0xc6, 0x05, 0x06, 0x86, 0x34, 0xe7, 0x9a, 0xb6, 0xa8,
+  0xfa, 0x6f, 0xa2, 0x4d, 0xf3, 0x0c, 0x06, 0x6b, 0x82, 0x30, 0x21, 0xc4, 0x27, 0x39, 0xd2, 0x6f,
+  0x96, 0x3f, 0x3f, 0x92, 0xed, 0xc1, 0x73, 0xda, 0x8e, 0xcd, 0x6e, 0x35, 0x59, 0x07, 0x6c, 0x76,
+  0xab, 0x75, 0x78, 0xc8, 0x62, 0x33, 0x9b, 0xad, 0x86, 0x41, 0x4b, 0xbf, 0xde, 0xa4, 0x51, 0x1b,
+  0x5a, 0xba, 0xfa, 0xef, 0x74, 0x0f, 0xdc, 0x1b, 0x30, 0xf7, 0x0e, 0xdb, 0x6d, 0x70, 0x7a, 0xd8,
+  0x01, 0xf0, 0x62, 0x09, 0x9f, 0x4f, 0x7f, 0x37, 0xca, 0x3f, 0x85, 0x1e, 0x55, 0x34, 0x3d, 0x1e,
+  0x30, 0xee, 0xe9, 0xae, 0x5f, 0x6c, 0x7e, 0xcb, 0x64, 0x1d, 0xb1, 0x8f, 0x31, 0x82, 0x1e, 0x11,
+  0x7e, 0xb3, 0xa2, 0xfc, 0xb3, 0x25, 0xbe, 0x52, 0x3e, 0x5b, 0x3c, 0xf2, 0x2a, 0x55, 0xff, 0xad,
+  0x0e, 0x7d, 0x5d, 0xcf, 0x40, 0x5b, 0xaf, 0xf1, 0x5e, 0x9f, 0x49, 0x65, 0x18, 0xea, 0x31, 0x59,
+  0x8c, 0x4e, 0x85, 0x2b, 0x16, 0x93, 0x23, 0xe0, 0x88, 0x99, 0x0c, 0x4f, 0xa3, 0x45, 0x6f, 0x1c,
+  0xea, 0x73, 0xa9, 0xd2, 0x38, 0xbe, 0x7c, 0x22, 0xe1, 0xe5, 0xec, 0xa8, 0x15, 0xf4, 0xc0, 0xa2,
+  0xe9, 0xf1, 0xc0, 0xd0, 0xa4, 0xf9, 0xd7, 0x65, 0xf9, 0xdb, 0x76, 0x00, 0x6c, 0x23, 0x55, 0x05,
+  0x00, 0x3c, 0x99, 0x5e, 0xf1, 0x41, 0x8f, 0xc7, 0x06, 0xe4, 0x05, 0x0a, 0xe2, 0x1c, 0x95, 0xb5,
+  0x83, 0xed, 0x0a, 0x5d, 0xcd, 0x3d, 0x5d, 0x75, 0x67, 0x7f, 0xbd, 0xd6, 0xa8, 0x20, 0x5d, 0xf7,
+  0x18, 0xfd, 0xa5, 0x1d, 0x64, 0x45, 0x2d, 0x7f, 0x72, 0xea, 0x2b, 0xf4, 0xd8, 0xa2, 0xe9, 0xf1,
+  0x00, 0x50, 0xaf, 0x3c, 0x71, 0xad, 0x6d, 0x1f, 0x32, 0x16, 0x1d, 0xf4, 0x60, 0x30, 0x3c, 0x13,
+  0x82, 0x97, 0xa4, 0x86, 0xae, 0xe6, 0xb1, 0xfd, 0x91, 0x6a, 0x66, 0xab, 0xa1, 0xa5, 0xf7, 0x4a,
+  0xb3, 0xa6, 0x58, 0xde, 0x73, 0x85, 0x52, 0xd5, 0x7c, 0x2c, 0x3d, 0xec, 0x00, 0xa4, 0x86, 0xe5,
+  0xae, 0x4e, 0x7d, 0x8b, 0x1e, 0x5e, 0x0f, 0x3b, 0x58, 0x0f, 0x57, 0x77, 0x6f, 0x74, 0x1d, 0xa9,
+  0x68, 0x3f, 0x38, 0xea, 0x4b, 0x89, 0x6f, 0xe6, 0x9c, 0xc8, 0xd7, 0x84, 0x9c, 0x09, 0xc8, 0xc7,
+  0x3e, 0x53, 0xc7, 0x4d, 0xe5, 0xe9, 0xba, 0xae, 0x53, 0x26, 0xab, 0x01, 0x3c, 0x20, 0xee, 0xcb,
+  0x14, 0xe7, 0x2c, 0xc3, 0x43, 0x6b, 0xd3, 0xdf, 0xa6, 0x47, 0x18, 0xbd, 0x7a, 0xdc, 0x27, 0xdc,
+  0x54, 0x1e, 0x2d, 0x6b, 0xff, 0x60, 0xe4, 0x54, 0xed, 0xc1, 0xe4, 0x3d, 0x12, 0xb5, 0x35, 0xd2,
+  0x3f, 0x1b, 0xa9, 0xa0, 0x37, 0x75, 0x96, 0xb6, 0x1f, 0xbe, 0xad, 0x3e, 0x77, 0x3f, 0x0d, 0xbb,
+  0x4e, 0x57, 0x0f, 0xe4, 0xe3, 0xf4, 0xb0, 0x9c, 0x35, 0x69, 0x3b, 0xe8, 0x41, 0x46, 0xaf, 0x1e,
+  0x94, 0x43, 0xde, 0x73, 0xb6, 0xbc, 0xfd, 0x83, 0x91, 0xdf, 0x4c, 0x14, 0x65, 0xce, 0x89, 0xdc,
+  0x84, 0x28, 0xdf, 0x66, 0xab, 0xbe, 0xb4, 0xfd, 0x70, 0x7d, 0xd7, 0x29, 0x1b, 0xb0, 0x8d, 0x9f,
+  0x3e, 0x57, 0x2a, 0x2e, 0x88, 0xb8, 0x41, 0x4b, 0xa6, 0xae, 0xa7, 0xc7, 0x19, 0x4d, 0x0f, 0x0a,
+  0xd1, 0x3d, 0x70, 0xeb, 0x27, 0xf9, 0x7f, 0x4c, 0xc3, 0x29, 0xa1, 0x6b, 0xd2, 0xc2, 0xff, 0x80,
+  0xfc, 0xdd, 0xa8, 0xfa, 0xb6, 0xac, 0xfd, 0xf0, 0x80, 0xa5, 0x77, 0x1c, 0xf6, 0xfc, 0x42, 0xf3,
+  0x57, 0x62, 0x41, 0xe8, 0xec, 0x88, 0x27, 0xe8, 0xa1, 0x46, 0xd3, 0x83, 0x12, 0x58, 0x86, 0x07,
+  0x8a, 0x6e, 0x6d, 0x18, 0xf9, 0xcd, 0xac, 0x88, 0x8d, 0x53, 0x82, 0x96, 0x02, 0x00, 0x06, 0x86,
+  0xd4, 0x57, 0x5b, 0xff, 0xa7, 0xa5, 0xe7, 0xa7, 0xf1, 0x2c, 0x20, 0x1e, 0xad, 0xde, 0x33, 0x51,
+  0x14, 0x37, 0x51, 0x14, 0x4b, 0x8f, 0x36, 0x5a, 0xf7, 0x20, 0x1f, 0xe7, 0x6e, 0xff, 0xb9, 0x43,
+  0x5f, 0xe1, 0x10, 0xf7, 0x73, 0x27, 0xef, 0x0d, 0x17, 0x65, 0x00, 0x00, 0xee, 0x74, 0x9f, 0x2b,
+  0x96, 0xbf, 0x6b, 0xb5, 0x99, 0xdd, 0x52, 0x12, 0xee, 0xa7, 0xee, 0xe1, 0xf8, 0xc8, 0x62, 0xb2,
+  0xf7, 0x3d, 0x7e, 0x81, 0xc9, 0xf0, 0xa0, 0x07, 0xdc, 0xc3, 0x05, 0xe6, 0x38, 0xef, 0x5f, 0xa3,
+  0xea, 0x78, 0xa7, 0xbe, 0xc2, 0xf1, 0x71, 0x7e, 0xec, 0x7e, 0x84, 0x1b, 0x35, 0x9d, 0x47, 0x7e,
+  0xbc, 0xb3, 0xdd, 0x6a, 0x33, 0x3f, 0x14, 0x4f, 0xd9, 0x32, 0x3c, 0xf4, 0x61, 0xc9, 0x6b, 0xf4,
+  0x68, 0xa3, 0x85, 0x2b, 0x32, 0x61, 0xb2, 0xf4, 0x96, 0xdf, 0xdb, 0x8f, 0xfc, 0x6d, 0x07, 0xe0,
+  0xb1, 0x98, 0xf7, 0x42, 0x7d, 0xd2, 0x91, 0x8f, 0x0e, 0x33, 0xee, 0x03, 0x04, 0x87, 0xc5, 0x0b,
+  0xe4, 0x47, 0xf8, 0xf1, 0xc3, 0x84, 0x6c, 0x3f, 0x0e, 0x8b, 0x87, 0xd0, 0x40, 0x6f, 0xea, 0xe9,
+  0x36, 0x76, 0xa9, 0x0c, 0xed, 0xfd, 0xa6, 0xff, 0xd0, 0x85, 0x1a, 0xd5, 0x15, 0xe5, 0xed, 0x67,
+  0xd3, 0x27, 0xe6, 0xd1, 0x63, 0x8e, 0xa6, 0x07, 0x39, 0x28, 0x96, 0x6f, 0x71, 0xfc, 0x9d, 0x21,
+  0x79, 0x4d, 0xe2, 0x3b, 0xd7, 0xf1, 0x31, 0xca, 0x3f, 0xe7, 0xa6, 0xf2, 0x44, 0x97, 0xbe, 0xee,
+  0xfe, 0xf7, 0x4a, 0xcc, 0x0f, 0x8f, 0xf6, 0x4f, 0x9b, 0xe4, 0x97, 0x1c, 0x13, 0x90, 0xce, 0xf3,
+  0xf4, 0x76, 0x5a, 0xc7, 0x6a, 0xb3, 0x34, 0xaa, 0xcb, 0x6e, 0x6b, 0x64, 0x37, 0xbb, 0xae, 0x69,
+  0x06, 0x3a, 0x90, 0x2f, 0xff, 0x57, 0xf6, 0x76, 0x7c, 0x90, 0x54, 0xc8, 0x11, 0xd1, 0xc3, 0x8e,
+  0xd6, 0x3d, 0x88, 0x42, 0x65, 0xa8, 0x39, 0x7b, 0x6b, 0x3d, 0x22, 0xbe, 0xc7, 0x04, 0x3c, 0x3e,
+  0x2b, 0x62, 0xd3, 0xa8, 0x0a, 0x6a, 0x43, 0xfd, 0x37, 0x75, 0xeb, 0xdc, 0x55, 0x12, 0x70, 0xeb,
+  0x1e, 0x4c, 0xc0, 0x8a, 0x0f, 0x9a, 0x9b, 0x3e, 0x71, 0x49, 0x94, 0x9b, 0x41, 0xe7, 0x35, 0x9d,
+  0xc5, 0x17, 0x9a, 0x8f, 0xc9, 0x7b, 0xea, 0x80, 0x1d, 0xa4, 0x84, 0x3e, 0xf2, 0x87, 0x99, 0xbb,
+  0xe8, 0x61, 0x47, 0xd3, 0x83, 0x28, 0x0a, 0xeb, 0x96, 0x1a, 0xcc, 0x4a, 0x3b, 0x00, 0x22, 0x6e,
+  0xe4, 0x13, 0x53, 0xbf, 0x74, 0x5a, 0xa7, 0xe4, 0xee, 0xbe, 0xba, 0xae, 0x13, 0x54, 0xd3, 0x83,
+  0xc7, 0xf2, 0x99, 0x1d, 0xf9, 0xcc, 0xb4, 0x90, 0x3c, 0x6f, 0x8e, 0x18, 0xf7, 0xcf, 0x69, 0x50,
+  0x95, 0x7d, 0x5d, 0xfb, 0x41, 0xa7, 0xbe, 0xf5, 0x4f, 0x99, 0xbb, 0xa7, 0x4d, 0x98, 0x4d, 0x8f,
+  0x3c, 0x9a, 0x1e, 0xf8, 0xd1, 0xae, 0xbb, 0x7c, 0x59, 0xbe, 0xd9, 0x6e, 0x07, 0x76, 0xc0, 0x58,
+  0x9a, 0x78, 0x42, 0xc8, 0x09, 0x41, 0x67, 0xd1, 0x0b, 0xaa, 0xfe, 0x06, 0x8a, 0xe8, 0xe1, 0xe5,
+  0xe9, 0x33, 0x3b, 0x72, 0xd5, 0x8c, 0xb0, 0x27, 0x38, 0x2c, 0x3e, 0x29, 0xbf, 0xeb, 0x44, 0xed,
+  0xfb, 0x55, 0x1d, 0xc5, 0x6f, 0x66, 0x1f, 0x12, 0x79, 0x05, 0xd0, 0x83, 0x8f, 0xa6, 0x07, 0x4e,
+  0x9c, 0xbe, 0xb9, 0x5c, 0x6f, 0xbe, 0x67, 0xb7, 0x83, 0xcc, 0x88, 0x2d, 0xd1, 0xe2, 0x85, 0x90,
+  0x9a, 0x36, 0xbb, 0xe5, 0xff, 0x6a, 0x9e, 0xd5, 0x0e, 0xb6, 0x93, 0x4e, 0x8f, 0x84, 0xa0, 0x47,
+  0x17, 0xc6, 0x6f, 0xe4, 0xb1, 0x7d, 0xc8, 0xfd, 0x69, 0xcd, 0xdd, 0x35, 0x5c, 0x16, 0x3f, 0x5c,
+  0x14, 0x43, 0x0f, 0x3e, 0x9a, 0x1e, 0x78, 0xd0, 0xd1, 0x57, 0x72, 0xe9, 0xce, 0xeb, 0x76, 0x00,
+  0xfc, 0x79, 0x09, 0xf9, 0xf1, 0x1f, 0xbb, 0xac, 0x3f, 0x6c, 0xb3, 0x7c, 0x73, 0xf3, 0x4f, 0x2a,
+  0x43, 0x03, 0x59, 0xf4, 0xf0, 0xe7, 0x45, 0xe4, 0x4c, 0xfe, 0x53, 0x6c, 0x00, 0x2d, 0x02, 0xd1,
+  0xf4, 0x18, 0x7f, 0xf4, 0xb8, 0x24, 0xdf, 0xd8, 0xa1, 0xbb, 0x66, 0x07, 0xe0, 0xe9, 0xa4, 0xef,
+  0xbc, 0x3c, 0xfd, 0x31, 0x5e, 0x75, 0xb5, 0x75, 0xff, 0x8d, 0xce, 0xe3, 0x04, 0xe9, 0xe1, 0xeb,
+  0x15, 0x9e, 0x15, 0xf9, 0x5f, 0x89, 0x13, 0x68, 0xf3, 0x2b, 0x0d, 0x00, 0xc6, 0xa1, 0x61, 0xd7,
+  0x6a, 0x33, 0x75, 0xf6, 0x95, 0x02, 0x00, 0x62, 0x03, 0x9e, 0xc2, 0xce, 0x0d, 0x00, 0xc0, 0xec,
+  0x49, 0xaf, 0x46, 0xfa, 0x65, 0x95, 0x2b, 0x3e, 0xbb, 0xa7, 0x95, 0xe1, 0xb8, 0x6f, 0x94, 0xbf,
+  0x74, 0x5a, 0xc8, 0xa2, 0x29, 0x41, 0x8f, 0xba, 0x75, 0x95, 0x4e, 0xa7, 0x53, 0x2a, 0x95, 0x4e,
+  0x8b, 0xc4, 0x62, 0xb1, 0x58, 0x2c, 0xa6, 0x47, 0x18, 0x4d, 0x0f, 0x32, 0x71, 0xa7, 0xfb, 0x5b,
+  0x3b, 0xb0, 0x31, 0x99, 0x9c, 0x19, 0x13, 0xff, 0xdb, 0xdd, 0x6b, 0x43, 0x7c, 0x52, 0x96, 0xf8,
+  0xa4, 0xdc, 0xd5, 0x5e, 0x6f, 0xd6, 0x5c, 0xbc, 0xab, 0x2d, 0x1b, 0x18, 0xea, 0x71, 0x79, 0x49,
+  0xa0, 0x20, 0x2a, 0xd2, 0x5f, 0x3a, 0x39, 0x60, 0x6e, 0x98, 0x4f, 0x22, 0x8e, 0xde, 0x56, 0x57,
+  0x57, 0x1f, 0x3b, 0x76, 0xcc, 0x69, 0x51, 0x4e, 0x4e, 0xce, 0xb2, 0x65, 0xcb, 0xe8, 0x11, 0x46,
+  0xd3, 0x83, 0x4c, 0xc8, 0x7b, 0xbe, 0x05, 0x00, 0x24, 0x04, 0xad, 0x62, 0xe0, 0x75, 0x78, 0x89,
+  0xf0, 0xcd, 0x88, 0xf0, 0xcd, 0x18, 0xb6, 0x0d, 0xc9, 0x7b, 0x7e, 0x52, 0x1b, 0x9a, 0x7a, 0x8d,
+  0xed, 0xfd, 0x43, 0xea, 0xc1, 0x21, 0xbd, 0xc5, 0x66, 0x06, 0x80, 0xe1, 0xc9, 0xf4, 0xe2, 0x7a,
+  0xfa, 0xf8, 0x70, 0x27, 0x04, 0xf0, 0xa3, 0xc3, 0x44, 0xd3, 0xc2, 0x7c, 0x92, 0x88, 0xf4, 0xd6,
+  0xd3, 0xd3, 0x13, 0xad, 0x88, 0xc3, 0xe1, 0xd0, 0xc3, 0x8b, 0xa6, 0x07, 0x99, 0x30, 0x5b, 0xfb,
+  0x74, 0x83, 0x2d, 0x4c, 0x06, 0x2b, 0x69, 0xc2, 0x1a, 0x82, 0x4d, 0x79, 0x30, 0xd9, 0x93, 0x03,
+  0x72, 0x26, 0x07, 0xe4, 0x38, 0xbe, 0xb1, 0xd9, 0xad, 0x00, 0x30, 0xc8, 0xf5, 0x0b, 0x64, 0x30,
+  0x18, 0x38, 0x8a, 0x68, 0xd0, 0xf4, 0xc0, 0x03, 0xcd, 0x40, 0x2d, 0x00, 0x20, 0x3e, 0x70, 0x05,
+  0x83, 0x02, 0xe7, 0x56, 0x26, 0x83, 0x45, 0xbf, 0x6f, 0x1a, 0xee, 0x8d, 0x99, 0x71, 0xd5, 0x9b,
+  0xd6, 0x9e, 0xef, 0x01, 0x00, 0x71, 0x81, 0xcb, 0xe9, 0x17, 0x43, 0x83, 0xa6, 0xc7, 0x68, 0xdc,
+  0xd3, 0x5d, 0xf6, 0xe1, 0x46, 0xb8, 0x65, 0xb0, 0xa2, 0x41, 0xe3, 0x37, 0x41, 0x8f, 0x81, 0x21,
+  0x15, 0x00, 0x20, 0x25, 0x74, 0x03, 0xfd, 0x56, 0x68, 0xd0, 0xf4, 0x18, 0x0d, 0xb5, 0xa1, 0x0a,
+  0x00, 0x10, 0xea, 0x33, 0x8b, 0x7e, 0x2b, 0x34, 0x68, 0x7a, 0x8c, 0xd1, 0xcb, 0x0d, 0x35, 0x7e,
+  0xbc, 0x38, 0xfa, 0x95, 0xd0, 0xa0, 0xe9, 0xe1, 0x04, 0xc3, 0xb6, 0xa1, 0x48, 0xff, 0x7c, 0xfa,
+  0x95, 0xd0, 0xa0, 0xe9, 0xe1, 0x04, 0x7c, 0x76, 0xf0, 0x04, 0x6f, 0x29, 0xfd, 0x4a, 0x68, 0xd0,
+  0xf4, 0x18, 0x0d, 0xab, 0x6d, 0x50, 0xc8, 0x9d, 0x28, 0xe0, 0x84, 0xd2, 0xaf, 0x84, 0x06, 0x4d,
+  0x8f, 0xd1, 0x18, 0xb2, 0xf6, 0xf3, 0xd9, 0xc1, 0x8c, 0x71, 0x9f, 0x39, 0x85, 0xc6, 0x6f, 0x0a,
+  0xe3, 0x65, 0x23, 0x99, 0xc5, 0xe2, 0x7a, 0x33, 0x24, 0xf4, 0xfb, 0xa0, 0x41, 0xd3, 0xc3, 0x09,
+  0xd8, 0x4c, 0x6f, 0x1c, 0x2b, 0xc7, 0xe0, 0xe0, 0xa0, 0x52, 0xa9, 0x54, 0xab, 0xd5, 0xbd, 0xbd,
+  0xbd, 0x06, 0x83, 0xc1, 0x68, 0x34, 0xfe, 0x4c, 0x36, 0x96, 0x40, 0x20, 0xf0, 0xf3, 0xf3, 0x0b,
+  0x0c, 0x0c, 0x0c, 0x09, 0x09, 0x11, 0x0a, 0x85, 0xe3, 0xe7, 0x89, 0x0f, 0x0e, 0x0e, 0x2a, 0x14,
+  0x8a, 0xae, 0xae, 0x2e, 0xad, 0x56, 0x6b, 0x30, 0x18, 0xac, 0x56, 0x2b, 0x00, 0x80, 0xc1, 0x60,
+  0x08, 0x04, 0x02, 0xa1, 0x50, 0x28, 0x16, 0x8b, 0x83, 0x83, 0x83, 0x27, 0x4c, 0x78, 0x30, 0x69,
+  0x8a, 0xb4, 0x5a, 0xad, 0x52, 0xa9, 0xd4, 0x68, 0x34, 0x7d, 0x7d, 0x7d, 0x06, 0x83, 0x61, 0x68,
+  0x68, 0x08, 0xf9, 0xde, 0xcb, 0xcb, 0x0b, 0xe9, 0x1b, 0xf2, 0x3c, 0x21, 0x8e, 0x98, 0xf7, 0x19,
+  0xdd, 0xdd, 0xdd, 0x4a, 0xa5, 0xb2, 0xbb, 0xbb, 0x1b, 0xe9, 0x30, 0xf2, 0x30, 0x01, 0x00, 0x3c,
+  0x1e, 0xcf, 0xdb, 0xdb, 0x5b, 0x2c, 0x16, 0x07, 0x05, 0x05, 0x85, 0x84, 0x84, 0x30, 0x99, 0x38,
+  0xa5, 0x12, 0x56, 0x69, 0x69, 0xe9, 0xf0, 0xf0, 0xb0, 0xd3, 0x32, 0x7f, 0x7f, 0xff, 0xb8, 0x38,
+  0x72, 0x2c, 0xad, 0x55, 0x55, 0x55, 0x83, 0x83, 0x83, 0x4e, 0x8b, 0xbc, 0x78, 0x5e, 0xd3, 0x53,
+  0xa6, 0xbb, 0xd5, 0x9a, 0x5e, 0xaf, 0xaf, 0xab, 0xab, 0xab, 0xac, 0xac, 0x94, 0xcb, 0xe5, 0x26,
+  0x93, 0x09, 0x5e, 0xd9, 0xd3, 0xd3, 0x33, 0x22, 0x22, 0x42, 0x2a, 0x95, 0x26, 0x26, 0x26, 0x8a,
+  0x44, 0x22, 0xa7, 0x75, 0x2a, 0x2b, 0x2b, 0x9d, 0xb6, 0x93, 0x90, 0x90, 0x80, 0x76, 0x09, 0x0e,
+  0x34, 0x36, 0x36, 0x5e, 0xbd, 0x7a, 0xb5, 0xbe, 0xbe, 0x1e, 0xed, 0x51, 0x38, 0x10, 0x10, 0x10,
+  0x90, 0x9a, 0x9a, 0x9a, 0x96, 0x96, 0x16, 0x1e, 0x1e, 0x7e, 0x1f, 0x06, 0x99, 0x42, 0xa1, 0xa8,
+  0xad, 0xad, 0xad, 0xac, 0xac, 0xec, 0xe8, 0xe8, 0x70, 0x19, 0x1e, 0x27, 0x14, 0x0a, 0xe3, 0xe2,
+  0xe2, 0xd2, 0xd3, 0xd3, 0x13, 0x12, 0x12, 0x3c, 0x3c, 0x3c, 0x9c, 0x72, 0xac, 0xa1, 0xa1, 0xc1,
+  0x99, 0x80, 0xc0, 0x4a, 0x4b, 0x4b, 0x73, 0x7a, 0x89, 0xbb, 0x68, 0x6d, 0x6d, 0xad, 0xae, 0xae,
+  0xbe, 0x71, 0xe3, 0x06, 0x5a, 0xb0, 0xcd, 0x48, 0x88, 0x44, 0xa2, 0x84, 0x84, 0x84, 0x19, 0x33,
+  0x66, 0xc4, 0xc7, 0xc7, 0x3b, 0xad, 0xa0, 0x54, 0x2a, 0xe5, 0x72, 0xf9, 0xd8, 0xde, 0x4a, 0xa5,
+  0x52, 0x56, 0x75, 0x75, 0x75, 0x4d, 0x4d, 0x0d, 0x5a, 0xd3, 0x07, 0x0f, 0x1e, 0xc4, 0xcd, 0x3c,
+  0x07, 0x7a, 0x7a, 0x7a, 0x0e, 0x1d, 0x3a, 0x84, 0x56, 0x9a, 0x9b, 0x9b, 0x8b, 0x9d, 0x1e, 0x0a,
+  0x85, 0xa2, 0xa8, 0xa8, 0xe8, 0xc6, 0x8d, 0x1b, 0x16, 0x8b, 0x05, 0xe3, 0x25, 0x16, 0x8b, 0xa5,
+  0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x99, 0xc5, 0x62, 0x25, 0x27, 0x27, 0x2f, 0x5c, 0xb8, 0x30, 0x24,
+  0x64, 0x74, 0x62, 0x87, 0xc3, 0x87, 0x0f, 0x3b, 0xbd, 0x76, 0xc3, 0x86, 0x0d, 0xa4, 0xd0, 0xa3,
+  0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0xbd, 0xbd, 0x1d, 0x63, 0x7d, 0x8d, 0x46, 0xf3, 0xc3, 0x0f,
+  0x3f, 0xfc, 0xf0, 0xc3, 0x0f, 0x71, 0x71, 0x71, 0x8f, 0x3f, 0xfe, 0x78, 0x54, 0x54, 0x14, 0x45,
+  0xc4, 0xa8, 0xac, 0xac, 0xbc, 0x70, 0xe1, 0x42, 0x4b, 0x4b, 0x0b, 0xf6, 0x4b, 0xfa, 0xfb, 0xfb,
+  0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x44, 0x22, 0x51, 0x46, 0x46, 0x46, 0x7e, 0x7e, 0x3e, 0x9b,
+  0xcd, 0x1e, 0x59, 0x41, 0x2e, 0x97, 0x7f, 0xf1, 0xc5, 0x17, 0x4e, 0xaf, 0x4d, 0x4a, 0x4a, 0xf2,
+  0xf2, 0xf2, 0x22, 0xd2, 0xe1, 0x92, 0x92, 0x92, 0x4b, 0x97, 0x2e, 0xdd, 0xbb, 0x77, 0x0f, 0xfb,
+  0x25, 0x3a, 0x9d, 0xae, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x24, 0x30, 0x30, 0x70, 0xee, 0xdc, 0xb9,
+  0x39, 0x39, 0x39, 0xa3, 0x9c, 0xa9, 0xab, 0xab, 0xab, 0x4f, 0x9d, 0x3a, 0x35, 0xf6, 0x42, 0xa9,
+  0x54, 0xca, 0x5a, 0xbe, 0x7c, 0x39, 0x84, 0x1e, 0x8d, 0x8d, 0x8d, 0x09, 0x09, 0x09, 0x04, 0xdf,
+  0x01, 0xa4, 0x7d, 0x16, 0x8b, 0xf5, 0xe4, 0x93, 0x4f, 0x62, 0xfc, 0x91, 0x85, 0x85, 0x85, 0x65,
+  0x65, 0x65, 0xb8, 0xbb, 0x61, 0xb5, 0x5a, 0x65, 0x32, 0x99, 0x4c, 0x26, 0xcb, 0xc8, 0xc8, 0x58,
+  0xb6, 0x6c, 0x19, 0x9f, 0xcf, 0x1f, 0xb9, 0x4e, 0xf6, 0xf4, 0xf4, 0x38, 0x5d, 0x79, 0x70, 0xdf,
+  0xce, 0xb1, 0x26, 0x7f, 0xf5, 0xd5, 0x57, 0x3f, 0xfd, 0xf4, 0x13, 0xbe, 0x46, 0x6e, 0xdd, 0xba,
+  0x75, 0xeb, 0xd6, 0xad, 0xcc, 0xcc, 0xcc, 0xe7, 0x9e, 0x7b, 0x8e, 0x5c, 0x62, 0x34, 0x34, 0x34,
+  0x9c, 0x39, 0x73, 0x66, 0xec, 0xac, 0xe9, 0xd6, 0xb0, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x99,
+  0x37, 0x6f, 0x5e, 0x6e, 0x6e, 0xee, 0x2f, 0x72, 0xf2, 0x7f, 0xb2, 0xc5, 0x01, 0x0e, 0x87, 0x43,
+  0xc4, 0xc9, 0xbf, 0xbc, 0xbc, 0xbc, 0xa8, 0xa8, 0xa8, 0xb3, 0xb3, 0x13, 0x77, 0x0b, 0x6a, 0xb5,
+  0xfa, 0xeb, 0xaf, 0xbf, 0x2e, 0x2e, 0x2e, 0x5e, 0xb0, 0x60, 0xc1, 0xec, 0xd9, 0xbf, 0x24, 0x12,
+  0x70, 0xca, 0x58, 0x24, 0x5c, 0x87, 0xe5, 0xe7, 0xe7, 0x17, 0x1e, 0x1e, 0x8e, 0x46, 0xc7, 0x92,
+  0x92, 0x12, 0xe2, 0xf4, 0xb8, 0x72, 0xe5, 0x0a, 0x5a, 0x51, 0x4a, 0x4a, 0x0a, 0x96, 0xd5, 0xe9,
+  0xca, 0x95, 0x2b, 0x27, 0x4e, 0x9c, 0x30, 0x9b, 0xc9, 0xc9, 0xa8, 0x7b, 0xfd, 0xfa, 0xf5, 0x9b,
+  0x37, 0x6f, 0xae, 0x5c, 0xb9, 0x72, 0xfa, 0xf4, 0x7f, 0xaf, 0x5a, 0x68, 0xaf, 0x8d, 0xc8, 0xeb,
+  0x0c, 0x0c, 0x0c, 0x04, 0x00, 0xec, 0xdb, 0xb7, 0xef, 0xd6, 0xad, 0x5b, 0x04, 0x3b, 0x7c, 0xed,
+  0xda, 0xb5, 0xb6, 0xb6, 0xb6, 0x75, 0xeb, 0xd6, 0x91, 0xa2, 0x93, 0x58, 0xad, 0xd6, 0xaf, 0xbf,
+  0xfe, 0xfa, 0xd2, 0xa5, 0x4b, 0xa4, 0x3c, 0x4c, 0xbd, 0x5e, 0x7f, 0xf2, 0xe4, 0xc9, 0xfa, 0xfa,
+  0xfa, 0x95, 0x2b, 0x57, 0x06, 0x05, 0x05, 0x41, 0x6a, 0xe2, 0x7e, 0x98, 0x03, 0x03, 0x03, 0x47,
+  0x8f, 0x1e, 0xad, 0xa8, 0xa8, 0x20, 0x4b, 0x5d, 0x39, 0x72, 0xe4, 0x48, 0x43, 0x43, 0xc3, 0xef,
+  0x7f, 0xff, 0x7b, 0x88, 0x52, 0x8a, 0xf4, 0x96, 0x09, 0x00, 0x58, 0xb8, 0x70, 0x21, 0x64, 0xf1,
+  0xd5, 0xeb, 0xf5, 0x44, 0x7a, 0xd3, 0xd2, 0xd2, 0xd2, 0xd5, 0xd5, 0x85, 0x56, 0xfa, 0xd8, 0x63,
+  0x8f, 0xb9, 0x6c, 0xe1, 0xf3, 0xcf, 0x3f, 0xff, 0xf2, 0xcb, 0x2f, 0xc9, 0xe2, 0x86, 0x43, 0x42,
+  0x38, 0x74, 0xe8, 0xd0, 0x77, 0xdf, 0x7d, 0x87, 0x7c, 0xb4, 0xd9, 0xc8, 0x3f, 0x34, 0xc7, 0x68,
+  0x34, 0x7e, 0xf5, 0xd5, 0x57, 0xc4, 0xb9, 0x81, 0xa0, 0xa3, 0xa3, 0xa3, 0xa0, 0xa0, 0xa0, 0xad,
+  0xad, 0x8d, 0x60, 0x3b, 0x1a, 0x8d, 0x66, 0xc7, 0x8e, 0x1d, 0x64, 0x71, 0x63, 0xe4, 0x2a, 0xb7,
+  0x7d, 0xfb, 0xf6, 0xa6, 0xa6, 0x26, 0x40, 0x76, 0x1c, 0x58, 0x4b, 0x4b, 0xcb, 0xb6, 0x6d, 0xdb,
+  0xc8, 0xe2, 0xc6, 0xc8, 0x81, 0x5d, 0x50, 0x50, 0xa0, 0x52, 0xa9, 0x00, 0x00, 0x10, 0x75, 0x8b,
+  0x89, 0x4c, 0xe1, 0x23, 0x25, 0x8d, 0xb1, 0x0d, 0x11, 0xec, 0x07, 0x5a, 0x51, 0x78, 0x78, 0xf8,
+  0xa4, 0x49, 0x93, 0x20, 0xd7, 0xda, 0xed, 0xf6, 0xdd, 0xbb, 0x77, 0x5f, 0xbb, 0x76, 0x8d, 0x22,
+  0xc9, 0xfb, 0xcc, 0x99, 0x33, 0xdf, 0x7f, 0xff, 0x3d, 0x44, 0x1e, 0x20, 0x82, 0x93, 0x27, 0x4f,
+  0xe2, 0x96, 0xa9, 0x9c, 0xc2, 0x66, 0xb3, 0xed, 0xd9, 0xb3, 0x47, 0xa3, 0xd1, 0xe0, 0x6e, 0xa1,
+  0xa9, 0xa9, 0x69, 0xfb, 0xf6, 0xed, 0x6a, 0xb5, 0x9a, 0x8a, 0x87, 0x69, 0xb3, 0xd9, 0xf6, 0xee,
+  0xdd, 0xab, 0xd3, 0xe9, 0x26, 0x4e, 0x9c, 0x48, 0x56, 0x9b, 0x32, 0x99, 0x6c, 0xf7, 0xee, 0xdd,
+  0x06, 0x83, 0x81, 0x8a, 0x0e, 0xeb, 0xf5, 0xfa, 0x82, 0x82, 0x02, 0x00, 0x40, 0x58, 0x58, 0x18,
+  0x8c, 0x1e, 0x00, 0x80, 0xd4, 0x54, 0xd4, 0xbc, 0xb1, 0x04, 0x89, 0x0b, 0xa1, 0x47, 0x46, 0x46,
+  0x06, 0xfc, 0x71, 0xef, 0xdc, 0xb9, 0xd3, 0x2d, 0xad, 0x11, 0x07, 0x4e, 0x9f, 0x3e, 0x5d, 0x5a,
+  0x5a, 0x4a, 0x45, 0x4a, 0x11, 0x2a, 0x56, 0x24, 0xab, 0xd5, 0xba, 0x77, 0xef, 0x5e, 0xdc, 0xe6,
+  0x81, 0xbd, 0x7b, 0xf7, 0x3a, 0x4c, 0x9f, 0x14, 0xe1, 0x6f, 0x7f, 0xfb, 0x5b, 0x6d, 0x6d, 0x2d,
+  0x8b, 0x45, 0xc2, 0x86, 0x41, 0x59, 0x59, 0xd9, 0xc7, 0x1f, 0x7f, 0x4c, 0x69, 0x6f, 0xad, 0x56,
+  0xeb, 0xfe, 0xfd, 0xfb, 0x15, 0x0a, 0x05, 0xda, 0x8a, 0xc7, 0x72, 0x08, 0x39, 0x68, 0x53, 0x9d,
+  0x5c, 0x2e, 0x57, 0xab, 0xd5, 0x88, 0x24, 0x8d, 0x63, 0x65, 0xd4, 0x6a, 0xb5, 0x68, 0xb2, 0x5d,
+  0x7a, 0x7a, 0x3a, 0xe4, 0xda, 0x3d, 0x7b, 0xf6, 0x74, 0x74, 0x74, 0x60, 0xbc, 0x51, 0x64, 0x64,
+  0x64, 0x50, 0x50, 0x90, 0xaf, 0xaf, 0xaf, 0x97, 0x97, 0x17, 0x93, 0xc9, 0x34, 0x99, 0x4c, 0x7a,
+  0xbd, 0x5e, 0xa5, 0x52, 0xb5, 0xb5, 0xb5, 0xb9, 0xb4, 0xa2, 0x7e, 0xf6, 0xd9, 0x67, 0x90, 0xc5,
+  0x93, 0x0a, 0x20, 0xc6, 0x78, 0x1f, 0x1f, 0x1f, 0x1e, 0x8f, 0x07, 0x00, 0x30, 0x99, 0x4c, 0x48,
+  0x42, 0x20, 0x2c, 0x7a, 0xa7, 0x56, 0xab, 0x3d, 0x72, 0xe4, 0xc8, 0xb3, 0xcf, 0x3e, 0xeb, 0xd6,
+  0x1d, 0xbb, 0xba, 0xba, 0xf6, 0xef, 0xdf, 0x8f, 0xb1, 0x32, 0x9f, 0xcf, 0x97, 0x48, 0x24, 0x81,
+  0x81, 0x81, 0xde, 0xde, 0xde, 0x5c, 0x2e, 0x77, 0x78, 0x78, 0xd8, 0x68, 0x34, 0xf6, 0xf6, 0xf6,
+  0xaa, 0x54, 0xaa, 0xbb, 0x77, 0xef, 0xba, 0x94, 0xec, 0xbf, 0xfc, 0xf2, 0x4b, 0xe2, 0xf4, 0xa8,
+  0xaf, 0xaf, 0xff, 0xf4, 0xd3, 0x4f, 0x31, 0x56, 0xf6, 0xf5, 0xf5, 0x0d, 0x0f, 0x0f, 0x17, 0x8b,
+  0xc5, 0x42, 0xa1, 0x90, 0xc3, 0xe1, 0x58, 0xad, 0xd6, 0x81, 0x81, 0x81, 0x9e, 0x9e, 0x1e, 0xa5,
+  0x52, 0xa9, 0x50, 0x28, 0x5c, 0xce, 0x1a, 0xb7, 0x6f, 0xdf, 0x46, 0x35, 0x1d, 0x21, 0xff, 0x05,
+  0x07, 0x07, 0x4f, 0x9e, 0x3c, 0x19, 0x91, 0x1d, 0xc7, 0xe2, 0xf2, 0xe5, 0xcb, 0xf8, 0x72, 0xd2,
+  0x9c, 0x3f, 0x7f, 0x1e, 0xad, 0x48, 0x2a, 0x95, 0x42, 0x14, 0xa3, 0x4f, 0x3e, 0xf9, 0xa4, 0xb5,
+  0xb5, 0xd5, 0x65, 0xfb, 0x61, 0x61, 0x61, 0x33, 0x66, 0xcc, 0x48, 0x4b, 0x4b, 0x43, 0x9b, 0xfe,
+  0x8d, 0x46, 0x63, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7d, 0x7d, 0x3d, 0x5c, 0xf9, 0xbb, 0x0f,
+  0xac, 0x60, 0x30, 0x18, 0x19, 0x19, 0x19, 0x52, 0xa9, 0x14, 0x6d, 0x37, 0x49, 0x2e, 0x97, 0x97,
+  0x96, 0x96, 0x5e, 0xb9, 0x72, 0x05, 0xbe, 0xf9, 0x70, 0xf5, 0xea, 0xd5, 0xf9, 0xf3, 0xe7, 0x07,
+  0x04, 0x60, 0xcd, 0xd2, 0x6b, 0xb1, 0x58, 0xf6, 0xec, 0xd9, 0x83, 0xa5, 0xe6, 0xb4, 0x69, 0xd3,
+  0xa6, 0x4f, 0x9f, 0x9e, 0x92, 0x92, 0x82, 0x96, 0x66, 0x45, 0xa5, 0x52, 0x55, 0x54, 0x54, 0xc8,
+  0x64, 0x32, 0x88, 0x3e, 0x89, 0xcc, 0xca, 0x44, 0x1e, 0x54, 0x4f, 0x4f, 0xcf, 0xfb, 0xef, 0xbf,
+  0x8f, 0xa5, 0x66, 0x5a, 0x5a, 0x5a, 0x6a, 0x6a, 0x6a, 0x72, 0x72, 0x32, 0x9a, 0x81, 0xa7, 0xad,
+  0xad, 0xad, 0xaa, 0xaa, 0xaa, 0xa2, 0xa2, 0xc2, 0xa9, 0x65, 0xd2, 0xe5, 0x3a, 0xff, 0x0b, 0xcb,
+  0x33, 0x33, 0x33, 0xd1, 0xe8, 0x51, 0x5d, 0x5d, 0x8d, 0x83, 0x1e, 0x36, 0x9b, 0xad, 0xae, 0x0e,
+  0xf5, 0xfc, 0x8d, 0x39, 0x73, 0xe6, 0xa0, 0x15, 0x5d, 0xbe, 0x7c, 0xd9, 0xa5, 0x44, 0x27, 0x14,
+  0x0a, 0x97, 0x2e, 0x5d, 0x9a, 0x99, 0x99, 0x09, 0xaf, 0xc6, 0xe3, 0xf1, 0x66, 0xcf, 0x9e, 0x3d,
+  0x7b, 0xf6, 0x6c, 0xb9, 0x5c, 0x7e, 0xec, 0xd8, 0x31, 0xec, 0x3b, 0x0f, 0xa4, 0x23, 0x26, 0x26,
+  0x66, 0xf5, 0xea, 0xd5, 0xf0, 0x45, 0x38, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x6a, 0xde, 0xbc, 0x79,
+  0x87, 0x0f, 0x1f, 0x86, 0x9b, 0xf6, 0x4f, 0x9d, 0x3a, 0xb5, 0x6e, 0xdd, 0x3a, 0x8c, 0xb7, 0x3e,
+  0x78, 0xf0, 0xa0, 0xc3, 0x9f, 0x00, 0x72, 0xeb, 0xa7, 0x9f, 0x7e, 0x3a, 0x32, 0x32, 0xd2, 0xe5,
+  0xba, 0xb7, 0x68, 0xd1, 0xa2, 0x45, 0x8b, 0x16, 0x15, 0x17, 0x17, 0x9f, 0x3a, 0x75, 0xca, 0xe5,
+  0xca, 0x8c, 0x0f, 0x07, 0x0e, 0x1c, 0x70, 0x59, 0x27, 0x29, 0x29, 0x69, 0xd9, 0xb2, 0x65, 0x2e,
+  0x85, 0x1a, 0x89, 0x44, 0x22, 0x91, 0x48, 0x96, 0x2c, 0x59, 0x52, 0x54, 0x54, 0xf4, 0xed, 0xb7,
+  0xdf, 0xba, 0x9b, 0x13, 0xf4, 0x17, 0xce, 0x39, 0xac, 0x9c, 0x4e, 0xd9, 0x8c, 0xc3, 0x66, 0xd2,
+  0xd8, 0xd8, 0x88, 0xb6, 0x79, 0x27, 0x14, 0x0a, 0xa3, 0xa3, 0xa3, 0xd1, 0xe6, 0xfb, 0x7f, 0xfe,
+  0xf3, 0x9f, 0xf0, 0x96, 0x13, 0x13, 0x13, 0x77, 0xed, 0xda, 0xe5, 0x92, 0x1b, 0xa3, 0x5e, 0xff,
+  0x96, 0x2d, 0x5b, 0x16, 0x2d, 0x5a, 0xf4, 0x40, 0xb8, 0x91, 0x95, 0x95, 0xb5, 0x71, 0xe3, 0x46,
+  0x8c, 0x02, 0x6a, 0x60, 0x60, 0xe0, 0xd6, 0xad, 0x5b, 0xe1, 0x46, 0x0b, 0x99, 0x4c, 0x06, 0x99,
+  0x0e, 0x47, 0x2d, 0x35, 0xf0, 0x95, 0x13, 0x00, 0xf0, 0xd4, 0x53, 0x4f, 0xbd, 0xf1, 0xc6, 0x1b,
+  0x2e, 0xb9, 0x31, 0x12, 0xd9, 0xd9, 0xd9, 0x3b, 0x77, 0xee, 0x9c, 0x3a, 0x75, 0x2a, 0xe9, 0xcf,
+  0xea, 0xd4, 0xa9, 0x53, 0x2e, 0x85, 0xea, 0xe7, 0x9e, 0x7b, 0x6e, 0xc3, 0x86, 0x0d, 0xd8, 0x05,
+  0x7e, 0x06, 0x83, 0x91, 0x9f, 0x9f, 0xbf, 0x63, 0xc7, 0x0e, 0x77, 0xbd, 0x10, 0x7e, 0xa1, 0x07,
+  0x87, 0xc3, 0x81, 0xcc, 0xe8, 0xe7, 0xce, 0x9d, 0x23, 0x51, 0xb2, 0x9a, 0x3f, 0x7f, 0x3e, 0x5a,
+  0x11, 0xda, 0x06, 0xb6, 0x03, 0xb9, 0xb9, 0xb9, 0x2f, 0xbd, 0xf4, 0x12, 0x97, 0xcb, 0xc5, 0xf1,
+  0xe8, 0x17, 0x2f, 0x5e, 0xfc, 0xe2, 0x8b, 0x2f, 0xde, 0x67, 0x6e, 0xcc, 0x99, 0x33, 0x67, 0xe5,
+  0xca, 0x95, 0xee, 0x5e, 0xf5, 0xfa, 0xeb, 0xaf, 0xc3, 0x7f, 0x23, 0x16, 0x8b, 0xa2, 0xd1, 0x68,
+  0x3c, 0x7e, 0xfc, 0x38, 0xbc, 0xce, 0x4b, 0x2f, 0xbd, 0x34, 0x72, 0x53, 0x0f, 0x3b, 0x84, 0x42,
+  0xe1, 0xcb, 0x2f, 0xbf, 0xfc, 0xc8, 0x23, 0x8f, 0x90, 0xf8, 0xac, 0x7a, 0x7b, 0x7b, 0x8b, 0x8a,
+  0x8a, 0x20, 0x15, 0xb8, 0x5c, 0xee, 0x9b, 0x6f, 0xbe, 0xe9, 0xd6, 0xcc, 0x38, 0x72, 0xe9, 0xdb,
+  0xba, 0x75, 0x6b, 0x5a, 0x5a, 0x1a, 0x1e, 0x7a, 0x20, 0x23, 0x0f, 0xad, 0x5e, 0x4d, 0x4d, 0x0d,
+  0x9a, 0x6b, 0x16, 0x9a, 0xd5, 0xac, 0xb1, 0xb1, 0x11, 0xad, 0x74, 0xe4, 0x9e, 0xe5, 0x48, 0x28,
+  0x14, 0x0a, 0xc8, 0x55, 0x00, 0x80, 0xbc, 0xbc, 0xbc, 0xa7, 0x9e, 0x7a, 0x8a, 0xc8, 0x0b, 0x98,
+  0x3e, 0x7d, 0xfa, 0x2b, 0xaf, 0xbc, 0x72, 0xdf, 0xb8, 0x11, 0x16, 0x16, 0xb6, 0x6a, 0xd5, 0x2a,
+  0x1c, 0x17, 0x7a, 0x78, 0x78, 0xac, 0x5d, 0xbb, 0x16, 0x52, 0x01, 0xcb, 0x8e, 0x4a, 0x61, 0x61,
+  0x21, 0x7c, 0xbf, 0xe8, 0xb5, 0xd7, 0x5e, 0x4b, 0x4c, 0x4c, 0x24, 0xf2, 0x03, 0x57, 0xac, 0x58,
+  0x31, 0x77, 0xee, 0x5c, 0xb2, 0x1e, 0xd7, 0xe7, 0x9f, 0x7f, 0xee, 0x92, 0x1b, 0x6e, 0xad, 0x72,
+  0x63, 0xb1, 0x6e, 0xdd, 0xba, 0x69, 0xd3, 0xa6, 0xe1, 0xa1, 0x47, 0x60, 0x60, 0x20, 0xda, 0xc6,
+  0xa7, 0xd5, 0x6a, 0xbd, 0x79, 0xf3, 0x26, 0xf6, 0x4e, 0xdc, 0xb8, 0x71, 0x03, 0xad, 0x28, 0x3e,
+  0x3e, 0x1e, 0x6d, 0x5e, 0x44, 0xcb, 0x57, 0xeb, 0xd0, 0xe6, 0x97, 0x2e, 0x5d, 0x4a, 0xfc, 0x1d,
+  0x24, 0x24, 0x24, 0xac, 0x5e, 0xbd, 0xfa, 0xfe, 0xd0, 0x63, 0xcd, 0x9a, 0x35, 0xb8, 0xaf, 0x4d,
+  0x4a, 0x4a, 0x82, 0x6c, 0x93, 0xbb, 0xd4, 0xa3, 0x2c, 0x16, 0xcb, 0xd5, 0xab, 0x57, 0x21, 0x15,
+  0xd6, 0xae, 0x5d, 0x3b, 0x79, 0xf2, 0x64, 0xe2, 0xbf, 0xf1, 0x99, 0x67, 0x9e, 0x21, 0xc8, 0x31,
+  0xc7, 0xd2, 0x01, 0xe7, 0xfc, 0x2b, 0xaf, 0xbc, 0x32, 0xd6, 0x5f, 0x0e, 0x07, 0xd6, 0xaf, 0x5f,
+  0x1f, 0x1a, 0x1a, 0xea, 0x36, 0x3d, 0x00, 0x00, 0xf3, 0xe6, 0xcd, 0x43, 0xab, 0x7a, 0xe1, 0xc2,
+  0x05, 0xec, 0x3d, 0x28, 0x29, 0x29, 0x41, 0x2b, 0xca, 0xcf, 0x77, 0x1e, 0x50, 0xae, 0x56, 0xab,
+  0x9b, 0x9b, 0x9b, 0xd1, 0xae, 0xf2, 0xf1, 0xf1, 0x79, 0xfe, 0xf9, 0xe7, 0xc9, 0x1a, 0xb5, 0xb3,
+  0x66, 0xcd, 0x72, 0x6b, 0x91, 0xc5, 0x87, 0xe8, 0xe8, 0x68, 0x82, 0x2e, 0xb7, 0x33, 0x66, 0xcc,
+  0x40, 0x2b, 0xea, 0xef, 0xef, 0x87, 0x5b, 0x2d, 0xcf, 0x9f, 0x3f, 0x0f, 0xd1, 0x44, 0xb3, 0xb2,
+  0xb2, 0xe0, 0x86, 0x75, 0xb7, 0xf0, 0xc7, 0x3f, 0xfe, 0x51, 0x20, 0x10, 0x10, 0x6c, 0xe4, 0xec,
+  0xd9, 0xb3, 0x90, 0xd2, 0xdf, 0xfd, 0xee, 0x77, 0x24, 0xba, 0x66, 0xfe, 0xe5, 0x2f, 0x7f, 0xc1,
+  0x62, 0x7d, 0x66, 0x8e, 0x15, 0x7b, 0xd0, 0xfc, 0xf0, 0x9a, 0x9a, 0x9a, 0xfa, 0xfa, 0xfa, 0xb0,
+  0xdc, 0xbb, 0xb3, 0xb3, 0x13, 0xcd, 0x2c, 0xeb, 0xeb, 0xeb, 0x8b, 0x36, 0x63, 0xc1, 0x85, 0xe9,
+  0x0d, 0x1b, 0x48, 0xce, 0x7f, 0xb5, 0x7a, 0xf5, 0x6a, 0x7c, 0x0a, 0x0c, 0x76, 0x2c, 0x58, 0xb0,
+  0x80, 0x60, 0x0b, 0x90, 0xed, 0x5a, 0x44, 0x16, 0x85, 0x94, 0x42, 0xf6, 0xec, 0xb9, 0x5c, 0x2e,
+  0x0e, 0x75, 0x08, 0x02, 0x16, 0x8b, 0xf5, 0xc2, 0x0b, 0x2f, 0x10, 0x69, 0xc1, 0x6a, 0xb5, 0x42,
+  0x3a, 0x1c, 0x12, 0x12, 0x82, 0xc5, 0xff, 0x08, 0x3b, 0x04, 0x02, 0x01, 0x16, 0x63, 0x2c, 0x73,
+  0xac, 0x8e, 0x9f, 0x9c, 0x9c, 0x8c, 0x56, 0xbb, 0xaa, 0xaa, 0x0a, 0xcb, 0xbd, 0x65, 0x32, 0x19,
+  0x44, 0x40, 0x42, 0x2b, 0x82, 0x78, 0xe3, 0xc6, 0xc4, 0xc4, 0x48, 0x24, 0x24, 0xc7, 0x12, 0x72,
+  0x38, 0x1c, 0x8c, 0xce, 0xc2, 0xb8, 0x47, 0x0c, 0x71, 0xd1, 0x25, 0x38, 0x38, 0x18, 0xb2, 0xa3,
+  0x0f, 0xb1, 0xab, 0xaa, 0x54, 0x2a, 0xb4, 0x0d, 0x59, 0x00, 0x00, 0xb9, 0xdc, 0x70, 0xc8, 0xcc,
+  0x70, 0x6b, 0x1b, 0x1c, 0xb7, 0x6f, 0xdf, 0x86, 0xec, 0x3f, 0x90, 0x28, 0x38, 0x38, 0x90, 0x9d,
+  0x9d, 0xed, 0xed, 0xed, 0xed, 0x1e, 0x3d, 0x00, 0xd4, 0x4d, 0xb0, 0xbc, 0xbc, 0x9c, 0x20, 0x3d,
+  0xd0, 0x1c, 0x49, 0x94, 0x4a, 0x25, 0x64, 0xa7, 0x69, 0xc5, 0x8a, 0x15, 0x14, 0xd9, 0x94, 0x48,
+  0x89, 0xce, 0x71, 0x8a, 0xd0, 0xd0, 0x50, 0x52, 0x5c, 0xb9, 0x20, 0xea, 0x87, 0x23, 0x9a, 0xcf,
+  0x2d, 0xc5, 0x9d, 0xc7, 0xe3, 0x41, 0x26, 0x29, 0x22, 0x58, 0xbe, 0x1c, 0x7f, 0x72, 0x64, 0x88,
+  0x5c, 0x1d, 0x1a, 0x1a, 0x4a, 0x51, 0x58, 0x98, 0xcb, 0xf9, 0xd1, 0x09, 0x3d, 0x26, 0x4d, 0x9a,
+  0x84, 0xd6, 0x9b, 0x96, 0x96, 0x16, 0xc4, 0xc9, 0x11, 0xfe, 0x3b, 0xd1, 0xea, 0xc4, 0xc6, 0xc6,
+  0x06, 0x07, 0x07, 0x3b, 0x2d, 0x82, 0xec, 0x91, 0x07, 0x07, 0x07, 0x43, 0x9c, 0xc6, 0x88, 0xc0,
+  0xc3, 0xc3, 0x03, 0x62, 0xcb, 0x26, 0x08, 0x7c, 0x6e, 0x38, 0x63, 0x01, 0x89, 0xc7, 0x82, 0x4c,
+  0xb7, 0x10, 0xb9, 0x8b, 0x22, 0x6e, 0x20, 0x23, 0xc7, 0xc7, 0x07, 0xe7, 0x49, 0xa5, 0x10, 0xe7,
+  0x3a, 0xea, 0x3a, 0x9c, 0x9e, 0x9e, 0x0e, 0x9f, 0x1f, 0x99, 0x68, 0x9a, 0x2b, 0xda, 0x05, 0x97,
+  0x2f, 0x5f, 0x86, 0xdf, 0x12, 0x62, 0x2d, 0x81, 0xd8, 0xc8, 0x21, 0x4b, 0x47, 0x52, 0x52, 0x12,
+  0xa0, 0x0c, 0xd4, 0x3d, 0x7a, 0xdc, 0x03, 0x65, 0xec, 0x64, 0x8f, 0x56, 0x04, 0x71, 0x1d, 0x87,
+  0x4c, 0x37, 0x90, 0x97, 0x4b, 0x1c, 0xf8, 0x36, 0x0a, 0x8d, 0x46, 0x23, 0xda, 0xea, 0xc1, 0x64,
+  0x32, 0x49, 0x34, 0x21, 0x8c, 0x15, 0x80, 0x63, 0x62, 0x62, 0xdc, 0xa6, 0x87, 0x54, 0x2a, 0x45,
+  0x63, 0x95, 0x4b, 0xf5, 0xa3, 0xb6, 0xb6, 0x16, 0xad, 0x2b, 0x90, 0x81, 0xde, 0xdd, 0xdd, 0x0d,
+  0x99, 0x93, 0xa8, 0x7b, 0x9d, 0x61, 0x61, 0x61, 0x14, 0x25, 0x16, 0x20, 0xeb, 0x74, 0x28, 0x1c,
+  0xdd, 0x33, 0x18, 0x0c, 0x68, 0x3e, 0x29, 0x3c, 0x1e, 0x8f, 0xd2, 0xf8, 0x75, 0x88, 0xe2, 0x0a,
+  0x81, 0x46, 0xa3, 0x41, 0x5b, 0x09, 0x43, 0x42, 0x42, 0x7c, 0x7d, 0x7d, 0xa9, 0xeb, 0x70, 0x6c,
+  0x6c, 0xac, 0xdb, 0xf4, 0xe0, 0xf1, 0x78, 0x68, 0x1b, 0x93, 0x5a, 0xad, 0x16, 0x12, 0x81, 0xd9,
+  0xdc, 0xdc, 0x8c, 0xe6, 0xde, 0x93, 0x95, 0x95, 0x05, 0x59, 0xc8, 0x20, 0x36, 0x31, 0xb2, 0xa4,
+  0x14, 0xa7, 0x60, 0xb3, 0xd9, 0xf0, 0x18, 0x37, 0xdc, 0x20, 0x1e, 0xa3, 0xef, 0x72, 0x89, 0x40,
+  0x03, 0x44, 0x29, 0xa7, 0x3a, 0x07, 0x0a, 0xbe, 0x60, 0x0f, 0x48, 0xc8, 0x1d, 0xd5, 0x1d, 0xc6,
+  0x43, 0x0f, 0x80, 0xbe, 0xb1, 0x0d, 0xa0, 0xde, 0x22, 0x3f, 0xfe, 0xf8, 0x23, 0x5a, 0x11, 0xdc,
+  0x30, 0x87, 0x66, 0x84, 0x61, 0x32, 0x99, 0x2e, 0xcd, 0x0b, 0xd4, 0x09, 0xf7, 0x44, 0x40, 0xd6,
+  0x89, 0xd8, 0x38, 0xda, 0x81, 0x64, 0x6f, 0xa1, 0xe8, 0xc7, 0x3a, 0xc0, 0xe7, 0xf3, 0x21, 0xd2,
+  0x20, 0x44, 0xb8, 0x42, 0x2b, 0xa2, 0x74, 0xe9, 0x70, 0xf9, 0x40, 0x50, 0xe9, 0x11, 0x11, 0x11,
+  0xe1, 0xef, 0xef, 0xfc, 0x18, 0x9a, 0xba, 0xba, 0x3a, 0xa7, 0x1e, 0xcb, 0x26, 0x93, 0x09, 0x4d,
+  0xf4, 0x9a, 0x30, 0x61, 0x02, 0x5a, 0x6b, 0x08, 0xd0, 0x9c, 0x17, 0xd9, 0x6c, 0x36, 0xd5, 0x67,
+  0x58, 0x12, 0xcc, 0x9d, 0x31, 0x0e, 0x01, 0x49, 0xe3, 0x42, 0xf5, 0x56, 0x8f, 0xa7, 0xa7, 0x27,
+  0x0e, 0x7a, 0x40, 0x4c, 0x70, 0x54, 0xbf, 0x7d, 0x0e, 0x87, 0x03, 0xd9, 0x1f, 0x84, 0x09, 0x00,
+  0x68, 0x8e, 0x83, 0x56, 0xab, 0xd5, 0xa9, 0x13, 0x28, 0xc4, 0x7d, 0x3d, 0x2f, 0x2f, 0x0f, 0xde,
+  0x4b, 0x34, 0x87, 0x2e, 0x26, 0x93, 0x49, 0x96, 0x94, 0x82, 0x06, 0xea, 0x6c, 0xbb, 0x0f, 0x0a,
+  0x90, 0x70, 0x0b, 0xaa, 0x1f, 0x26, 0xbe, 0x5b, 0x40, 0xdc, 0xf9, 0xa8, 0xee, 0x30, 0x7c, 0x80,
+  0xc1, 0xee, 0x3d, 0x73, 0xe6, 0x4c, 0xb4, 0x2b, 0x9d, 0xca, 0x57, 0x68, 0x8e, 0x24, 0x1c, 0x0e,
+  0x07, 0x1e, 0x37, 0x0b, 0x19, 0xa3, 0x56, 0xab, 0xd5, 0x2d, 0x57, 0x48, 0x1c, 0xa0, 0xba, 0xfd,
+  0xfb, 0x0f, 0x08, 0xe1, 0xef, 0xc3, 0x8f, 0xc5, 0x71, 0x0b, 0xc8, 0x00, 0xbd, 0x0f, 0x6f, 0x1f,
+  0x46, 0x4e, 0xb8, 0xda, 0x8a, 0x66, 0xa7, 0x6b, 0x6e, 0x6e, 0xd6, 0xe9, 0x74, 0x23, 0xbf, 0xe9,
+  0xee, 0xee, 0x46, 0x73, 0xb6, 0x4d, 0x49, 0x49, 0xc1, 0x6d, 0x9f, 0x19, 0x1a, 0x1a, 0xa2, 0x3a,
+  0x94, 0xcf, 0x65, 0xa8, 0xd0, 0x43, 0x07, 0xc8, 0x76, 0x24, 0x45, 0x69, 0x0d, 0x08, 0xbe, 0x2f,
+  0x88, 0x04, 0x45, 0xf5, 0xdb, 0x37, 0x9b, 0xcd, 0x38, 0xe9, 0x01, 0x00, 0x78, 0xf4, 0xd1, 0x47,
+  0xd1, 0x8a, 0x46, 0xa9, 0x19, 0x90, 0x9d, 0x72, 0x2c, 0xde, 0x32, 0x10, 0x81, 0x75, 0x14, 0x0f,
+  0x49, 0x07, 0xc4, 0xa6, 0xfc, 0x90, 0x02, 0xa2, 0x4d, 0x51, 0xfd, 0x63, 0xfb, 0xfb, 0xfb, 0x5d,
+  0xa6, 0x75, 0x75, 0xaa, 0xd0, 0x3f, 0xa8, 0x0e, 0xc3, 0x33, 0xbf, 0xb8, 0xa0, 0x47, 0x7c, 0x7c,
+  0x3c, 0x9a, 0xdd, 0x73, 0x94, 0x03, 0x19, 0x9a, 0x43, 0xa1, 0x44, 0x22, 0xc1, 0x62, 0xec, 0x83,
+  0x6c, 0xa2, 0x61, 0x4f, 0xc8, 0x80, 0x6f, 0xe9, 0x20, 0x92, 0x1a, 0x67, 0x7c, 0xc2, 0xd7, 0xd7,
+  0x17, 0xcd, 0x1c, 0xac, 0x54, 0x2a, 0xb1, 0xe7, 0x5f, 0xc5, 0x81, 0x3b, 0x77, 0xee, 0xe0, 0xb8,
+  0x0a, 0x62, 0x9c, 0xa4, 0x3a, 0xfe, 0x19, 0x1e, 0x5f, 0xe4, 0x5a, 0xef, 0x41, 0x53, 0x1b, 0xba,
+  0xba, 0xba, 0x1c, 0x5b, 0xb3, 0x0a, 0x85, 0x02, 0xed, 0x67, 0x60, 0x0c, 0xec, 0x82, 0x38, 0xde,
+  0x41, 0x12, 0x49, 0x10, 0x47, 0x6b, 0x6b, 0x2b, 0x15, 0x19, 0x77, 0x1e, 0x2c, 0xf8, 0x7c, 0x3e,
+  0xda, 0x94, 0x64, 0xb3, 0xd9, 0xd0, 0xf6, 0x6d, 0x49, 0x01, 0x46, 0xa7, 0xd5, 0x51, 0x08, 0x0c,
+  0x0c, 0x44, 0x33, 0x1f, 0xf5, 0xf5, 0xf5, 0xa1, 0xa5, 0x40, 0x20, 0x05, 0x4e, 0xb3, 0x65, 0x93,
+  0x40, 0x0f, 0x30, 0x22, 0x05, 0x16, 0xc4, 0x15, 0x19, 0x12, 0xb1, 0x30, 0x12, 0x90, 0x30, 0x17,
+  0xb7, 0xc2, 0xb0, 0xdc, 0x85, 0x4b, 0x1f, 0x99, 0x87, 0x14, 0x10, 0x57, 0x83, 0xe2, 0xe2, 0xe2,
+  0x07, 0x35, 0x19, 0xa3, 0x81, 0xcb, 0xe5, 0x42, 0x9c, 0x3b, 0x4a, 0x4b, 0x4b, 0x29, 0xea, 0x2d,
+  0xc4, 0xbd, 0x00, 0x2b, 0x3d, 0x44, 0x22, 0x11, 0x5a, 0xd4, 0x81, 0x43, 0xa0, 0x42, 0x8b, 0x0d,
+  0x84, 0xe7, 0x5f, 0x1c, 0x09, 0x48, 0x84, 0xa4, 0xc9, 0x64, 0xa2, 0xe8, 0x8d, 0xf6, 0xf7, 0xf7,
+  0x43, 0xa2, 0x1a, 0x1f, 0x6a, 0x40, 0x04, 0xda, 0xa6, 0xa6, 0x26, 0x8a, 0xf4, 0xdd, 0xd2, 0xd2,
+  0x52, 0xdc, 0xb9, 0x5e, 0x21, 0xa1, 0x4e, 0x10, 0xb5, 0x96, 0x20, 0x5c, 0x66, 0x50, 0xc0, 0x64,
+  0x54, 0x46, 0x0b, 0x26, 0xd6, 0xe9, 0x74, 0x46, 0xa3, 0x71, 0x70, 0x70, 0x10, 0x4d, 0x7b, 0x86,
+  0xa4, 0x5c, 0x18, 0x85, 0x80, 0x80, 0x80, 0x88, 0x88, 0x08, 0xb4, 0xd2, 0x6f, 0xbe, 0xf9, 0x86,
+  0x8a, 0xa7, 0x73, 0xfa, 0xf4, 0x69, 0xf0, 0x2b, 0x05, 0xdc, 0x57, 0xc2, 0x65, 0x2e, 0x18, 0x7c,
+  0x70, 0x99, 0xf6, 0x01, 0x5f, 0x87, 0xcd, 0x66, 0x33, 0x92, 0xeb, 0x95, 0x5c, 0x98, 0x4c, 0x26,
+  0x78, 0x7c, 0x22, 0x56, 0x7a, 0xc4, 0xc5, 0xc5, 0xa1, 0x59, 0x96, 0x90, 0x63, 0x28, 0x9c, 0x16,
+  0x09, 0x85, 0x42, 0xc8, 0x88, 0x77, 0x4b, 0x0c, 0x33, 0x99, 0x4c, 0x27, 0x4f, 0x9e, 0x24, 0xf7,
+  0xe9, 0xb4, 0xb7, 0xb7, 0x43, 0x52, 0xc7, 0x3f, 0xec, 0x10, 0x8b, 0xc5, 0x90, 0x3c, 0x71, 0x32,
+  0x99, 0x8c, 0x78, 0x36, 0xeb, 0x51, 0x38, 0x73, 0xe6, 0x0c, 0x91, 0x45, 0x29, 0x3a, 0x3a, 0x1a,
+  0x62, 0x8f, 0x3e, 0x7d, 0xfa, 0x74, 0x7f, 0x7f, 0x3f, 0xb9, 0x1d, 0x86, 0x27, 0x36, 0x70, 0x83,
+  0x1e, 0x00, 0x7d, 0xdb, 0xfb, 0xfc, 0xf9, 0xf3, 0x68, 0x2b, 0x94, 0xbb, 0x29, 0x5e, 0xe0, 0xc1,
+  0xdf, 0xe7, 0xce, 0x9d, 0x23, 0x57, 0x45, 0x83, 0x9c, 0xc8, 0xf3, 0xeb, 0x40, 0x4e, 0x4e, 0x0e,
+  0xa4, 0xf4, 0xe0, 0xc1, 0x83, 0x24, 0x26, 0xbd, 0x97, 0xcb, 0xe5, 0x8e, 0x74, 0xf7, 0xf8, 0xc0,
+  0x64, 0x32, 0xe1, 0x1b, 0x00, 0x58, 0x72, 0xc3, 0x61, 0x47, 0x65, 0x65, 0xe5, 0xf5, 0xeb, 0xd7,
+  0x49, 0xa3, 0x47, 0x56, 0x56, 0x16, 0x9a, 0x25, 0xc4, 0xa9, 0xe5, 0x87, 0xc1, 0x60, 0xc0, 0x5f,
+  0x8f, 0x53, 0x25, 0x07, 0x92, 0x8a, 0x0e, 0x00, 0xb0, 0x6f, 0xdf, 0x3e, 0xb2, 0x8c, 0xb0, 0xef,
+  0xbf, 0xff, 0xfe, 0xaf, 0x6f, 0xbb, 0x63, 0x14, 0xb2, 0xb3, 0xb3, 0x21, 0xdb, 0x6d, 0x5a, 0xad,
+  0xf6, 0xc3, 0x0f, 0x3f, 0x24, 0xe5, 0x46, 0x3a, 0x9d, 0xee, 0xef, 0x7f, 0xff, 0x3b, 0xf1, 0x76,
+  0xe0, 0xe9, 0xb6, 0x5a, 0x5b, 0x5b, 0x3f, 0xfb, 0xec, 0x33, 0x52, 0x3a, 0xac, 0x50, 0x28, 0x5c,
+  0xa6, 0x53, 0x73, 0x8f, 0x1e, 0x5e, 0x5e, 0x5e, 0x6e, 0x45, 0x4e, 0x4f, 0x99, 0x32, 0x05, 0x87,
+  0x33, 0x19, 0x3c, 0x1a, 0xd3, 0x66, 0xb3, 0xbd, 0xf7, 0xde, 0x7b, 0xc4, 0x87, 0xf5, 0x27, 0x9f,
+  0x7c, 0xe2, 0x32, 0x71, 0xe0, 0xaf, 0x03, 0xf0, 0x01, 0xd7, 0xd4, 0xd4, 0xf4, 0x8f, 0x7f, 0xfc,
+  0x83, 0x38, 0x37, 0x76, 0xed, 0xda, 0x45, 0xca, 0x42, 0xc4, 0xe3, 0xf1, 0x66, 0xce, 0x9c, 0x09,
+  0x57, 0xfd, 0x8f, 0x1e, 0x3d, 0x4a, 0xf0, 0x2e, 0x9d, 0x9d, 0x9d, 0x6f, 0xbf, 0xfd, 0x36, 0xd6,
+  0x35, 0x0d, 0x7b, 0xbb, 0x90, 0x53, 0x72, 0xb0, 0xaf, 0x36, 0x2e, 0x17, 0x10, 0xf8, 0x3e, 0x89,
+  0xc1, 0x60, 0xd8, 0xb9, 0x73, 0x27, 0x6e, 0x29, 0x6b, 0x68, 0x68, 0xe8, 0x83, 0x0f, 0x3e, 0x20,
+  0xfd, 0x2c, 0x95, 0x71, 0x8b, 0xfc, 0xfc, 0x7c, 0x78, 0x38, 0x40, 0x75, 0x75, 0xf5, 0xfe, 0xfd,
+  0xfb, 0x71, 0x0f, 0xee, 0xbb, 0x77, 0xef, 0x16, 0x14, 0x14, 0x90, 0xa8, 0x15, 0xac, 0x5c, 0xb9,
+  0x12, 0x1e, 0xdf, 0x52, 0x5c, 0x5c, 0x4c, 0xe4, 0x54, 0x83, 0xda, 0xda, 0xda, 0x5d, 0xbb, 0x76,
+  0x61, 0xdf, 0xe9, 0x72, 0x83, 0x1e, 0x71, 0x71, 0x71, 0x18, 0xa3, 0x05, 0xfc, 0xfd, 0xfd, 0xb1,
+  0x27, 0xa2, 0x1b, 0x85, 0x67, 0x9f, 0x7d, 0x16, 0xee, 0x74, 0x6d, 0x32, 0x99, 0xf6, 0xee, 0xdd,
+  0xeb, 0xd2, 0xe6, 0xe0, 0xf4, 0xd1, 0xec, 0xdc, 0xb9, 0x93, 0xd2, 0x5d, 0x94, 0xf1, 0x06, 0x26,
+  0x93, 0xe9, 0xf2, 0x50, 0xc2, 0xc6, 0xc6, 0xc6, 0x82, 0x82, 0x02, 0x1c, 0x06, 0xee, 0x73, 0xe7,
+  0xce, 0xbd, 0xfb, 0xee, 0xbb, 0xe4, 0xda, 0x88, 0x39, 0x1c, 0x8e, 0xcb, 0x2c, 0x2a, 0x32, 0x99,
+  0x6c, 0xd7, 0xae, 0x5d, 0xee, 0x1e, 0xfc, 0x62, 0xb3, 0xd9, 0x0a, 0x0b, 0x0b, 0x0f, 0x1c, 0x38,
+  0xe0, 0x96, 0x8f, 0xa3, 0x7b, 0xde, 0xc2, 0xf0, 0xb5, 0xcf, 0xdd, 0x6a, 0x68, 0x6f, 0x14, 0x9e,
+  0x3c, 0x13, 0x41, 0x61, 0x61, 0xe1, 0x3b, 0xef, 0xbc, 0x53, 0x59, 0x59, 0x89, 0x65, 0x26, 0x68,
+  0x6b, 0x6b, 0xfb, 0xe2, 0x8b, 0x2f, 0x0e, 0x1c, 0x38, 0x40, 0xd1, 0xc1, 0x48, 0xe3, 0x19, 0x53,
+  0xa7, 0x4e, 0x75, 0x99, 0x6e, 0xa2, 0xbb, 0xbb, 0xfb, 0xa3, 0x8f, 0x3e, 0xfa, 0xf4, 0xd3, 0x4f,
+  0xb1, 0x98, 0xb3, 0x6c, 0x36, 0x5b, 0x55, 0x55, 0xd5, 0x3b, 0xef, 0xbc, 0x43, 0xba, 0x2d, 0x11,
+  0xc1, 0xdc, 0xb9, 0x73, 0x5d, 0x1e, 0x67, 0x79, 0xef, 0xde, 0xbd, 0xdd, 0xbb, 0x77, 0x1f, 0x3f,
+  0x7e, 0x1c, 0xcb, 0x89, 0x28, 0x66, 0xb3, 0xf9, 0xfa, 0xf5, 0xeb, 0x6f, 0xbd, 0xf5, 0x16, 0x8e,
+  0x29, 0xd5, 0xbd, 0x63, 0x4a, 0x32, 0x32, 0x32, 0xd0, 0xcc, 0xb8, 0x64, 0xd1, 0x03, 0x00, 0x90,
+  0x94, 0x94, 0x94, 0x9f, 0x9f, 0xef, 0xd2, 0xd4, 0xdd, 0xd6, 0xd6, 0x76, 0xf8, 0xf0, 0x61, 0x5f,
+  0x5f, 0xdf, 0x99, 0x33, 0x67, 0xc6, 0xc6, 0xc6, 0x06, 0x05, 0x05, 0x79, 0x7b, 0x7b, 0x23, 0xbe,
+  0x09, 0x36, 0x9b, 0x6d, 0x60, 0x60, 0x40, 0xa3, 0xd1, 0xb4, 0xb7, 0xb7, 0x97, 0x96, 0x96, 0xba,
+  0x3c, 0x2a, 0x84, 0xc5, 0x62, 0x51, 0x7d, 0x6c, 0xd2, 0x03, 0xc4, 0xaa, 0x55, 0xab, 0xe4, 0x72,
+  0xb9, 0xcb, 0x91, 0x54, 0x56, 0x56, 0x56, 0x56, 0x56, 0x16, 0x19, 0x19, 0x29, 0x95, 0x4a, 0x91,
+  0x60, 0x38, 0x3e, 0x9f, 0x8f, 0xb8, 0x9a, 0x5b, 0x2c, 0x16, 0xbd, 0x5e, 0xaf, 0x54, 0x2a, 0x6f,
+  0xdf, 0xbe, 0x5d, 0x5e, 0x5e, 0x0e, 0x09, 0xd6, 0x45, 0xe0, 0xe1, 0xe1, 0x41, 0xc4, 0x11, 0xfd,
+  0xc5, 0x17, 0x5f, 0xdc, 0xb4, 0x69, 0x93, 0x4b, 0x4f, 0xea, 0x8b, 0x17, 0x2f, 0x5e, 0xbc, 0x78,
+  0x11, 0x39, 0x64, 0x3d, 0x2c, 0x2c, 0x4c, 0x2c, 0x16, 0xf3, 0x78, 0x3c, 0x44, 0x36, 0xb3, 0x58,
+  0x2c, 0x5a, 0xad, 0xb6, 0xab, 0xab, 0xab, 0xa1, 0xa1, 0xa1, 0xb2, 0xb2, 0xd2, 0xa5, 0xf8, 0xc7,
+  0x60, 0x30, 0x9c, 0x46, 0x65, 0xba, 0x47, 0x8f, 0xe0, 0xe0, 0xe0, 0xf8, 0xf8, 0x78, 0xb8, 0xe3,
+  0x40, 0x42, 0x42, 0x02, 0xf1, 0xe8, 0xf0, 0x27, 0x9e, 0x78, 0x42, 0xab, 0xd5, 0x62, 0x31, 0xbd,
+  0x69, 0xb5, 0xda, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x22, 0x06, 0x83, 0x21, 0x10, 0x08, 0xb8, 0x5c,
+  0x2e, 0x83, 0xc1, 0x18, 0x1a, 0x1a, 0x32, 0x18, 0x0c, 0x18, 0x47, 0xfc, 0x92, 0x25, 0x4b, 0x9a,
+  0x9a, 0x9a, 0xe0, 0xbe, 0x37, 0x0f, 0x3b, 0x36, 0x6d, 0xda, 0xb4, 0x75, 0xeb, 0x56, 0x2c, 0xa7,
+  0xa8, 0xb6, 0xb4, 0xb4, 0x20, 0x72, 0x0b, 0x8b, 0xc5, 0x12, 0x08, 0x04, 0x6c, 0x36, 0xdb, 0x66,
+  0xb3, 0x99, 0x4c, 0x26, 0x8c, 0x9e, 0xf0, 0x9e, 0x9e, 0x9e, 0x79, 0x79, 0x79, 0x58, 0xe6, 0x50,
+  0xb8, 0x88, 0xb5, 0x65, 0xcb, 0x96, 0xbf, 0xfe, 0xf5, 0xaf, 0x58, 0x44, 0x03, 0xe4, 0x6c, 0x6b,
+  0xe4, 0xd6, 0x02, 0x81, 0xc0, 0xd3, 0xd3, 0xd3, 0x66, 0xb3, 0x0d, 0x0e, 0x0e, 0x62, 0x94, 0xfa,
+  0x82, 0x82, 0x82, 0xd2, 0xd2, 0xd2, 0xd0, 0xe6, 0x62, 0xb7, 0x43, 0xb1, 0x20, 0x2e, 0xee, 0x08,
+  0xc8, 0xca, 0x68, 0xbf, 0x66, 0xcd, 0x1a, 0xb7, 0xd2, 0xe0, 0xda, 0xed, 0xf6, 0xfe, 0xfe, 0x7e,
+  0x8d, 0x46, 0xa3, 0x56, 0xab, 0x75, 0x3a, 0x1d, 0x46, 0x6e, 0xcc, 0x98, 0x31, 0x63, 0xc1, 0x82,
+  0x05, 0xa4, 0x6f, 0x39, 0x8d, 0x37, 0x70, 0x38, 0x9c, 0x37, 0xdf, 0x7c, 0xd3, 0xad, 0x40, 0x73,
+  0xab, 0xd5, 0xaa, 0xd3, 0xe9, 0xd4, 0x6a, 0x75, 0x77, 0x77, 0x37, 0xf6, 0x28, 0x91, 0x57, 0x5f,
+  0x7d, 0x35, 0x2b, 0x2b, 0x8b, 0xf8, 0x52, 0x2c, 0x16, 0x8b, 0x37, 0x6d, 0xda, 0xe4, 0xd6, 0x21,
+  0x6c, 0xc8, 0x8a, 0x81, 0x74, 0x18, 0xbb, 0x46, 0xf4, 0xea, 0xab, 0xaf, 0x26, 0x26, 0x26, 0xa2,
+  0x05, 0xf4, 0xbb, 0x4d, 0x8f, 0xa9, 0x53, 0xa7, 0x42, 0x52, 0xcb, 0xb0, 0xd9, 0x6c, 0xe2, 0xe7,
+  0xa0, 0x3b, 0xb0, 0x6e, 0xdd, 0x3a, 0x4a, 0x93, 0x32, 0x45, 0x44, 0x44, 0x20, 0x99, 0x61, 0xa9,
+  0x0e, 0x12, 0x1a, 0x0f, 0x10, 0x8b, 0xc5, 0x9b, 0x37, 0x6f, 0x26, 0x25, 0xc3, 0x39, 0x1a, 0xf2,
+  0xf2, 0xf2, 0xa2, 0xa3, 0xa3, 0xb1, 0xe8, 0x03, 0x58, 0x20, 0x91, 0x48, 0x36, 0x6f, 0xde, 0x4c,
+  0x69, 0xee, 0x88, 0x67, 0x9e, 0x79, 0xc6, 0xcf, 0xcf, 0x0f, 0xe2, 0x95, 0xe8, 0x36, 0x3d, 0xe0,
+  0xbb, 0x9b, 0x52, 0xa9, 0x94, 0xdc, 0xe0, 0xe0, 0xd5, 0xab, 0x57, 0xe3, 0x3b, 0xd6, 0xd0, 0x25,
+  0x12, 0x12, 0x12, 0x36, 0x6f, 0xde, 0xec, 0x90, 0x95, 0x7f, 0x0b, 0x6a, 0xba, 0x48, 0x24, 0xda,
+  0xb6, 0x6d, 0x1b, 0x6e, 0xa3, 0x22, 0x1c, 0x8b, 0x17, 0x2f, 0x46, 0x8e, 0x97, 0x20, 0x71, 0x33,
+  0x3e, 0x2c, 0x2c, 0x6c, 0xdb, 0xb6, 0x6d, 0xf0, 0x4c, 0x6d, 0x44, 0x54, 0x32, 0xc4, 0x99, 0x10,
+  0x22, 0xc2, 0xe1, 0x19, 0xca, 0x10, 0xf1, 0x09, 0xbb, 0x0f, 0x22, 0x76, 0xe4, 0xe4, 0xe4, 0x6c,
+  0xde, 0xbc, 0x99, 0xdc, 0x7c, 0x47, 0x0b, 0x16, 0x2c, 0xb8, 0x9f, 0x87, 0xe0, 0x8c, 0x1f, 0x30,
+  0x18, 0x8c, 0xf5, 0xeb, 0xd7, 0xaf, 0x5a, 0xb5, 0x8a, 0xc4, 0x19, 0x81, 0xcf, 0xe7, 0xaf, 0x5f,
+  0xbf, 0xde, 0x71, 0x30, 0x1d, 0xb9, 0xf3, 0x23, 0x9f, 0xcf, 0xdf, 0xb8, 0x71, 0xe3, 0xe2, 0xc5,
+  0x8b, 0x49, 0x6c, 0xd3, 0xdf, 0xdf, 0xff, 0x8d, 0x37, 0xde, 0x70, 0x18, 0xf4, 0x20, 0x3b, 0x2d,
+  0x2c, 0x7c, 0x93, 0x50, 0x58, 0x58, 0xd8, 0xd8, 0x2c, 0xae, 0x88, 0xf5, 0x80, 0x22, 0x29, 0x68,
+  0xfb, 0xf6, 0xed, 0x3f, 0xfe, 0xf8, 0x63, 0x51, 0x51, 0x11, 0x16, 0xfd, 0xd2, 0xa5, 0x59, 0x6c,
+  0x54, 0x38, 0x04, 0x9a, 0x91, 0xc4, 0xa5, 0xf9, 0x05, 0x12, 0x79, 0x07, 0x49, 0x4e, 0xe3, 0x16,
+  0x20, 0xed, 0xe0, 0x8e, 0xfb, 0x9b, 0x33, 0x67, 0xce, 0x94, 0x29, 0x53, 0xce, 0x9f, 0x3f, 0x7f,
+  0xe9, 0xd2, 0x25, 0xe2, 0x13, 0x4d, 0x6e, 0x6e, 0xee, 0x48, 0x8f, 0x55, 0x34, 0xc5, 0x03, 0x47,
+  0x90, 0xad, 0x03, 0x8b, 0x16, 0x2d, 0x4a, 0x4e, 0x4e, 0x3e, 0x7b, 0xf6, 0x2c, 0xc6, 0x24, 0xe8,
+  0x10, 0x1d, 0x2c, 0x3f, 0x3f, 0x3f, 0x27, 0x27, 0x67, 0xa4, 0x56, 0xe3, 0xf4, 0x31, 0x22, 0xbd,
+  0xc5, 0x79, 0xfe, 0xf4, 0xe2, 0xc5, 0x8b, 0xc7, 0x3a, 0xc0, 0x90, 0x7b, 0x02, 0x83, 0x53, 0xab,
+  0x40, 0x66, 0x66, 0xe6, 0xb5, 0x6b, 0xd7, 0x64, 0x32, 0x19, 0x24, 0x53, 0xa3, 0x53, 0xf0, 0x78,
+  0xbc, 0xe4, 0xe4, 0x64, 0xb4, 0x43, 0x93, 0x7d, 0x7d, 0x7d, 0x9d, 0xae, 0xb0, 0x2e, 0x13, 0x78,
+  0x72, 0xb9, 0x5c, 0xb4, 0x4d, 0x4c, 0x1c, 0xe9, 0x9e, 0xd0, 0xda, 0x41, 0xbb, 0x05, 0x91, 0x0c,
+  0x5d, 0xfe, 0xfe, 0xfe, 0x2b, 0x56, 0xac, 0x98, 0x35, 0x6b, 0x56, 0x69, 0x69, 0xe9, 0x8d, 0x1b,
+  0x37, 0xdc, 0x75, 0x66, 0x0b, 0x09, 0x09, 0x49, 0x4e, 0x4e, 0x9e, 0x39, 0x73, 0xe6, 0xd8, 0x58,
+  0x6b, 0x36, 0x9b, 0xed, 0xb4, 0xc3, 0x88, 0x51, 0x91, 0x88, 0xa0, 0xb5, 0x76, 0xed, 0xda, 0xec,
+  0xec, 0xec, 0xf2, 0xf2, 0xf2, 0x9a, 0x9a, 0x1a, 0x77, 0x33, 0x10, 0x48, 0x24, 0x92, 0xd4, 0xd4,
+  0xd4, 0x8c, 0x8c, 0x8c, 0xb1, 0x6e, 0x04, 0x4e, 0x5f, 0x22, 0xf2, 0x0d, 0x03, 0x77, 0x32, 0xbf,
+  0xb1, 0x93, 0x01, 0xd5, 0x29, 0xc6, 0x46, 0xa2, 0xa5, 0xa5, 0xa5, 0xa1, 0xa1, 0xa1, 0xad, 0xad,
+  0xad, 0xab, 0xab, 0x0b, 0xcd, 0xee, 0xc4, 0x62, 0xb1, 0xc4, 0x62, 0x71, 0x68, 0x68, 0x68, 0x54,
+  0x54, 0x54, 0x6a, 0x6a, 0x2a, 0xa4, 0x7b, 0x66, 0xb3, 0xd9, 0xe9, 0x73, 0x60, 0xb3, 0xd9, 0x70,
+  0x51, 0x61, 0x78, 0x78, 0x18, 0x6d, 0x0a, 0x67, 0xb1, 0x58, 0x6e, 0x19, 0x5e, 0x20, 0x16, 0x24,
+  0xb4, 0xf9, 0x98, 0xac, 0x5b, 0x00, 0x00, 0xaa, 0xab, 0xab, 0x9b, 0x9b, 0x9b, 0xdb, 0xdb, 0xdb,
+  0x55, 0x2a, 0x15, 0xda, 0x7a, 0xe5, 0xe5, 0xe5, 0x15, 0x14, 0x14, 0x24, 0x91, 0x48, 0x62, 0x63,
+  0x63, 0x21, 0x06, 0x18, 0x9b, 0xcd, 0x86, 0xd6, 0x02, 0x87, 0xc3, 0x21, 0xc2, 0x90, 0x91, 0xcf,
+  0x04, 0x99, 0x22, 0x15, 0x0a, 0x85, 0x46, 0xa3, 0x41, 0x7b, 0x05, 0x7c, 0x3e, 0x3f, 0x38, 0x38,
+  0x58, 0x22, 0x91, 0xc4, 0xc7, 0xc7, 0x43, 0x3c, 0x06, 0xd1, 0x5e, 0x22, 0x97, 0xcb, 0xfd, 0xff,
+  0x01, 0x00, 0x13, 0x4a, 0xb0, 0xd1, 0x73, 0x57, 0x1a, 0x84, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+  0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+#endif
+
+typedef struct
+{
+  const char     *_uri;
+  PGM_P           _contentType;
+  const uint8_t  *_data;
+  size_t          _length;
+  const char     *_etag;              // Strong ETag, quotes included
+  bool            _gzipped;
+} WM_PortalAsset;
+
+const WM_PortalAsset WM_PORTAL_ASSETS[] =
+{
+#if WM_ASSET_WM_CSS_ENABLED
+  { "/wm.css", WM_ASSET_WM_CSS_TYPE, WM_ASSET_WM_CSS_DATA, WM_ASSET_WM_CSS_LENGTH, WM_ASSET_WM_CSS_ETAG, WM_ASSET_WM_CSS_GZIPPED },
+#endif
+#if WM_ASSET_WM_JS_ENABLED
+  { "/wm.js", WM_ASSET_WM_JS_TYPE, WM_ASSET_WM_JS_DATA, WM_ASSET_WM_JS_LENGTH, WM_ASSET_WM_JS_ETAG, WM_ASSET_WM_JS_GZIPPED },
+#endif
+#if WM_ASSET_TZ_JS_ENABLED
+  { "/tz.js", WM_ASSET_TZ_JS_TYPE, WM_ASSET_TZ_JS_DATA, WM_ASSET_TZ_JS_LENGTH, WM_ASSET_TZ_JS_ETAG, WM_ASSET_TZ_JS_GZIPPED },
+#endif
+#if WM_ASSET_LOGO_PNG_ENABLED
+  { "/logo.png", WM_ASSET_LOGO_PNG_TYPE, WM_ASSET_LOGO_PNG_DATA, WM_ASSET_LOGO_PNG_LENGTH, WM_ASSET_LOGO_PNG_ETAG, WM_ASSET_LOGO_PNG_GZIPPED },
+#endif
+};
+
+#define WM_NUM_PORTAL_ASSETS          ( sizeof(WM_PORTAL_ASSETS) / sizeof(WM_PORTAL_ASSETS[0]) )
+
+#endif    // USE_PORTAL_ASSETS
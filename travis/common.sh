@@ -4,6 +4,13 @@ function build_examples()
 {
   # track the exit code for this platform
   local exit_code=0
+
+  # the sketches build with the committed asset headers, which must be up to date first
+  if ! check_portal_assets; then
+    echo -e "\xe2\x9c\x96 ESP_WiFiManager_Assets.h out of date, run python3 extras/portal_assets.py"
+    exit_code=1
+  fi
+
   # loop through results and add them to the array
   examples=($(find $PWD/examples/ -name "*.pde" -o -name "*.ino"))
 
@@ -49,3 +56,9 @@ function build_examples()
 
   return $exit_code
 }
+
+function check_portal_assets()
+{
+  # the generated ESP_WiFiManager_Assets.h must match the sources in extras/portal, in all variants
+  python3 $PWD/extras/portal_assets.py --check
+}